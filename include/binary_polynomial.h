@@ -0,0 +1,144 @@
+#ifndef BINARY_POLYNOMIAL_H
+#define BINARY_POLYNOMIAL_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include <polynomial.h>
+#include <polynomial_view.h>
+
+/**
+ * @brief Polynomial in Z_q[x]/(x^n + 1) whose coefficients are 0 or one fixed value.
+ *
+ * Encoded messages (coefficients in {0, 1}), hashed messages and
+ * polySignal() outputs (coefficients in {0, floor(q/2)}) carry one bit of
+ * information per coefficient. A BinaryPolynomial stores exactly that: n
+ * bits packed into 64-bit words, coefficient i in bit i % 64 of word
+ * i / 64, plus the value a set bit stands for. A KYBER512 hash takes
+ * 32 bytes instead of the 2 KiB of a Polynomial.
+ *
+ * Comparisons work on whole words (XOR and popcount), and the polynomial
+ * is expanded into coefficients only when it is added into a
+ * BasicPolynomial. Bits beyond n in the last word are always zero.
+ */
+class BinaryPolynomial {
+public:
+    /**
+     * @brief Construct the zero polynomial.
+     *
+     * @param n   Ring dimension.
+     * @param q   Coefficient modulus.
+     * @param one Coefficient value of a set bit, in [1, q).
+     *
+     * @throws std::invalid_argument If n or q is zero or @p one is not in [1, q).
+     */
+    BinaryPolynomial(std::size_t n, std::uint64_t q, std::uint64_t one);
+
+    /**
+     * @brief Unpack bits MSB-first from bytes (bit 7 of byte 0 is coefficient 0).
+     *
+     * This is the order used for message encoding. Coefficients past
+     * 8 * @p size stay zero; bits past n are ignored.
+     */
+    static BinaryPolynomial fromBytes(const std::uint8_t* data, std::size_t size,
+                                      std::size_t n, std::uint64_t q, std::uint64_t one);
+
+    /**
+     * @brief Expand a message into n bits with counter-mode SHA-256.
+     *
+     * Block i is SHA-256(le32(i) || message); the digests are concatenated
+     * and read MSB-first as in fromBytes(). Each digest is written
+     * straight into the bit words without an intermediate coefficient
+     * vector. Set bits stand for floor(q/2).
+     */
+    static BinaryPolynomial fromSHA256(const std::vector<std::uint8_t>& message,
+                                       std::size_t n, std::uint64_t q);
+
+    /**
+     * @brief Binary form of BasicPolynomial::polySignal() for viewed values.
+     *
+     * Bit i is set where the signal rounds coefficient i to floor(q/2);
+     * NTT-domain values are converted first.
+     */
+    template<typename Coeff>
+    static BinaryPolynomial signalOf(const BasicPolynomialView<Coeff>& view);
+
+    /** @copydoc signalOf(const BasicPolynomialView<Coeff>&) */
+    template<typename Coeff>
+    static BinaryPolynomial signalOf(const BasicPolynomial<Coeff>& poly) {
+        return signalOf(poly.view());
+    }
+
+    /** @return Ring dimension n. */
+    std::size_t degree() const { return ring_dim; }
+
+    /** @return Coefficient modulus q. */
+    std::uint64_t getModulus() const { return modulus; }
+
+    /** @return Coefficient value of a set bit. */
+    std::uint64_t oneValue() const { return one; }
+
+    /** @return Whether coefficient @p idx is set (no bounds checking). */
+    bool test(std::size_t idx) const { return (bits[idx / 64] >> (idx % 64)) & 1; }
+
+    /** @brief Set or clear coefficient @p idx (no bounds checking). */
+    void set(std::size_t idx, bool value) {
+        const std::uint64_t mask = std::uint64_t(1) << (idx % 64);
+        bits[idx / 64] = value ? bits[idx / 64] | mask : bits[idx / 64] & ~mask;
+    }
+
+    /** @return Packed bit words, coefficient i in bit i % 64 of word i / 64. */
+    const std::vector<std::uint64_t>& words() const { return bits; }
+
+    /** @return Number of set coefficients. */
+    std::size_t popcount() const;
+
+    /**
+     * @brief Number of coefficients in which two polynomials differ.
+     *
+     * @throws std::invalid_argument If the rings or set-bit values differ.
+     */
+    std::size_t distance(const BinaryPolynomial& other) const;
+
+    /** @return True if ring, set-bit value and every bit match. */
+    bool operator==(const BinaryPolynomial& other) const;
+
+    bool operator!=(const BinaryPolynomial& other) const { return !(*this == other); }
+
+    /**
+     * @brief Add the coefficients of set bits into @p target: target += this.
+     *
+     * The bits are expanded to an all-or-nothing mask per coefficient in
+     * a scratch buffer and added with the Elementwise kernels, so the
+     * addition is branch-free. @p target keeps its domain handling (see
+     * BasicPolynomial::operator+=).
+     *
+     * @throws std::invalid_argument If @p target is in a different ring.
+     */
+    template<typename Coeff>
+    void addTo(BasicPolynomial<Coeff>& target) const;
+
+    /**
+     * @brief Expand to a polynomial with coefficients in {0, oneValue()}.
+     */
+    template<typename Coeff = std::uint64_t>
+    BasicPolynomial<Coeff> toPolynomial() const {
+        BasicPolynomial<Coeff> result(ring_dim, modulus);
+        addTo(result);
+        return result;
+    }
+
+private:
+    std::size_t ring_dim;
+    std::uint64_t modulus;
+    std::uint64_t one;
+    std::vector<std::uint64_t> bits;
+
+    /** @brief Set the coefficients from MSB-first bytes starting at coefficient @p offset. */
+    void loadBytesMSBFirst(const std::uint8_t* data, std::size_t size, std::size_t offset);
+
+    void requireSameShape(const BinaryPolynomial& other) const;
+};
+
+#endif // BINARY_POLYNOMIAL_H
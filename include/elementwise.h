@@ -0,0 +1,202 @@
+#ifndef ELEMENTWISE_H
+#define ELEMENTWISE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+ * @brief Instruction sets available to the coefficient-wise kernels.
+ */
+enum class ElementwiseKernel {
+    /**
+     * @brief Portable loops compiled for the baseline target.
+     *
+     * Always available.
+     */
+    Scalar,
+
+    /**
+     * @brief The same branch-free loops compiled for AVX2.
+     *
+     * Requires an x86-64 host with AVX2 and a GCC-compatible compiler.
+     */
+    AVX2,
+
+    /**
+     * @brief The same branch-free loops compiled for AVX-512 (F, BW, VL, DQ).
+     *
+     * Requires an x86-64 host with those extensions and a GCC-compatible
+     * compiler.
+     */
+    AVX512,
+};
+
+/**
+ * @brief Coefficient-wise modular arithmetic on raw coefficient arrays.
+ *
+ * Every element-wise operation of BasicPolynomial (addition, subtraction,
+ * negation, scalar and pointwise multiplication, polySignal) runs through
+ * these kernels. They are written without data-dependent branches:
+ * reductions are conditional subtractions expressed as selects, and
+ * polySignal compares cyclic distances with min/select, so the compiler
+ * turns each loop into packed compares and blends. Each loop is compiled
+ * once per ElementwiseKernel and the widest kernel supported by the host
+ * CPU is used, mirroring the per-ring kernel selection of the NTT.
+ * Products use K-RED (see SpecialPrimeReducer) when q has a special form
+ * and the division-free Barrett and Shoup reductions of Modulus otherwise.
+ *
+ * All inputs must be reduced, i.e. lie in [0, q). @p Word is uint16_t,
+ * uint32_t or uint64_t; the kernels are explicitly instantiated for those
+ * in elementwise.cpp. Outputs may alias inputs.
+ */
+class Elementwise {
+public:
+    /**
+     * @brief Check whether a kernel can run on this host.
+     */
+    static bool isKernelSupported(ElementwiseKernel kernel);
+
+    /** @return All kernels known to this build, in declaration order. */
+    static std::vector<ElementwiseKernel> allKernels();
+
+    /** @return Stable lower-case name of a kernel (e.g. "avx2"). */
+    static const char* kernelName(ElementwiseKernel kernel);
+
+    /**
+     * @brief Parse a name produced by kernelName().
+     *
+     * @throws std::invalid_argument if @p name is unknown.
+     */
+    static ElementwiseKernel kernelFromName(const std::string& name);
+
+    /**
+     * @brief Select the kernel used by all subsequent calls.
+     *
+     * @throws std::invalid_argument if @p kernel is not supported on this host.
+     */
+    static void setPreferredKernel(ElementwiseKernel kernel);
+
+    /**
+     * @brief Kernel currently in use.
+     *
+     * Without a registered preference this is the widest supported kernel.
+     */
+    static ElementwiseKernel preferredKernel();
+
+    /** @brief Forget a preference set with setPreferredKernel(). */
+    static void clearPreferredKernel();
+
+    /** @brief a[i] = a[i] + b[i] mod q. */
+    template<typename Word>
+    static void add(Word* a, const Word* b, std::size_t n, std::uint64_t q);
+
+    /** @brief a[i] = a[i] - b[i] mod q. */
+    template<typename Word>
+    static void sub(Word* a, const Word* b, std::size_t n, std::uint64_t q);
+
+    /** @brief a[i] = b[i] - a[i] mod q. */
+    template<typename Word>
+    static void subFrom(Word* a, const Word* b, std::size_t n, std::uint64_t q);
+
+    /** @brief a[i] = -a[i] mod q. */
+    template<typename Word>
+    static void negate(Word* a, std::size_t n, std::uint64_t q);
+
+    /**
+     * @brief a[i] = a[i] * scalar mod q.
+     *
+     * @param scalar Any value; reduced modulo q first.
+     */
+    template<typename Word>
+    static void scale(Word* a, std::size_t n, std::uint64_t scalar, std::uint64_t q);
+
+    /** @brief a[i] = a[i] * b[i] mod q. */
+    template<typename Word>
+    static void mulPointwise(Word* a, const Word* b, std::size_t n, std::uint64_t q);
+
+    /**
+     * @brief a[i] = a[i] * w[i] mod q with precomputed Shoup companions.
+     *
+     * @param w       Fixed multiplicands in [0, q), e.g. a PreparedPolynomial.
+     * @param w_shoup Their companions Modulus::shoup(w[i]).
+     *
+     * Requires q <= 2^32. One multiply-high estimate per element replaces
+     * the Barrett or K-RED reduction of mulPointwise().
+     */
+    template<typename Word>
+    static void mulPointwiseShoup(Word* a, const std::uint64_t* w, const std::uint64_t* w_shoup,
+                                  std::size_t n, std::uint64_t q);
+
+    /**
+     * @brief Round each value to 0 or floor(q/2), whichever is cyclically closer.
+     *
+     * Ties go to 0 (see BasicPolynomial::polySignal()).
+     */
+    template<typename Word>
+    static void signal(const Word* a, Word* out, std::size_t n, std::uint64_t q);
+
+    /**
+     * @brief Centered infinity norm: max over i of min(a[i], q - a[i]).
+     *
+     * Inputs must be reduced; see withinBound() for untrusted data.
+     */
+    template<typename Word>
+    static std::uint64_t normInf(const Word* a, std::size_t n, std::uint64_t q);
+
+    /**
+     * @brief Squared centered L2 norm: sum over i of min(a[i], q - a[i])^2.
+     *
+     * Saturates to UINT64_MAX if the exact value does not fit 64 bits
+     * (never for q < 2^16 and n <= 2^34).
+     */
+    template<typename Word>
+    static std::uint64_t normL2Squared(const Word* a, std::size_t n, std::uint64_t q);
+
+    /**
+     * @brief Check untrusted values: every a[i] < q with centered magnitude <= bound.
+     *
+     * Scans all n values without exiting early, so the time taken does not
+     * depend on where a violation is.
+     */
+    template<typename Word>
+    static bool withinBound(const Word* a, std::size_t n, std::uint64_t q, std::uint64_t bound);
+
+    /**
+     * @brief Compress_d: a[i] = round(2^d * a[i] / q) mod 2^d.
+     *
+     * The division is a Barrett multiply-shift with one correction, valid
+     * while bits(q) + 2d <= 62 (see BasicPolynomial::supportsCompression()).
+     */
+    template<typename Word>
+    static void compress(Word* a, std::size_t n, unsigned d, std::uint64_t q);
+
+    /** @brief Decompress_d: a[i] = round(q * a[i] / 2^d) for a[i] < 2^d. */
+    template<typename Word>
+    static void decompress(Word* a, std::size_t n, unsigned d, std::uint64_t q);
+
+    /**
+     * @brief acc[i] = acc[i] + a[i], without reducing.
+     *
+     * For deferred reduction (see PolynomialAccumulator): the caller
+     * ensures the 64-bit sums cannot overflow.
+     */
+    template<typename Word>
+    static void accumulate(std::uint64_t* acc, const Word* a, std::size_t n);
+
+    /** @brief acc[i] = acc[i] + (q - a[i]), i.e. subtract a[i] without reducing. */
+    template<typename Word>
+    static void accumulateNegated(std::uint64_t* acc, const Word* a, std::size_t n, std::uint64_t q);
+
+    /**
+     * @brief out[i] = acc[i] mod q for arbitrary 64-bit acc[i].
+     *
+     * Uses the Barrett reciprocal of Modulus; @p out may alias @p acc
+     * when Word is uint64_t.
+     */
+    template<typename Word>
+    static void reduceWide(const std::uint64_t* acc, Word* out, std::size_t n, std::uint64_t q);
+};
+
+#endif // ELEMENTWISE_H
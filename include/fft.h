@@ -0,0 +1,98 @@
+#ifndef FFT_H
+#define FFT_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/**
+ * @brief Double-precision FFT multiplier for Z_q[x]/(x^n + 1).
+ *
+ * Provides O(n log n) negacyclic multiplication for (n, q) pairs that
+ * have no NTT tables, including moduli that are not NTT-friendly or not
+ * prime. Inputs are lifted to centered integers in (-q/2, q/2], their
+ * exact integer product in Z[x]/(x^n + 1) is computed in floating point
+ * and rounded, and the result is reduced modulo q.
+ *
+ * The real length-n negacyclic convolution is folded into a complex one
+ * of length n/2 (as in Falcon): modulo @f$x^{n/2} - i@f$ a real polynomial
+ * @f$a_{lo} + x^{n/2} a_{hi}@f$ becomes @f$a_{lo} + i a_{hi}@f$, and the
+ * substitution @f$x = \zeta y@f$ with @f$\zeta = e^{i\pi/n}@f$ turns that
+ * into a cyclic convolution. The real and imaginary parts of the result
+ * are the lower and upper halves of the product.
+ *
+ * Exactness requires the product coefficients, bounded by
+ * @f$n (q/2)^2@f$, to stay well inside the 53-bit mantissa; isSupported()
+ * keeps a 5-bit margin for rounding error. Each output coefficient is
+ * also checked to lie within 1/4 of an integer before it is accepted.
+ */
+class FFTMultiplier {
+public:
+    /**
+     * @brief Construct a multiplier for a ring.
+     *
+     * @param n Ring dimension (power of two, at least 2).
+     * @param q Coefficient modulus.
+     *
+     * @throws std::invalid_argument If isSupported(n, q) is false.
+     */
+    FFTMultiplier(std::size_t n, std::uint64_t q);
+
+    /**
+     * @brief Check whether products in this ring are exactly recoverable.
+     *
+     * Requires n to be a power of two with n >= 2, q >= 2, and
+     * @f$n (q/2)^2 \le 2^{48}@f$ (e.g. any q < 2^20 for n <= 1024).
+     */
+    static bool isSupported(std::size_t n, std::uint64_t q);
+
+    /**
+     * @brief Get a shared multiplier for a ring, cached for the process.
+     *
+     * @throws std::invalid_argument If isSupported(n, q) is false.
+     */
+    static const FFTMultiplier& forRing(std::size_t n, std::uint64_t q);
+
+    /**
+     * @brief Multiply two polynomials with coefficients in [0, q).
+     *
+     * @param a First operand (n coefficients).
+     * @param b Second operand (n coefficients).
+     * @param out Receives the product reduced modulo q and x^n + 1.
+     * @return False if some coefficient failed the rounding check; @p out
+     *         is then unspecified and the caller should use an exact method.
+     *
+     * @throws std::invalid_argument If an operand has the wrong size.
+     */
+    bool tryMultiply(const std::vector<std::uint64_t>& a, const std::vector<std::uint64_t>& b,
+                     std::vector<std::uint64_t>& out) const;
+
+    /** @return Ring dimension n. */
+    std::size_t size() const { return n_; }
+
+    /** @return Modulus q. */
+    std::uint64_t modulus() const { return q_; }
+
+private:
+    std::size_t n_;
+    std::size_t m_;  ///< complex transform length n/2
+    std::uint64_t q_;
+
+    // Twist factors zeta^j, j < m.
+    std::vector<double> twist_re_;
+    std::vector<double> twist_im_;
+
+    // Per-layer roots of unity for the length-m transform, stored like the
+    // NTT layer twiddles: the layer with half-span h starts at offset h - 1.
+    std::vector<double> root_re_;
+    std::vector<double> root_im_;
+
+    void fold(const std::vector<std::uint64_t>& a, std::vector<double>& re,
+              std::vector<double>& im) const;
+
+    void transform(std::vector<double>& re, std::vector<double>& im, bool inverse) const;
+
+    void bitReverse(std::vector<double>& re, std::vector<double>& im) const;
+};
+
+#endif // FFT_H
@@ -0,0 +1,249 @@
+#ifndef FIXED_POLYNOMIAL_H
+#define FIXED_POLYNOMIAL_H
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <type_traits>
+
+#include <ntt.h>
+#include <ntt_tables.h>
+#include <polynomial.h>
+#include <polynomial_view.h>
+#include <special_prime.h>
+
+/**
+ * @brief Polynomial in Z_Q[x]/(x^N + 1) with compile-time ring parameters.
+ *
+ * Coefficients live in a std::array of the narrowest type that holds
+ * Q - 1 (see coeff_type_for_t), so a FixedPolynomial never touches the
+ * heap: element-wise operations run over a constant-length array the
+ * compiler can unroll and vectorize, and products use stack buffers with
+ * the caller-buffer NTT overloads whenever tables exist for (N, Q).
+ * Operands of different rings are different types, so ring mismatches
+ * are compile errors instead of runtime exceptions.
+ *
+ * FixedPolynomial interoperates with the runtime BasicPolynomial types
+ * through BasicPolynomialView: view() exposes the coefficients, and both
+ * sides can be constructed from a view of the other.
+ *
+ * @tparam N Ring dimension (power of two).
+ * @tparam Q Coefficient modulus, at most 2^32.
+ */
+template<std::size_t N, std::uint64_t Q>
+class FixedPolynomial {
+    static_assert(N >= 1 && (N & (N - 1)) == 0, "ring dimension must be a power of two");
+    static_assert(Q >= 2 && Q <= (static_cast<std::uint64_t>(1) << 32),
+                  "modulus must lie in [2, 2^32]");
+
+public:
+    /** @brief Coefficient storage type. */
+    using coeff_type = coeff_type_for_t<Q>;
+
+    /** @brief Ring dimension N. */
+    static constexpr std::size_t ring_dimension = N;
+
+    /** @brief Coefficient modulus Q. */
+    static constexpr std::uint64_t modulus = Q;
+
+    /** @brief True if products use the NTT (tables exist for (N, Q)). */
+    static constexpr bool has_ntt = ntt_tables::hasPsiTables(N, Q);
+
+    /**
+     * @brief Construct the zero polynomial.
+     */
+    FixedPolynomial() : coeffs_{} {}
+
+    /**
+     * @brief Construct from coefficients, reducing each modulo Q.
+     *
+     * @param coefficients Coefficients in ascending degree order.
+     */
+    explicit FixedPolynomial(const std::array<std::uint64_t, N>& coefficients) {
+        for (std::size_t i = 0; i < N; ++i) {
+            coeffs_[i] = static_cast<coeff_type>(coefficients[i] % Q);
+        }
+    }
+
+    /**
+     * @brief Copy coefficients out of a view of any coefficient width.
+     *
+     * @param view Coefficients in [0, Q).
+     *
+     * @throws std::invalid_argument If the view's ring is not (N, Q) or
+     *         the view is in the NTT domain.
+     */
+    template<typename ViewCoeff>
+    explicit FixedPolynomial(const BasicPolynomialView<ViewCoeff>& view) {
+        if (view.degree() != N || view.getModulus() != Q) {
+            throw std::invalid_argument("Polynomials must be in the same ring");
+        }
+        if (view.domain() != PolyDomain::Coefficient) {
+            throw std::invalid_argument("FixedPolynomial requires a coefficient-domain view");
+        }
+        std::copy(view.begin(), view.end(), coeffs_.begin());
+    }
+
+    /**
+     * @brief Convert a runtime polynomial of the same ring.
+     *
+     * @throws std::invalid_argument If @p poly is not in Z_Q[x]/(x^N + 1).
+     */
+    template<typename Coeff>
+    explicit FixedPolynomial(const BasicPolynomial<Coeff>& poly)
+        : FixedPolynomial(poly.view()) {}
+
+    /** @return Coefficient at @p idx (no bounds checking). */
+    coeff_type& operator[](std::size_t idx) { return coeffs_[idx]; }
+
+    /** @return Coefficient at @p idx (no bounds checking). */
+    const coeff_type& operator[](std::size_t idx) const { return coeffs_[idx]; }
+
+    /** @return Ring dimension N. */
+    static constexpr std::size_t degree() { return N; }
+
+    /** @return Coefficient modulus Q. */
+    static constexpr std::uint64_t getModulus() { return Q; }
+
+    /** @return Coefficient array in ascending degree order. */
+    const std::array<coeff_type, N>& getCoeffs() const { return coeffs_; }
+
+    /** @return Non-owning view of the coefficients. */
+    BasicPolynomialView<coeff_type> view() const {
+        return BasicPolynomialView<coeff_type>(coeffs_.data(), N, Q);
+    }
+
+    /**
+     * @brief Add another polynomial in place.
+     */
+    FixedPolynomial& operator+=(const FixedPolynomial& other) {
+        for (std::size_t i = 0; i < N; ++i) {
+            wide_type sum = static_cast<wide_type>(coeffs_[i]) + other.coeffs_[i];
+            coeffs_[i] = static_cast<coeff_type>(sum >= Q ? sum - Q : sum);
+        }
+        return *this;
+    }
+
+    /**
+     * @brief Subtract another polynomial in place.
+     */
+    FixedPolynomial& operator-=(const FixedPolynomial& other) {
+        for (std::size_t i = 0; i < N; ++i) {
+            wide_type diff = static_cast<wide_type>(coeffs_[i]) + Q - other.coeffs_[i];
+            coeffs_[i] = static_cast<coeff_type>(diff >= Q ? diff - Q : diff);
+        }
+        return *this;
+    }
+
+    /**
+     * @brief Multiply by a scalar in place.
+     *
+     * @param scalar Multiplier; reduced modulo Q first.
+     */
+    FixedPolynomial& operator*=(std::uint64_t scalar) {
+        const std::uint64_t s = scalar % Q;
+        for (std::size_t i = 0; i < N; ++i) {
+            coeffs_[i] = static_cast<coeff_type>((coeffs_[i] * s) % Q);
+        }
+        return *this;
+    }
+
+    /**
+     * @brief Multiply by another polynomial in place.
+     *
+     * Uses the NTT on stack buffers when tables exist for (N, Q) and the
+     * runtime Polynomial product otherwise. The NTT instance and reducer
+     * are looked up on the first call only.
+     */
+    FixedPolynomial& operator*=(const FixedPolynomial& other) {
+        if constexpr (has_ntt) {
+            // Resolved once per instantiation, since both registry lookups
+            // take a lock. Cached NTTs live for the whole process; the
+            // kernel preferred at first use is kept (all kernels agree).
+            static const NTT& ntt = NTT::forRing(N, Q);
+            static const SpecialPrimeReducer* const red = SpecialPrimeReducer::forModulus(Q);
+
+            std::array<std::uint32_t, N> a;
+            std::array<std::uint32_t, N> b;
+            std::copy(coeffs_.begin(), coeffs_.end(), a.begin());
+            std::copy(other.coeffs_.begin(), other.coeffs_.end(), b.begin());
+
+            ntt.forward(a.data(), N);
+            ntt.forward(b.data(), N);
+            for (std::size_t i = 0; i < N; ++i) {
+                a[i] = static_cast<std::uint32_t>(
+                    red ? red->mulMod(a[i], b[i]) : (static_cast<std::uint64_t>(a[i]) * b[i]) % Q);
+            }
+            ntt.inverse(a.data(), N);
+
+            for (std::size_t i = 0; i < N; ++i) {
+                coeffs_[i] = static_cast<coeff_type>(a[i]);
+            }
+        } else {
+            using Runtime = BasicPolynomial<coeff_type>;
+            *this = FixedPolynomial(Runtime(view()) * Runtime(other.view()));
+        }
+        return *this;
+    }
+
+    /** @return Sum of two polynomials. */
+    friend FixedPolynomial operator+(FixedPolynomial lhs, const FixedPolynomial& rhs) {
+        return lhs += rhs;
+    }
+
+    /** @return Difference of two polynomials. */
+    friend FixedPolynomial operator-(FixedPolynomial lhs, const FixedPolynomial& rhs) {
+        return lhs -= rhs;
+    }
+
+    /** @return Product of two polynomials in Z_Q[x]/(x^N + 1). */
+    friend FixedPolynomial operator*(FixedPolynomial lhs, const FixedPolynomial& rhs) {
+        return lhs *= rhs;
+    }
+
+    /** @return Polynomial scaled by @p scalar. */
+    friend FixedPolynomial operator*(FixedPolynomial lhs, std::uint64_t scalar) {
+        return lhs *= scalar;
+    }
+
+    /** @return Additive inverse. */
+    FixedPolynomial operator-() const {
+        FixedPolynomial result;
+        for (std::size_t i = 0; i < N; ++i) {
+            result.coeffs_[i] = static_cast<coeff_type>(coeffs_[i] == 0 ? 0 : Q - coeffs_[i]);
+        }
+        return result;
+    }
+
+    /** @return True if all coefficients are equal. */
+    friend bool operator==(const FixedPolynomial& lhs, const FixedPolynomial& rhs) {
+        return lhs.coeffs_ == rhs.coeffs_;
+    }
+
+    /** @return True if any coefficient differs. */
+    friend bool operator!=(const FixedPolynomial& lhs, const FixedPolynomial& rhs) {
+        return !(lhs == rhs);
+    }
+
+private:
+    // Wide enough for the sum of two residues; stays 32-bit where possible
+    // so narrow coefficients vectorize with 32-bit lanes.
+    using wide_type = std::conditional_t<(Q <= (static_cast<std::uint64_t>(1) << 31)),
+                                         std::uint32_t, std::uint64_t>;
+
+    std::array<coeff_type, N> coeffs_;
+};
+
+/** @name Fixed-size polynomials for the SecurityLevel parameter sets
+ * @{
+ */
+using TestTinyPolynomial = FixedPolynomial<8, 7681>;
+using TestSmallPolynomial = FixedPolynomial<32, 7681>;
+using Kyber512Polynomial = FixedPolynomial<256, 7681>;
+using ModeratePolynomial = FixedPolynomial<512, 12289>;
+using HighPolynomial = FixedPolynomial<1024, 18433>;
+/** @} */
+
+#endif // FIXED_POLYNOMIAL_H
@@ -2,7 +2,10 @@
 #define RLWE_H
 
 #include <cmath>
+#include <modulus.h>
 #include <polynomial.h>
+#include <prepared_polynomial.h>
+#include <small_polynomial.h>
 #include <vector>
 #include <cstdint>
 #include <iomanip>
@@ -96,7 +99,9 @@ public:
      *             used for noise sampling. If zero or negative,
      *             a reasonable default is chosen.
      *
-     * @throws std::invalid_argument If @p n is not a power of two.
+     * @throws std::invalid_argument If @p n is not a power of two, or if
+     *         @p sigma is so large that samples could exceed q - 1 or the
+     *         16-bit range of the centered secret and noise.
      */
     KEM(size_t n, uint64_t q, double sigma = 0.0);
 
@@ -117,9 +122,10 @@ public:
     /**
      * @brief Generate a fresh key pair.
      *
-     * Samples a uniform public polynomial @f$a@f$, a secret key
-     * polynomial @f$s@f$ from a discrete Gaussian, and an error
-     * polynomial @f$e@f$. The public key is @f$(a, b = a s + e)@f$.
+     * Samples a uniform public polynomial @f$a@f$ (directly in the NTT
+     * domain when the ring has tables), a secret key polynomial @f$s@f$
+     * from a discrete Gaussian, and an error polynomial @f$e@f$. The
+     * public key is @f$(a, b = a s + e)@f$.
      */
     void generateKeys();
 
@@ -132,6 +138,20 @@ public:
         return std::make_pair(a, b);
     }
 
+    /**
+     * @brief Retrieve the public key prepared for multiplication.
+     *
+     * Products with these operands skip their forward NTT (see
+     * PreparedPolynomial). The prepared b is cached by generateKeys();
+     * a is already stored in the NTT domain, so its prepared form is
+     * built from it here.
+     *
+     * @return Pair (a, b) in prepared form.
+     */
+    std::pair<PreparedPolynomial, PreparedPolynomial> getPreparedPublicKey() const {
+        return {PreparedPolynomial(a), b_prepared};
+    }
+
     /**
      * @brief Hash a message to a polynomial with coefficients in {0, q/2}.
      *
@@ -165,16 +185,21 @@ public:
      * provided solely to allow experiments like oracle_cca to
      * compare their recovered secret against the ground truth.
      */
-    Polynomial getSecretKeyForTesting() const { return s; }
+    Polynomial getSecretKeyForTesting() const { return s.toPolynomial(); }
 
 private:
     size_t ring_dim_n;
     uint64_t modulus;
+    const Modulus* modulus_info;  ///< interned reduction constants for modulus
     double gaussian_stddev;
 
     Polynomial a;
     Polynomial b;
-    Polynomial s;
+    SmallPolynomial16 s;  ///< centered secret, 2 bytes per coefficient
+
+    /** @brief NTT forms of b and s, refreshed by generateKeys(). */
+    PreparedPolynomial b_prepared;
+    PreparedPolynomial s_prepared;
 
     /**
      * @brief Generate a uniformly random 64-bit integer.
@@ -193,13 +218,27 @@ private:
      */
     Polynomial sampleUniform();
 
+    /**
+     * @brief Sample a uniform polynomial directly in the NTT domain.
+     *
+     * The NTT is a bijection on Z_q^n, so uniform evaluations are the
+     * evaluations of a uniform polynomial; sampling them directly saves
+     * the forward transform every product would otherwise need. Falls
+     * back to sampleUniform() in rings without NTT tables.
+     */
+    Polynomial sampleUniformNTT();
+
     /**
      * @brief Sample a polynomial with coefficients drawn from a
      *        discretized Gaussian distribution.
      *
+     * Samples are kept centered, one draw per coefficient. The
+     * constructors reject standard deviations whose samples might not
+     * fit a SmallPolynomial16 coefficient, so no sample is truncated.
+     *
      * @param stddev Standard deviation of the Gaussian.
      */
-    Polynomial sampleGaussian(double stddev);
+    SmallPolynomial16 sampleGaussian(double stddev);
 
     /**
      * @brief Encode a message as a polynomial with 0/1 coefficients.
@@ -221,12 +260,16 @@ private:
     static constexpr size_t MIN_DIFFERENT_COEFFS = 1;
 
     /**
-     * @brief Helper to log a byte sequence in hexadecimal form.
+     * @brief Format a byte sequence in hexadecimal form for logging.
+     *
+     * Intended as the argument of an RLWE_LOG_* macro so the formatting
+     * only happens when the message is actually written.
      *
      * @param prefix Descriptive prefix for the log line.
-     * @param message Bytes to log.
+     * @param message Bytes to format.
+     * @return Log line of the form "prefix bytes: [0A, FF, ...]".
      */
-    void logMessageBytes(const std::string& prefix, const std::vector<uint8_t>& message) {
+    static std::string formatMessageBytes(const std::string& prefix, const std::vector<uint8_t>& message) {
         std::stringstream ss;
         ss << prefix << " bytes: [";
         for (size_t i = 0; i < message.size(); ++i) {
@@ -237,7 +280,7 @@ private:
                << static_cast<int>(message[i]);
         }
         ss << "]";
-        Logger::log(ss.str());
+        return ss.str();
     }
 };
 
@@ -6,12 +6,61 @@
 #include <sstream>
 #include <vector>
 
+/**
+ * @name Compile-time log levels
+ *
+ * Numeric values used by RLWE_LOG_COMPILE_LEVEL. Log statements issued
+ * through the RLWE_LOG_* macros below this level are compiled out.
+ * @{
+ */
+#define RLWE_LOG_LEVEL_TRACE 0
+#define RLWE_LOG_LEVEL_DEBUG 1
+#define RLWE_LOG_LEVEL_INFO 2
+#define RLWE_LOG_LEVEL_WARN 3
+#define RLWE_LOG_LEVEL_OFF 4
+/** @} */
+
+/**
+ * @brief Lowest log level compiled into the binary.
+ *
+ * Defaults to RLWE_LOG_LEVEL_OFF in release builds (NDEBUG defined), which
+ * removes every RLWE_LOG_* statement together with its argument, and to
+ * RLWE_LOG_LEVEL_TRACE otherwise. Override with -DRLWE_LOG_COMPILE_LEVEL=...
+ * (the RLWE_LOG_LEVEL CMake cache variable does this).
+ */
+#ifndef RLWE_LOG_COMPILE_LEVEL
+#ifdef NDEBUG
+#define RLWE_LOG_COMPILE_LEVEL RLWE_LOG_LEVEL_OFF
+#else
+#define RLWE_LOG_COMPILE_LEVEL RLWE_LOG_LEVEL_TRACE
+#endif
+#endif
+
+/**
+ * @brief Severity of a log message.
+ */
+enum class LogLevel {
+    /** Full data dumps such as coefficient vectors of every operation. */
+    Trace = RLWE_LOG_LEVEL_TRACE,
+    /** Per-operation progress without bulk data. */
+    Debug = RLWE_LOG_LEVEL_DEBUG,
+    /** High-level lifecycle events (instance creation, key generation). */
+    Info = RLWE_LOG_LEVEL_INFO,
+    /** Conditions the user should act on, e.g. insecure parameters. */
+    Warn = RLWE_LOG_LEVEL_WARN,
+};
+
 /**
  * @brief Simple, configurable logging utility.
  *
  * The Logger provides a global, lightweight mechanism for emitting
- * diagnostic messages. Logging can be enabled or disabled globally
- * and redirected to any std::ostream.
+ * diagnostic messages. Logging can be enabled or disabled globally,
+ * filtered by level and redirected to any std::ostream.
+ *
+ * Library code logs through the RLWE_LOG_* macros, which evaluate their
+ * message expression only when the level is enabled, so a disabled log
+ * statement costs a single branch and no string formatting. Statements
+ * below RLWE_LOG_COMPILE_LEVEL disappear from the binary entirely.
  */
 class Logger {
 public:
@@ -20,6 +69,14 @@ public:
      */
     static bool enable_logging;
 
+    /**
+     * @brief Runtime threshold; messages below this level are dropped.
+     *
+     * Defaults to LogLevel::Trace, so enabling logging shows everything
+     * that was compiled in.
+     */
+    static LogLevel min_level;
+
     /**
      * @brief Output stream used for log messages.
      *
@@ -27,17 +84,58 @@ public:
      */
     static std::ostream* out;
 
+    /**
+     * @brief Check whether a message of the given level would be written.
+     *
+     * @param level Message severity.
+     * @return True if logging is enabled, an output stream is set and
+     *         @p level is at or above min_level.
+     */
+    static bool enabled(LogLevel level) {
+        return enable_logging && out && level >= min_level;
+    }
+
     /**
      * @brief Write a message to the log if logging is enabled.
      *
+     * The message is treated as LogLevel::Info. Prefer the RLWE_LOG_*
+     * macros, which avoid building the message when it would be dropped.
+     *
      * @param message Message to log.
      */
     static void log(const std::string& message) {
-        if (enable_logging && out) {
+        log(LogLevel::Info, message);
+    }
+
+    /**
+     * @brief Write a message with an explicit level.
+     *
+     * @param level Message severity.
+     * @param message Message to log.
+     */
+    static void log(LogLevel level, const std::string& message) {
+        if (enabled(level)) {
             *out << message << std::endl;
         }
     }
 
+    /**
+     * @brief Log a message produced on demand.
+     *
+     * @p make_message is only invoked when @p level is enabled, so it may
+     * perform arbitrarily expensive formatting.
+     *
+     * @tparam MessageFn Callable returning something convertible to std::string.
+     * @param level Message severity.
+     * @param make_message Message factory.
+     */
+    template<typename MessageFn>
+    static void logLazy(LogLevel level, MessageFn&& make_message) {
+        if (enabled(level)) {
+            *out << std::string(make_message()) << std::endl;
+        }
+    }
+
     /**
      * @brief Convert a vector to a formatted string.
      *
@@ -71,6 +169,38 @@ public:
 };
 
 inline bool Logger::enable_logging = false;
+inline LogLevel Logger::min_level = LogLevel::Trace;
 inline std::ostream* Logger::out = &std::cout;
 
+/**
+ * @brief Log @p message at @p level, evaluating @p message only if enabled.
+ *
+ * When @p compiled is false the statement is kept only for type checking
+ * and is removed by the compiler. The level macros below are variadic so
+ * that message expressions containing unparenthesized commas (lambdas,
+ * braced initializers) can be passed directly.
+ */
+#define RLWE_LOG_IMPL(compiled, level, message)                         \
+    do {                                                                \
+        if ((compiled) && Logger::enabled(level)) {                     \
+            Logger::log((level), (message));                            \
+        }                                                               \
+    } while (0)
+
+/** @brief Log a bulk data dump (coefficient vectors, byte strings). */
+#define RLWE_LOG_TRACE(...) \
+    RLWE_LOG_IMPL(RLWE_LOG_COMPILE_LEVEL <= RLWE_LOG_LEVEL_TRACE, LogLevel::Trace, (__VA_ARGS__))
+
+/** @brief Log per-operation progress. */
+#define RLWE_LOG_DEBUG(...) \
+    RLWE_LOG_IMPL(RLWE_LOG_COMPILE_LEVEL <= RLWE_LOG_LEVEL_DEBUG, LogLevel::Debug, (__VA_ARGS__))
+
+/** @brief Log a lifecycle event. */
+#define RLWE_LOG_INFO(...) \
+    RLWE_LOG_IMPL(RLWE_LOG_COMPILE_LEVEL <= RLWE_LOG_LEVEL_INFO, LogLevel::Info, (__VA_ARGS__))
+
+/** @brief Log a warning. */
+#define RLWE_LOG_WARN(...) \
+    RLWE_LOG_IMPL(RLWE_LOG_COMPILE_LEVEL <= RLWE_LOG_LEVEL_WARN, LogLevel::Warn, (__VA_ARGS__))
+
 #endif // LOGGING_H
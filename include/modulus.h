@@ -0,0 +1,177 @@
+#ifndef MODULUS_H
+#define MODULUS_H
+
+#include <cstddef>
+#include <cstdint>
+
+class SpecialPrimeReducer;
+
+/**
+ * @brief Immutable coefficient modulus q with precomputed reduction constants.
+ *
+ * A Modulus holds every constant the library needs to reduce modulo q
+ * without dividing:
+ * - a 64-bit Barrett reciprocal floor((2^64 - 1) / q), which reduces any
+ *   64-bit value with a portable high multiply and at most two
+ *   subtractions (reduce());
+ * - classic Barrett constants for products of two residues, a single
+ *   64-bit multiply-shift when q < 2^31 (mul());
+ * - Montgomery constants (-q^{-1} mod 2^32 and 2^64 mod q) for odd
+ *   q < 2^31, used by pow();
+ * - Shoup companions on demand (shoup(), mulShoup()) for multiplying by
+ *   a fixed constant;
+ * - the bit width and the special-form flags, with the matching
+ *   SpecialPrimeReducer when q = c * 2^k + 1 admits K-RED.
+ *
+ * Instances are interned: forValue() returns the one shared object for
+ * each q, which lives until the program exits, so BasicPolynomial, NTT
+ * and KEM can keep a pointer to it instead of a bare integer. The only
+ * divisions happen once, when the constants are computed. Copies are
+ * plain value snapshots; kernels take one so the constants cannot alias
+ * the arrays they write.
+ */
+class Modulus {
+public:
+    /**
+     * @brief Get the interned modulus for @p q.
+     *
+     * Thread-safe. Repeated lookups of the same q on one thread hit a
+     * one-entry cache and take no lock.
+     *
+     * @throws std::invalid_argument If q is zero.
+     */
+    static const Modulus& forValue(std::uint64_t q);
+
+    /** @return The modulus q. */
+    std::uint64_t value() const { return q_; }
+
+    /** @return Bits needed for a residue: the bit length of q - 1 (at least 1). */
+    unsigned bits() const { return bits_; }
+
+    /** @return True if q is a power of two (reduction is a mask). */
+    bool isPowerOfTwo() const { return (q_ & (q_ - 1)) == 0; }
+
+    /** @return True if mul() uses the single-word Barrett path (q < 2^31). */
+    bool hasWordBarrett() const { return word_barrett_; }
+
+    /** @return True if Montgomery constants exist (q odd and q < 2^31). */
+    bool hasMontgomery() const { return montgomery_; }
+
+    /** @return True if q = c * 2^k + 1 admits K-RED (see SpecialPrimeReducer). */
+    bool isSpecialForm() const { return special_ != nullptr; }
+
+    /** @return K-RED reducer for special-form q, nullptr otherwise. */
+    const SpecialPrimeReducer* special() const { return special_; }
+
+    /** @return x mod q for any 64-bit x. */
+    std::uint64_t reduce(std::uint64_t x) const {
+        std::uint64_t r = x - mulHigh(x, barrett64_) * q_;
+        r -= (r >= q_) ? q_ : 0;
+        r -= (r >= q_) ? q_ : 0;
+        return r;
+    }
+
+    /** @return x mod q for a signed value, in [0, q). */
+    std::uint64_t reduceSigned(std::int64_t x) const {
+        if (x >= 0) {
+            return reduce(static_cast<std::uint64_t>(x));
+        }
+        // -x as unsigned is exact even for INT64_MIN.
+        const std::uint64_t r = reduce(std::uint64_t(0) - static_cast<std::uint64_t>(x));
+        return r == 0 ? 0 : q_ - r;
+    }
+
+    /** @return (a + b) mod q for residues a, b. */
+    std::uint64_t add(std::uint64_t a, std::uint64_t b) const {
+        return a >= q_ - b ? a - (q_ - b) : a + b;
+    }
+
+    /** @return (a - b) mod q for residues a, b. */
+    std::uint64_t sub(std::uint64_t a, std::uint64_t b) const {
+        return a >= b ? a - b : a + (q_ - b);
+    }
+
+    /** @return (a * b) mod q for residues a, b. */
+    std::uint64_t mul(std::uint64_t a, std::uint64_t b) const {
+        if (word_barrett_) {
+            return reduceProduct(a * b);
+        }
+        return mulWide(a, b);
+    }
+
+    /**
+     * @brief Barrett reduction of a product of two residues.
+     *
+     * Requires hasWordBarrett() and x < q^2; everything stays in one
+     * 64-bit word, so callers can use it inside vectorized loops.
+     */
+    std::uint64_t reduceProduct(std::uint64_t x) const {
+        const std::uint64_t est = ((x >> (width_ - 1)) * mu_) >> (width_ + 1);
+        std::uint64_t r = x - est * q_;
+        r -= (r >= q_) ? q_ : 0;
+        r -= (r >= q_) ? q_ : 0;
+        return r;
+    }
+
+    /** @return base^exp mod q (square-and-multiply in Montgomery form when available). */
+    std::uint64_t pow(std::uint64_t base, std::uint64_t exp) const;
+
+    /** @return Shoup companion floor(w * 2^32 / q) of a residue w; requires q < 2^32. */
+    std::uint64_t shoup(std::uint64_t w) const { return (w << 32) / q_; }
+
+    /**
+     * @return a * w mod q for a < 2^32, given @p w_shoup = shoup(w).
+     */
+    std::uint64_t mulShoup(std::uint64_t a, std::uint64_t w, std::uint64_t w_shoup) const {
+        const std::uint64_t r = a * w - ((a * w_shoup) >> 32) * q_;
+        return r >= q_ ? r - q_ : r;
+    }
+
+    /** @return a * 2^32 mod q, the Montgomery form of a residue (requires hasMontgomery()). */
+    std::uint64_t toMontgomery(std::uint64_t a) const { return montgomeryReduce(a * r2_); }
+
+    /** @return a * 2^-32 mod q; maps Montgomery form back (requires hasMontgomery()). */
+    std::uint64_t fromMontgomery(std::uint64_t a) const { return montgomeryReduce(a); }
+
+    /** @return a * b * 2^-32 mod q for a, b < q (requires hasMontgomery()). */
+    std::uint64_t montgomeryMul(std::uint64_t a, std::uint64_t b) const {
+        return montgomeryReduce(a * b);
+    }
+
+private:
+    explicit Modulus(std::uint64_t q);
+
+    std::uint64_t q_;
+    unsigned bits_;
+    unsigned width_;             ///< Bit length of q (Barrett k).
+    std::uint64_t barrett64_;    ///< floor((2^64 - 1) / q)
+    bool word_barrett_;
+    std::uint64_t mu_;           ///< floor(4^k / q) for k = width_
+    bool montgomery_;
+    std::uint64_t q_inv_neg_;    ///< -q^{-1} mod 2^32
+    std::uint64_t r2_;           ///< 2^64 mod q
+    const SpecialPrimeReducer* special_;
+
+    /** @brief High 64 bits of a 64x64-bit product, from 32-bit halves. */
+    static std::uint64_t mulHigh(std::uint64_t a, std::uint64_t b) {
+        const std::uint64_t a_lo = a & 0xFFFFFFFFu, a_hi = a >> 32;
+        const std::uint64_t b_lo = b & 0xFFFFFFFFu, b_hi = b >> 32;
+        const std::uint64_t lo_lo = a_lo * b_lo;
+        const std::uint64_t hi_lo = a_hi * b_lo;
+        const std::uint64_t lo_hi = a_lo * b_hi;
+        const std::uint64_t cross = (lo_lo >> 32) + (hi_lo & 0xFFFFFFFFu) + lo_hi;
+        return a_hi * b_hi + (hi_lo >> 32) + (cross >> 32);
+    }
+
+    /** @brief (a * b) mod q for moduli too wide for reduceProduct(). */
+    std::uint64_t mulWide(std::uint64_t a, std::uint64_t b) const;
+
+    /** @brief REDC: t * 2^-32 mod q for t < q * 2^32. */
+    std::uint64_t montgomeryReduce(std::uint64_t t) const {
+        const std::uint64_t m = ((t & 0xFFFFFFFFu) * q_inv_neg_) & 0xFFFFFFFFu;
+        const std::uint64_t u = (t + m * q_) >> 32;
+        return u >= q_ ? u - q_ : u;
+    }
+};
+
+#endif // MODULUS_H
@@ -5,10 +5,43 @@
 #include <cstddef>
 #include <vector>
 #include <stdexcept>
+#include <string>
 
 #include <logging.h>
+#include <modulus.h>
 #include <polynomial.h>
 #include <ntt_tables.h>
+#include <special_prime.h>
+
+/**
+ * @brief Butterfly kernels available to the NTT.
+ */
+enum class NTTKernel {
+    /**
+     * @brief Radix-2 loop deriving twiddles on the fly with full reduction.
+     *
+     * Always available; serves as the reference implementation.
+     */
+    Reference,
+
+    /**
+     * @brief Precomputed per-layer twiddles with Shoup multiplication and
+     *        Harvey-style lazy reduction (values kept in [0, 4q)).
+     *
+     * The twist and the final n^{-1} scaling are folded into a single pass.
+     * Requires q < 2^30.
+     */
+    Lazy,
+
+    /**
+     * @brief Canonical butterflies using K-RED reduction for moduli of the
+     *        form q = c * 2^k + 1 (see SpecialPrimeReducer).
+     *
+     * Twiddles are pre-scaled by c^{-2} so every twiddle product is two
+     * shift-and-subtract steps. Only available when q has a usable form.
+     */
+    SpecialPrime,
+};
 
 /**
  * @brief Number Theoretic Transform for Z_q[x]/(x^n + 1).
@@ -24,15 +57,23 @@
  * an n‑th primitive root of unity @f$\omega = \psi^2@f$ and apply the
  * usual "twist" for negacyclic convolution:
  *
- *  - Forward transform multiplies inputs by @f$\psi^{2i+1}@f$.
- *  - Inverse transform multiplies by @f$\psi^{-(2i+1)}@f$ and @f$n^{-1}@f$.
+ *  - Forward transform multiplies inputs by @f$\psi^{i}@f$.
+ *  - Inverse transform multiplies by @f$\psi^{-i}@f$ and @f$n^{-1}@f$.
  *
+ * Several butterfly kernels (see NTTKernel) implement the same transform
+ * and produce bit-identical outputs, so NTT-domain data never depends on
+ * the kernel that produced it. Which kernel a default-constructed instance
+ * uses is looked up per (n, q) in a process-wide registry that the
+ * NTTAutotuner fills in.
  */
 class NTT {
 public:
     /**
      * @brief Construct an NTT instance.
      *
+     * The butterfly kernel is taken from the preferred-kernel registry
+     * (see setPreferredKernel()).
+     *
      * @param n          Transform size (must be a power of two).
      * @param modulus_q  Prime modulus.
      * @param negacyclic If true (default), configure for negacyclic
@@ -45,6 +86,65 @@ public:
      */
     NTT(std::size_t n, std::uint64_t modulus_q, bool negacyclic = true);
 
+    /**
+     * @brief Construct an NTT instance with an explicit butterfly kernel.
+     *
+     * @param n          Transform size (must be a power of two).
+     * @param modulus_q  Prime modulus.
+     * @param negacyclic See NTT(std::size_t, std::uint64_t, bool).
+     * @param kernel     Kernel to use.
+     *
+     * @throws std::invalid_argument if the parameters are unsupported or
+     *         @p kernel is not eligible for them (see isKernelSupported()).
+     */
+    NTT(std::size_t n, std::uint64_t modulus_q, bool negacyclic, NTTKernel kernel);
+
+    /**
+     * @brief Get a shared, lazily constructed instance for a ring.
+     *
+     * Instances are cached per (n, q, kernel) for the lifetime of the
+     * process, which avoids re-deriving twiddle tables on every
+     * polynomial product. The preferred kernel for (n, q) is used.
+     *
+     * @throws std::invalid_argument under the same conditions as the
+     *         constructor.
+     */
+    static const NTT& forRing(std::size_t n, std::uint64_t modulus_q);
+
+    /**
+     * @brief Bind an already resolved instance for its ring on this thread.
+     *
+     * forRing() takes a process-wide lock to look up the preferred kernel
+     * and the cached instance. Work that runs many operations in one ring
+     * (the items of a poly_batch call) resolves the instance once and
+     * binds it in each worker. While the scope is alive, forRing() for
+     * that (n, q) returns it on this thread without locking. Scopes nest
+     * and must be destroyed on the thread that created them.
+     */
+    class RingScope {
+    public:
+        /** @param ntt Instance to bind, typically from forRing(); must outlive the scope. */
+        explicit RingScope(const NTT& ntt);
+
+        ~RingScope();
+
+        RingScope(const RingScope&) = delete;
+        RingScope& operator=(const RingScope&) = delete;
+
+    private:
+        const NTT* previous_;
+    };
+
+    /**
+     * @brief Check whether precomputed tables exist for a ring.
+     *
+     * @return True if forRing(n, q) succeeds, i.e. products in this ring
+     *         use the NTT rather than the FFT or schoolbook fallbacks.
+     */
+    static bool hasTables(std::size_t n, std::uint64_t modulus_q) {
+        return ntt_tables::hasPsiTables(n, modulus_q);
+    }
+
     /**
      * @brief In‑place forward NTT on a coefficient vector.
      *
@@ -64,10 +164,82 @@ public:
     void inverse(std::vector<std::uint64_t>& a) const;
 
     /**
-     * @brief Convenience overloads operating directly on Polynomial.
+     * @brief In-place transforms on 32-bit words.
+     *
+     * Same results as the 64-bit overloads with half the working set; used
+     * for polynomials with 16- and 32-bit coefficients. Every kernel keeps
+     * its intermediate values below 2^32 (the lazy kernel requires
+     * q < 2^30), so no widening is needed.
+     *
+     * @throws std::invalid_argument if a.size() != n or q > 2^32.
+     */
+    void forward(std::vector<std::uint32_t>& a) const;
+    void inverse(std::vector<std::uint32_t>& a) const;
+
+    /**
+     * @brief In-place transforms on caller-owned buffers.
+     *
+     * Let fixed-size and externally stored polynomials be transformed
+     * without copying into a std::vector.
+     *
+     * @param a     Pointer to @p count words.
+     * @param count Number of words; must equal n.
+     *
+     * @throws std::invalid_argument if count != n, or for 32-bit words
+     *         if q > 2^32.
      */
-    void forward(Polynomial& poly) const;
-    void inverse(Polynomial& poly) const;
+    void forward(std::uint64_t* a, std::size_t count) const;
+    void inverse(std::uint64_t* a, std::size_t count) const;
+    void forward(std::uint32_t* a, std::size_t count) const;
+    void inverse(std::uint32_t* a, std::size_t count) const;
+
+    /**
+     * @brief Convenience overloads operating directly on a polynomial.
+     *
+     * These transform the polynomial's coefficients as plain values and do
+     * not change its PolyDomain tag; use BasicPolynomial::toNTT() and
+     * toCoefficients() for tracked conversions. Instantiated for
+     * Polynomial16, Polynomial32 and Polynomial.
+     */
+    template<typename Coeff>
+    void forward(BasicPolynomial<Coeff>& poly) const;
+    template<typename Coeff>
+    void inverse(BasicPolynomial<Coeff>& poly) const;
+
+    /**
+     * @brief Out-of-place transforms reading from a read-only view.
+     *
+     * The viewed values are copied to @p out (which may alias them) and
+     * transformed there, so external buffers can be transformed without
+     * building a polynomial first. Instantiated for 16-, 32- and 64-bit
+     * coefficients.
+     *
+     * @param in  Values of this NTT's ring; forward() requires the
+     *            coefficient domain and inverse() the NTT domain.
+     * @param out Destination for n values.
+     *
+     * @throws std::invalid_argument if the ring or the domain of @p in
+     *         does not match.
+     */
+    template<typename Coeff>
+    void forward(const BasicPolynomialView<Coeff>& in, Coeff* out) const;
+    template<typename Coeff>
+    void inverse(const BasicPolynomialView<Coeff>& in, Coeff* out) const;
+
+    /**
+     * @brief Invert every entry of a vector in place modulo q.
+     *
+     * Uses Montgomery's batch inversion trick: the running prefix products
+     * are inverted with a single extended-Euclid call and then unwound, so
+     * inverting k values costs one scalar inversion plus about 3k modular
+     * multiplications. Applied to NTT-domain vectors this inverts ring
+     * elements pointwise.
+     *
+     * @param values Entries in [0, q); replaced by their inverses.
+     *
+     * @throws std::invalid_argument if any entry is zero modulo q.
+     */
+    void batchInvert(std::vector<std::uint64_t>& values) const;
 
     /** @return Transform size n. */
     std::size_t size() const { return n_; }
@@ -78,10 +250,56 @@ public:
     /** @return True if configured for negacyclic convolution. */
     bool isNegacyclic() const { return negacyclic_; }
 
+    /** @return Butterfly kernel used by this instance. */
+    NTTKernel kernel() const { return kernel_; }
+
+    /**
+     * @brief Check whether a kernel can run for the given parameters.
+     *
+     * Eligibility depends only on (n, q) and the host CPU, not on whether
+     * precomputed tables exist.
+     */
+    static bool isKernelSupported(NTTKernel kernel, std::size_t n, std::uint64_t modulus_q);
+
+    /** @return All kernels known to this build, in declaration order. */
+    static std::vector<NTTKernel> allKernels();
+
+    /** @return Stable lower-case name of a kernel (e.g. "lazy"). */
+    static const char* kernelName(NTTKernel kernel);
+
+    /**
+     * @brief Parse a name produced by kernelName().
+     *
+     * @throws std::invalid_argument if @p name is unknown.
+     */
+    static NTTKernel kernelFromName(const std::string& name);
+
+    /**
+     * @brief Select the kernel used for (n, q) by subsequently constructed
+     *        instances and by forRing().
+     *
+     * @throws std::invalid_argument if @p kernel is not eligible for (n, q).
+     */
+    static void setPreferredKernel(std::size_t n, std::uint64_t modulus_q, NTTKernel kernel);
+
+    /**
+     * @brief Kernel currently preferred for (n, q).
+     *
+     * Falls back to NTTKernel::Lazy when eligible and to
+     * NTTKernel::Reference otherwise. NTTKernel::SpecialPrime is only
+     * used when registered (e.g. by NTTAutotuner) or requested explicitly.
+     */
+    static NTTKernel preferredKernel(std::size_t n, std::uint64_t modulus_q);
+
+    /** @brief Forget all registered kernel preferences. */
+    static void clearPreferredKernels();
+
 private:
     std::size_t n_;
     std::uint64_t q_;
+    const Modulus* modulus_;  ///< interned reduction constants for q_
     bool negacyclic_;
+    NTTKernel kernel_;
 
     // For the underlying length‑n NTT we use an n‑th primitive root omega.
     std::uint64_t omega_;      ///< primitive n‑th root of unity
@@ -93,11 +311,25 @@ private:
     std::uint64_t psi_;
     std::uint64_t psi_inv_;
 
-    // Precomputed negacyclic twist tables (kept for offline verification
-    // and potential future optimizations). The current implementation
-    // derives psi^i and psi^{-i} on the fly from psi_ and psi_inv_.
-    const std::uint64_t* psi_powers_;      ///< psi^{2i+1}
-    const std::uint64_t* psi_powers_inv_;  ///< psi^{-(2i+1)}
+    // Lazy-kernel tables from ntt_tables.h, stored as twiddle_t in the
+    // order the butterflies read them (see ntt_tables::PsiTables), plus
+    // per-instance Shoup companions floor(w * 2^32 / q).
+    const ntt_tables::twiddle_t* twist_;         ///< psi^i
+    const ntt_tables::twiddle_t* untwist_;       ///< psi^{-i} * n^{-1}
+    const ntt_tables::twiddle_t* fwd_twiddles_;  ///< forward layer twiddles
+    const ntt_tables::twiddle_t* inv_twiddles_;  ///< inverse layer twiddles
+    std::vector<std::uint32_t> twist_shoup_;
+    std::vector<std::uint32_t> untwist_shoup_;
+    std::vector<std::uint32_t> fwd_twiddles_shoup_;
+    std::vector<std::uint32_t> inv_twiddles_shoup_;
+
+    // SpecialPrime-kernel state: the interned reducer and copies of the
+    // four tables pre-scaled by c^{-2}.
+    const SpecialPrimeReducer* reducer_;
+    std::vector<ntt_tables::twiddle_t> twist_kred_;
+    std::vector<ntt_tables::twiddle_t> untwist_kred_;
+    std::vector<ntt_tables::twiddle_t> fwd_twiddles_kred_;
+    std::vector<ntt_tables::twiddle_t> inv_twiddles_kred_;
 
     // Utility helpers
     static bool isPowerOfTwo(std::size_t n);
@@ -112,32 +344,51 @@ private:
         return (a >= b) ? (a - b) : (a + m - b);
     }
 
-    static std::uint64_t modMul(std::uint64_t a, std::uint64_t b, std::uint64_t m) {
-        // We intentionally avoid non‑standard integer types like __int128
-        // to keep this project strictly ISO C++ compliant.
-        //
-        // The current parameter sets use small moduli (q < 2^16), so the
-        // plain 64‑bit multiplication cannot overflow a 128‑bit intermediate
-        // and is safe here. If larger q are ever introduced, this routine
-        // should be upgraded to use Montgomery or Barrett reduction.
-        return (a * b) % m;
-    }
+    static std::uint64_t modInverse(std::uint64_t a, std::uint64_t m);
 
-    static std::uint64_t modPow(std::uint64_t base, std::uint64_t exp, std::uint64_t m) {
-        std::uint64_t res = 1;
-        while (exp) {
-            if (exp & 1) res = modMul(res, base, m);
-            base = modMul(base, base, m);
-            exp >>= 1;
-        }
-        return res;
+    /**
+     * Shoup multiplication a * w mod m for a < 2^32, returning a value in
+     * [0, 2m) without any division.
+     */
+    static std::uint64_t shoupMulLazy(std::uint64_t a, std::uint64_t w,
+                                      std::uint64_t w_shoup, std::uint64_t m) {
+        std::uint64_t quot = (a * w_shoup) >> 32;
+        return a * w - quot * m;
     }
 
-    static std::uint64_t modInverse(std::uint64_t a, std::uint64_t m);
+    void initShoupCompanions();
+
+    void initSpecialPrimeTables();
+
+    // Kernels are templated on the storage word (uint32_t or uint64_t);
+    // arithmetic is always carried out in 64 bits.
+    template<typename Word>
+    void forwardWords(Word* a) const;
+    template<typename Word>
+    void inverseWords(Word* a) const;
+
+    template<typename Word>
+    void bitReverse(Word* a) const;
+
+    template<typename Word>
+    void ntt(Word* a, bool inverse) const;
+
+    template<typename Word>
+    void nttLazy(Word* a, const ntt_tables::twiddle_t* twiddles,
+                 const std::uint32_t* twiddles_shoup) const;
+
+    template<typename Word>
+    void forwardLazy(Word* a) const;
+    template<typename Word>
+    void inverseLazy(Word* a) const;
 
-    void bitReverse(std::vector<std::uint64_t>& a) const;
+    template<typename Word>
+    void nttSpecialPrime(Word* a, const ntt_tables::twiddle_t* twiddles) const;
 
-    void ntt(std::vector<std::uint64_t>& a, bool inverse) const;
+    template<typename Word>
+    void forwardSpecialPrime(Word* a) const;
+    template<typename Word>
+    void inverseSpecialPrime(Word* a) const;
 };
  
 #endif // NTT_H
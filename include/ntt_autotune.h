@@ -0,0 +1,112 @@
+#ifndef NTT_AUTOTUNE_H
+#define NTT_AUTOTUNE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <kem.h>
+#include <ntt.h>
+
+/**
+ * @brief Outcome of tuning the NTT kernel for one (n, q) ring.
+ */
+struct NTTTuningResult {
+    /** Ring dimension. */
+    std::size_t n;
+    /** Coefficient modulus. */
+    std::uint64_t q;
+    /** Kernel selected for this ring. */
+    NTTKernel kernel;
+    /** Best observed time of one forward + inverse pair in nanoseconds. */
+    double nanoseconds;
+    /** True if the selection was read from the cache file. */
+    bool from_cache;
+};
+
+/**
+ * @brief Startup autotuner choosing the fastest NTT kernel per ring.
+ *
+ * For every registered SecurityLevel the tuner micro-benchmarks each
+ * kernel that is eligible for its (n, q) on this host, checks that the
+ * kernel round-trips correctly, and registers the winner with
+ * NTT::setPreferredKernel(). Subsequent NTT instances (including the ones
+ * used by Polynomial multiplication) then use that kernel.
+ *
+ * When a cache path is given, selections are persisted as a small text
+ * file tagged with a host signature, so later process starts on the same
+ * host skip the benchmarks. A cache written on a host with a different
+ * signature, or naming kernels unknown to this build, is ignored.
+ *
+ * Typical use at program start:
+ * @code
+ * NTTAutotuner tuner("/var/cache/rlwe/ntt.tune");
+ * tuner.tuneAll();
+ * @endcode
+ */
+class NTTAutotuner {
+public:
+    /**
+     * @brief Create a tuner.
+     *
+     * @param cache_path File used to persist selections. Empty disables
+     *                   persistence.
+     */
+    explicit NTTAutotuner(std::string cache_path = "");
+
+    /**
+     * @brief Tune every ring used by registeredLevels().
+     *
+     * Rings already present in the cache are not benchmarked again. The
+     * cache file is rewritten if anything new was measured.
+     *
+     * @return One result per distinct (n, q).
+     */
+    std::vector<NTTTuningResult> tuneAll();
+
+    /**
+     * @brief Tune a single ring and register the selected kernel.
+     *
+     * @param n Ring dimension.
+     * @param q Coefficient modulus.
+     * @return Selected kernel and its timing.
+     *
+     * @throws std::invalid_argument If no kernel can be constructed for
+     *         (n, q), e.g. because no NTT tables exist.
+     */
+    NTTTuningResult tune(std::size_t n, std::uint64_t q);
+
+    /**
+     * @brief Set how many timed batches are run per kernel (default 5).
+     *
+     * The best batch is kept, which filters out scheduling noise.
+     */
+    void setRepetitions(int repetitions);
+
+    /** @return Security levels whose rings are tuned by tuneAll(). */
+    static std::vector<SecurityLevel> registeredLevels();
+
+    /**
+     * @brief Describe the host for cache validation.
+     *
+     * Combines the target architecture with the SIMD extensions reported
+     * by the CPU at runtime.
+     */
+    static std::string hostSignature();
+
+private:
+    std::string cache_path_;
+    int repetitions_;
+    std::vector<NTTTuningResult> results_;
+
+    double benchmark(const NTT& ntt) const;
+
+    const NTTTuningResult* findResult(std::size_t n, std::uint64_t q) const;
+
+    void loadCache();
+
+    void saveCache() const;
+};
+
+#endif // NTT_AUTOTUNE_H
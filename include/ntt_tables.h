@@ -4,46 +4,71 @@
 #include <cstddef>
 #include <cstdint>
 
+// Generated by tools/tools_ntt_root_finder.cpp; do not edit by hand.
+
 namespace ntt_tables {
 
+/** Storage type of table entries; every supported q is below 2^16. */
+using twiddle_t = std::uint16_t;
+
+/**
+ * @brief Precomputed constants for one (n, q) ring.
+ *
+ * All arrays are laid out in the order the butterflies consume them.
+ * The layer tables hold n - 1 entries: the layer whose butterflies
+ * span 2h elements uses (omega^{n/2h})^j for j < h, stored contiguously
+ * from offset h - 1, with omega = psi^2.
+ */
 struct PsiTables {
     std::size_t n;
     std::uint64_t q;
     std::uint64_t psi;
     std::uint64_t psi_inv;
-    const std::uint64_t* twist;
-    const std::uint64_t* twist_inv;
+    const twiddle_t* twist;       ///< psi^i, i < n
+    const twiddle_t* untwist;     ///< psi^{-i} * n^{-1}, i < n
+    const twiddle_t* fwd_layers;  ///< forward layer twiddles
+    const twiddle_t* inv_layers;  ///< inverse layer twiddles
 };
 
 inline constexpr std::uint64_t psi_8_7681 = 7154ULL;
 inline constexpr std::uint64_t psi_inv_8_7681 = 7098ULL;
-inline constexpr std::uint64_t twist_8_7681[8] = {7154ULL,5953ULL,849ULL,583ULL,527ULL,1728ULL,6832ULL,7098ULL};
-inline constexpr std::uint64_t twist_inv_8_7681[8] = {7098ULL,6832ULL,1728ULL,527ULL,583ULL,849ULL,5953ULL,7154ULL};
-inline constexpr PsiTables tables_8_7681{8, 7681, psi_8_7681, psi_inv_8_7681, twist_8_7681, twist_inv_8_7681};
+inline constexpr twiddle_t twist_8_7681[8] = {1,7154,1213,5953,4298,849,5756,583};
+inline constexpr twiddle_t untwist_8_7681[8] = {6721,6648,3121,854,1383,216,4649,1026};
+inline constexpr twiddle_t fwd_layers_8_7681[7] = {1,1,4298,1,1213,4298,5756};
+inline constexpr twiddle_t inv_layers_8_7681[7] = {1,1,3383,1,1925,3383,6468};
+inline constexpr PsiTables tables_8_7681{8, 7681, psi_8_7681, psi_inv_8_7681, twist_8_7681, untwist_8_7681, fwd_layers_8_7681, inv_layers_8_7681};
 
 inline constexpr std::uint64_t psi_32_7681 = 2645ULL;
 inline constexpr std::uint64_t psi_inv_32_7681 = 5413ULL;
-inline constexpr std::uint64_t twist_32_7681[32] = {2645ULL,4681ULL,4027ULL,6395ULL,5408ULL,1794ULL,7316ULL,7006ULL,330ULL,2399ULL,2753ULL,3092ULL,878ULL,6569ULL,5835ULL,2268ULL,5036ULL,3000ULL,3654ULL,1286ULL,2273ULL,5887ULL,365ULL,675ULL,7351ULL,5282ULL,4928ULL,4589ULL,6803ULL,1112ULL,1846ULL,5413ULL};
-inline constexpr std::uint64_t twist_inv_32_7681[32] = {5413ULL,1846ULL,1112ULL,6803ULL,4589ULL,4928ULL,5282ULL,7351ULL,675ULL,365ULL,5887ULL,2273ULL,1286ULL,3654ULL,3000ULL,5036ULL,2268ULL,5835ULL,6569ULL,878ULL,3092ULL,2753ULL,2399ULL,330ULL,7006ULL,7316ULL,1794ULL,5408ULL,6395ULL,4027ULL,4681ULL,2645ULL};
-inline constexpr PsiTables tables_32_7681{32, 7681, psi_32_7681, psi_inv_32_7681, twist_32_7681, twist_inv_32_7681};
+inline constexpr twiddle_t twist_32_7681[32] = {1,2645,6315,4681,7154,4027,5549,6395,1213,5408,2138,1794,5953,7316,2381,7006,4298,330,4897,2399,849,2753,97,3092,5756,878,2648,6569,583,5835,2446,2268};
+inline constexpr twiddle_t untwist_32_7681[32] = {7441,6650,3284,2458,1662,1955,5678,3333,6541,4704,237,154,4054,7366,87,2390,2266,6982,3046,4572,54,424,6174,7512,6923,6281,2947,6355,4097,2014,2443,4958};
+inline constexpr twiddle_t fwd_layers_32_7681[31] = {1,1,4298,1,1213,4298,5756,1,7154,1213,5953,4298,849,5756,583,1,6315,7154,5549,1213,2138,5953,2381,4298,4897,849,97,5756,2648,583,2446};
+inline constexpr twiddle_t inv_layers_32_7681[31] = {1,1,3383,1,1925,3383,6468,1,7098,1925,6832,3383,1728,6468,527,1,5235,7098,5033,1925,7584,6832,2784,3383,5300,1728,5543,6468,2132,527,1366};
+inline constexpr PsiTables tables_32_7681{32, 7681, psi_32_7681, psi_inv_32_7681, twist_32_7681, untwist_32_7681, fwd_layers_32_7681, inv_layers_32_7681};
 
 inline constexpr std::uint64_t psi_256_7681 = 4055ULL;
 inline constexpr std::uint64_t psi_inv_256_7681 = 2811ULL;
-inline constexpr std::uint64_t twist_256_7681[256] = {4055ULL,1994ULL,6415ULL,7568ULL,2799ULL,4964ULL,346ULL,674ULL,6552ULL,2951ULL,1131ULL,738ULL,1704ULL,1499ULL,3586ULL,1036ULL,6014ULL,1459ULL,6616ULL,5784ULL,7360ULL,3193ULL,2002ULL,5809ULL,3546ULL,4066ULL,3081ULL,2805ULL,669ULL,1170ULL,7385ULL,7060ULL,2875ULL,6888ULL,542ULL,1189ULL,185ULL,7109ULL,4924ULL,3376ULL,5422ULL,217ULL,4685ULL,4198ULL,763ULL,5571ULL,2372ULL,4665ULL,5713ULL,3137ULL,6244ULL,3239ULL,2358ULL,1885ULL,1230ULL,2840ULL,7619ULL,856ULL,4287ULL,7463ULL,4992ULL,5906ULL,1959ULL,7146ULL,201ULL,5897ULL,4561ULL,5910ULL,1656ULL,5135ULL,4675ULL,1115ULL,1950ULL,2067ULL,6646ULL,7352ULL,3799ULL,6024ULL,4542ULL,5429ULL,1607ULL,3086ULL,506ULL,3916ULL,2922ULL,5248ULL,1876ULL,3832ULL,1604ULL,1393ULL,94ULL,4401ULL,2668ULL,5286ULL,2838ULL,3930ULL,5702ULL,2050ULL,2173ULL,2457ULL,3987ULL,7145ULL,2197ULL,639ULL,7283ULL,3265ULL,4229ULL,335ULL,7268ULL,2481ULL,2169ULL,2760ULL,5998ULL,2671ULL,6979ULL,3250ULL,3445ULL,5956ULL,2012ULL,1211ULL,2359ULL,7570ULL,6488ULL,118ULL,2583ULL,5964ULL,1406ULL,4870ULL,3626ULL,5687ULL,1266ULL,113ULL,4882ULL,2717ULL,7335ULL,7007ULL,1129ULL,4730ULL,6550ULL,6943ULL,5977ULL,6182ULL,4095ULL,6645ULL,1667ULL,6222ULL,1065ULL,1897ULL,321ULL,4488ULL,5679ULL,1872ULL,4135ULL,3615ULL,4600ULL,4876ULL,7012ULL,6511ULL,296ULL,621ULL,4806ULL,793ULL,7139ULL,6492ULL,7496ULL,572ULL,2757ULL,4305ULL,2259ULL,7464ULL,2996ULL,3483ULL,6918ULL,2110ULL,5309ULL,3016ULL,1968ULL,4544ULL,1437ULL,4442ULL,5323ULL,5796ULL,6451ULL,4841ULL,62ULL,6825ULL,3394ULL,218ULL,2689ULL,1775ULL,5722ULL,535ULL,7480ULL,1784ULL,3120ULL,1771ULL,6025ULL,2546ULL,3006ULL,6566ULL,5731ULL,5614ULL,1035ULL,329ULL,3882ULL,1657ULL,3139ULL,2252ULL,6074ULL,4595ULL,7175ULL,3765ULL,4759ULL,2433ULL,5805ULL,3849ULL,6077ULL,6288ULL,7587ULL,3280ULL,5013ULL,2395ULL,4843ULL,3751ULL,1979ULL,5631ULL,5508ULL,5224ULL,3694ULL,536ULL,5484ULL,7042ULL,398ULL,4416ULL,3452ULL,7346ULL,413ULL,5200ULL,5512ULL,4921ULL,1683ULL,5010ULL,702ULL,4431ULL,4236ULL,1725ULL,5669ULL,6470ULL,5322ULL,111ULL,1193ULL,7563ULL,5098ULL,1717ULL,6275ULL,2811ULL};
-inline constexpr std::uint64_t twist_inv_256_7681[256] = {2811ULL,6275ULL,1717ULL,5098ULL,7563ULL,1193ULL,111ULL,5322ULL,6470ULL,5669ULL,1725ULL,4236ULL,4431ULL,702ULL,5010ULL,1683ULL,4921ULL,5512ULL,5200ULL,413ULL,7346ULL,3452ULL,4416ULL,398ULL,7042ULL,5484ULL,536ULL,3694ULL,5224ULL,5508ULL,5631ULL,1979ULL,3751ULL,4843ULL,2395ULL,5013ULL,3280ULL,7587ULL,6288ULL,6077ULL,3849ULL,5805ULL,2433ULL,4759ULL,3765ULL,7175ULL,4595ULL,6074ULL,2252ULL,3139ULL,1657ULL,3882ULL,329ULL,1035ULL,5614ULL,5731ULL,6566ULL,3006ULL,2546ULL,6025ULL,1771ULL,3120ULL,1784ULL,7480ULL,535ULL,5722ULL,1775ULL,2689ULL,218ULL,3394ULL,6825ULL,62ULL,4841ULL,6451ULL,5796ULL,5323ULL,4442ULL,1437ULL,4544ULL,1968ULL,3016ULL,5309ULL,2110ULL,6918ULL,3483ULL,2996ULL,7464ULL,2259ULL,4305ULL,2757ULL,572ULL,7496ULL,6492ULL,7139ULL,793ULL,4806ULL,621ULL,296ULL,6511ULL,7012ULL,4876ULL,4600ULL,3615ULL,4135ULL,1872ULL,5679ULL,4488ULL,321ULL,1897ULL,1065ULL,6222ULL,1667ULL,6645ULL,4095ULL,6182ULL,5977ULL,6943ULL,6550ULL,4730ULL,1129ULL,7007ULL,7335ULL,2717ULL,4882ULL,113ULL,1266ULL,5687ULL,3626ULL,4870ULL,1406ULL,5964ULL,2583ULL,118ULL,6488ULL,7570ULL,2359ULL,1211ULL,2012ULL,5956ULL,3445ULL,3250ULL,6979ULL,2671ULL,5998ULL,2760ULL,2169ULL,2481ULL,7268ULL,335ULL,4229ULL,3265ULL,7283ULL,639ULL,2197ULL,7145ULL,3987ULL,2457ULL,2173ULL,2050ULL,5702ULL,3930ULL,2838ULL,5286ULL,2668ULL,4401ULL,94ULL,1393ULL,1604ULL,3832ULL,1876ULL,5248ULL,2922ULL,3916ULL,506ULL,3086ULL,1607ULL,5429ULL,4542ULL,6024ULL,3799ULL,7352ULL,6646ULL,2067ULL,1950ULL,1115ULL,4675ULL,5135ULL,1656ULL,5910ULL,4561ULL,5897ULL,201ULL,7146ULL,1959ULL,5906ULL,4992ULL,7463ULL,4287ULL,856ULL,7619ULL,2840ULL,1230ULL,1885ULL,2358ULL,3239ULL,6244ULL,3137ULL,5713ULL,4665ULL,2372ULL,5571ULL,763ULL,4198ULL,4685ULL,217ULL,5422ULL,3376ULL,4924ULL,7109ULL,185ULL,1189ULL,542ULL,6888ULL,2875ULL,7060ULL,7385ULL,1170ULL,669ULL,2805ULL,3081ULL,4066ULL,3546ULL,5809ULL,2002ULL,3193ULL,7360ULL,5784ULL,6616ULL,1459ULL,6014ULL,1036ULL,3586ULL,1499ULL,1704ULL,738ULL,1131ULL,2951ULL,6552ULL,674ULL,346ULL,4964ULL,2799ULL,7568ULL,6415ULL,1994ULL,4055ULL};
-inline constexpr PsiTables tables_256_7681{256, 7681, psi_256_7681, psi_inv_256_7681, twist_256_7681, twist_inv_256_7681};
+inline constexpr twiddle_t twist_256_7681[256] = {1,4055,5685,1994,5258,6415,4959,7568,2645,2799,5108,4964,4800,346,5088,674,6315,6552,7462,2951,6988,1131,648,738,4681,1704,4501,1499,2774,3586,1097,1036,7154,6014,7276,1459,1875,6616,5828,5784,4027,7360,4115,3193,5130,2002,6974,5809,5549,3546,198,4066,4204,3081,4149,2805,6395,669,1402,1170,5173,7385,5637,7060,1213,2875,6048,6888,2724,542,1044,1189,5408,185,5118,7109,202,4924,3901,3376,2138,5422,3188,217,4301,4685,2562,4198,1794,763,6203,5571,584,2372,1848,4665,5953,5713,319,3137,799,6244,2844,3239,7316,2358,6526,1885,1080,1230,2681,2840,2381,7619,2063,856,6949,4287,1682,7463,7006,4992,3125,5906,7153,1959,1591,7146,4298,201,869,5897,1382,4561,6688,5910,330,1656,1886,5135,6915,4675,417,1115,4897,1950,3501,2067,1714,6646,4582,7352,2399,3799,4540,6024,1740,4542,6453,5429,849,1607,2897,3086,1381,506,1003,3916,2753,2922,4608,5248,4270,1876,2990,3832,97,1604,6094,1393,3080,94,4801,4401,3092,2668,3892,5286,4740,2838,1952,3930,5756,5702,1800,2050,1908,2173,1408,2457,878,3987,6461,7145,243,2197,6556,639,2648,7283,6801,3265,5212,4229,4603,335,6569,7268,7424,2481,6026,2169,550,2760,583,5998,3844,2671,695,6979,3041,3250,5835,3445,5417,5956,2516,2012,1438,1211,2446,2359,2900,7570,3074,6488,1415,118,2268,2583,4862,5964,4232,1406,2028,4870};
+inline constexpr twiddle_t untwist_256_7681[256] = {7651,161,7073,3775,4064,2257,7602,680,6592,3540,4045,2615,48,4351,2509,1641,4251,5606,4735,6593,6351,2017,1209,3497,6068,5328,6739,1983,5488,3320,105,3277,2128,5990,1138,3622,4117,5301,7652,2972,5045,2369,7513,3974,2740,5778,4324,3422,2630,3808,4655,4462,7290,6963,1805,4395,3297,4581,3835,3742,3473,52,233,2078,3698,2685,4793,649,3942,4960,1545,3230,588,1453,5772,2820,228,3385,6157,2034,2910,7426,5209,2513,5204,3820,7663,3169,5780,2265,7047,7499,3025,408,2419,2124,2427,1569,1565,5683,6114,4057,5623,6436,2841,5492,6883,7355,5334,562,5177,4733,971,2726,4829,1992,63,430,2813,3594,2219,637,934,6253,3055,247,3027,6030,6044,6993,1644,5003,7203,517,1578,3821,2793,1141,4374,5714,1083,2637,442,5821,2301,709,3620,6176,1676,2783,3755,1611,4412,4998,829,2976,927,1938,1889,2408,1927,1692,1673,2031,2158,5829,1746,7528,53,3044,50,2292,6134,6510,3468,1359,2692,1427,1815,1781,6060,5883,7601,5550,939,4946,596,898,4910,6934,4777,1759,5666,4413,128,6482,1570,4376,3655,4708,7506,7340,1574,258,3224,6765,5940,6527,5169,5288,1833,6293,280,3618,554,5732,5595,4538,5858,6455,2483,5365,3212,3757,7233,356,2186,46,6410,6565,4453,5034,2172,6778,4078,3206,2253,4039,1111,4535,5106,4858,6701,2699,5742,2981,7301,7160,2540,4291,2831,425,4120,6053,1568,6435};
+inline constexpr twiddle_t fwd_layers_256_7681[255] = {1,1,4298,1,1213,4298,5756,1,7154,1213,5953,4298,849,5756,583,1,6315,7154,5549,1213,2138,5953,2381,4298,4897,849,97,5756,2648,583,2446,1,2645,6315,4681,7154,4027,5549,6395,1213,5408,2138,1794,5953,7316,2381,7006,4298,330,4897,2399,849,2753,97,3092,5756,878,2648,6569,583,5835,2446,2268,1,5258,2645,4800,6315,6988,4681,2774,7154,1875,4027,5130,5549,4204,6395,5173,1213,2724,5408,202,2138,4301,1794,584,5953,799,7316,1080,2381,6949,7006,7153,4298,1382,330,6915,4897,1714,2399,1740,849,1381,2753,4270,97,3080,3092,4740,5756,1908,878,243,2648,5212,6569,6026,583,695,5835,2516,2446,3074,2268,4232,1,5685,5258,4959,2645,5108,4800,5088,6315,7462,6988,648,4681,4501,2774,1097,7154,7276,1875,5828,4027,4115,5130,6974,5549,198,4204,4149,6395,1402,5173,5637,1213,6048,2724,1044,5408,5118,202,3901,2138,3188,4301,2562,1794,6203,584,1848,5953,319,799,2844,7316,6526,1080,2681,2381,2063,6949,1682,7006,3125,7153,1591,4298,869,1382,6688,330,1886,6915,417,4897,3501,1714,4582,2399,4540,1740,6453,849,2897,1381,1003,2753,4608,4270,2990,97,6094,3080,4801,3092,3892,4740,1952,5756,1800,1908,1408,878,6461,243,6556,2648,6801,5212,4603,6569,7424,6026,550,583,3844,695,3041,5835,5417,2516,1438,2446,2900,3074,1415,2268,4862,4232,2028};
+inline constexpr twiddle_t inv_layers_256_7681[255] = {1,1,3383,1,1925,3383,6468,1,7098,1925,6832,3383,1728,6468,527,1,5235,7098,5033,1925,7584,6832,2784,3383,5300,1728,5543,6468,2132,527,1366,1,5413,5235,1846,7098,1112,5033,6803,1925,4589,7584,4928,6832,5282,2784,7351,3383,675,5300,365,1728,5887,5543,2273,6468,1286,2132,3654,527,3000,1366,5036,1,3449,5413,4607,5235,5165,1846,6986,7098,1655,1112,2469,5033,7438,6803,5773,1925,2941,4589,4601,7584,3411,4928,6300,6832,5941,5282,5967,2784,766,7351,6299,3383,528,675,732,5300,6601,365,6882,1728,7097,5887,3380,5543,7479,2273,4957,6468,2508,1286,3477,2132,2551,3654,5806,527,4907,3000,693,1366,2881,5036,2423,1,5653,3449,2819,5413,6266,4607,4781,5235,6243,5165,2264,1846,4640,6986,3837,7098,7131,1655,257,1112,3078,2469,880,5033,1125,7438,1220,6803,6273,5773,5881,1925,5729,2941,3789,4589,2880,4601,1587,7584,4691,3411,3073,4928,6678,6300,4784,6832,1228,5941,3141,5282,3099,5967,4180,2784,7264,766,5795,7351,993,6299,6812,3383,6090,528,4556,675,5999,732,5618,5300,5000,6601,1155,365,4837,6882,7362,1728,5833,7097,1478,5887,5119,3380,4493,5543,3780,7479,2563,2273,6637,4957,1633,6468,2044,2508,6279,1286,3532,3477,7483,2132,707,2551,3566,3654,1853,5806,405,527,6584,4907,3180,3000,7033,693,219,1366,2593,2881,2573,5036,2722,2423,1996};
+inline constexpr PsiTables tables_256_7681{256, 7681, psi_256_7681, psi_inv_256_7681, twist_256_7681, untwist_256_7681, fwd_layers_256_7681, inv_layers_256_7681};
 
 inline constexpr std::uint64_t psi_512_12289 = 10302ULL;
 inline constexpr std::uint64_t psi_inv_512_12289 = 8974ULL;
-inline constexpr std::uint64_t twist_512_12289[512] = {10302ULL,3150ULL,6281ULL,9407ULL,7822ULL,1404ULL,5468ULL,10232ULL,10930ULL,64ULL,8687ULL,5333ULL,5925ULL,3329ULL,431ULL,3009ULL,6152ULL,922ULL,1105ULL,8855ULL,11239ULL,6099ULL,5057ULL,1489ULL,11821ULL,6370ULL,4782ULL,453ULL,4075ULL,5297ULL,6415ULL,10314ULL,7083ULL,8049ULL,11286ULL,6142ULL,3789ULL,3728ULL,5241ULL,350ULL,10256ULL,6507ULL,3600ULL,156ULL,1973ULL,10695ULL,12138ULL,2738ULL,6427ULL,1958ULL,8851ULL,9928ULL,9606ULL,8527ULL,2049ULL,11026ULL,6950ULL,10542ULL,8076ULL,4774ULL,10120ULL,11089ULL,12237ULL,7535ULL,8724ULL,8243ULL,7280ULL,1954ULL,7540ULL,1146ULL,787ULL,9087ULL,1254ULL,11606ULL,421ULL,5876ULL,8775ULL,9597ULL,2505ULL,723ULL,400ULL,8210ULL,5681ULL,9381ULL,5445ULL,5766ULL,3445ULL,1583ULL,11907ULL,3834ULL,9260ULL,11871ULL,4324ULL,3956ULL,6234ULL,9364ULL,9090ULL,11454ULL,12048ULL,3963ULL,5456ULL,6299ULL,9162ULL,10474ULL,10367ULL,2948ULL,7665ULL,8320ULL,11011ULL,5106ULL,8332ULL,2655ULL,6874ULL,10211ULL,975ULL,9259ULL,8471ULL,8273ULL,10968ULL,6374ULL,6093ULL,9235ULL,605ULL,4737ULL,7210ULL,9734ULL,1323ULL,426ULL,10587ULL,1319ULL,11404ULL,1805ULL,4789ULL,11964ULL,1010ULL,5369ULL,5435ULL,8633ULL,6068ULL,10258ULL,1018ULL,7991ULL,10710ULL,1693ULL,4948ULL,11848ULL,12147ULL,8760ULL,7753ULL,295ULL,7591ULL,2500ULL,8301ULL,7856ULL,6403ULL,6381ULL,5315ULL,6170ULL,677ULL,3757ULL,5529ULL,8719ULL,3532ULL,2447ULL,147ULL,8240ULL,9369ULL,1512ULL,3998ULL,1566ULL,3263ULL,9522ULL,5574ULL,1962ULL,10162ULL,6421ULL,6136ULL,7967ULL,2844ULL,10446ULL,1190ULL,2919ULL,7377ULL,12240ULL,5446ULL,9166ULL,11785ULL,6860ULL,11767ULL,7105ULL,9115ULL,10431ULL,11635ULL,709ULL,1956ULL,2051ULL,5537ULL,11341ULL,8807ULL,7796ULL,11316ULL,9830ULL,8209ULL,2281ULL,1041ULL,168ULL,5906ULL,174ULL,1728ULL,1058ULL,8812ULL,218ULL,3860ULL,11637ULL,7509ULL,6347ULL,316ULL,5257ULL,5594ULL,8517ULL,4916ULL,1360ULL,3336ULL,11942ULL,12233ULL,6224ULL,12231ULL,11713ULL,7840ULL,1159ULL,8120ULL,6906ULL,8410ULL,9786ULL,6077ULL,3991ULL,2344ULL,6328ULL,9450ULL,6554ULL,3643ULL,11177ULL,4212ULL,4115ULL,6118ULL,8212ULL,192ULL,1483ULL,3710ULL,5486ULL,9987ULL,1293ULL,9027ULL,6167ULL,2766ULL,3315ULL,1987ULL,9139ULL,6008ULL,2882ULL,4467ULL,10885ULL,6821ULL,2057ULL,1359ULL,12225ULL,3602ULL,6956ULL,6364ULL,8960ULL,11858ULL,9280ULL,6137ULL,11367ULL,11184ULL,3434ULL,1050ULL,6190ULL,7232ULL,10800ULL,468ULL,5919ULL,7507ULL,11836ULL,8214ULL,6992ULL,5874ULL,1975ULL,5206ULL,4240ULL,1003ULL,6147ULL,8500ULL,8561ULL,7048ULL,11939ULL,2033ULL,5782ULL,8689ULL,12133ULL,10316ULL,1594ULL,151ULL,9551ULL,5862ULL,10331ULL,3438ULL,2361ULL,2683ULL,3762ULL,10240ULL,1263ULL,5339ULL,1747ULL,4213ULL,7515ULL,2169ULL,1200ULL,52ULL,4754ULL,3565ULL,4046ULL,5009ULL,10335ULL,4749ULL,11143ULL,11502ULL,3202ULL,11035ULL,683ULL,11868ULL,6413ULL,3514ULL,2692ULL,9784ULL,11566ULL,11889ULL,4079ULL,6608ULL,2908ULL,6844ULL,6523ULL,8844ULL,10706ULL,382ULL,8455ULL,3029ULL,418ULL,7965ULL,8333ULL,6055ULL,2925ULL,3199ULL,835ULL,241ULL,8326ULL,6833ULL,5990ULL,3127ULL,1815ULL,1922ULL,9341ULL,4624ULL,3969ULL,1278ULL,7183ULL,3957ULL,9634ULL,5415ULL,2078ULL,11314ULL,3030ULL,3818ULL,4016ULL,1321ULL,5915ULL,6196ULL,3054ULL,11684ULL,7552ULL,5079ULL,2555ULL,10966ULL,11863ULL,1702ULL,10970ULL,885ULL,10484ULL,7500ULL,325ULL,11279ULL,6920ULL,6854ULL,3656ULL,6221ULL,2031ULL,11271ULL,4298ULL,1579ULL,10596ULL,7341ULL,441ULL,142ULL,3529ULL,4536ULL,11994ULL,4698ULL,9789ULL,3988ULL,4433ULL,5886ULL,5908ULL,6974ULL,6119ULL,11612ULL,8532ULL,6760ULL,3570ULL,8757ULL,9842ULL,12142ULL,4049ULL,2920ULL,10777ULL,8291ULL,10723ULL,9026ULL,2767ULL,6715ULL,10327ULL,2127ULL,5868ULL,6153ULL,4322ULL,9445ULL,1843ULL,11099ULL,9370ULL,4912ULL,49ULL,6843ULL,3123ULL,504ULL,5429ULL,522ULL,5184ULL,3174ULL,1858ULL,654ULL,11580ULL,10333ULL,10238ULL,6752ULL,948ULL,3482ULL,4493ULL,973ULL,2459ULL,4080ULL,10008ULL,11248ULL,12121ULL,6383ULL,12115ULL,10561ULL,11231ULL,3477ULL,12071ULL,8429ULL,652ULL,4780ULL,5942ULL,11973ULL,7032ULL,6695ULL,3772ULL,7373ULL,10929ULL,8953ULL,347ULL,56ULL,6065ULL,58ULL,576ULL,4449ULL,11130ULL,4169ULL,5383ULL,3879ULL,2503ULL,6212ULL,8298ULL,9945ULL,5961ULL,2839ULL,5735ULL,8646ULL,1112ULL,8077ULL,8174ULL,6171ULL,4077ULL,12097ULL,10806ULL,8579ULL,6803ULL,2302ULL,10996ULL,3262ULL,6122ULL,9523ULL,8974ULL};
-inline constexpr std::uint64_t twist_inv_512_12289[512] = {8974ULL,9523ULL,6122ULL,3262ULL,10996ULL,2302ULL,6803ULL,8579ULL,10806ULL,12097ULL,4077ULL,6171ULL,8174ULL,8077ULL,1112ULL,8646ULL,5735ULL,2839ULL,5961ULL,9945ULL,8298ULL,6212ULL,2503ULL,3879ULL,5383ULL,4169ULL,11130ULL,4449ULL,576ULL,58ULL,6065ULL,56ULL,347ULL,8953ULL,10929ULL,7373ULL,3772ULL,6695ULL,7032ULL,11973ULL,5942ULL,4780ULL,652ULL,8429ULL,12071ULL,3477ULL,11231ULL,10561ULL,12115ULL,6383ULL,12121ULL,11248ULL,10008ULL,4080ULL,2459ULL,973ULL,4493ULL,3482ULL,948ULL,6752ULL,10238ULL,10333ULL,11580ULL,654ULL,1858ULL,3174ULL,5184ULL,522ULL,5429ULL,504ULL,3123ULL,6843ULL,49ULL,4912ULL,9370ULL,11099ULL,1843ULL,9445ULL,4322ULL,6153ULL,5868ULL,2127ULL,10327ULL,6715ULL,2767ULL,9026ULL,10723ULL,8291ULL,10777ULL,2920ULL,4049ULL,12142ULL,9842ULL,8757ULL,3570ULL,6760ULL,8532ULL,11612ULL,6119ULL,6974ULL,5908ULL,5886ULL,4433ULL,3988ULL,9789ULL,4698ULL,11994ULL,4536ULL,3529ULL,142ULL,441ULL,7341ULL,10596ULL,1579ULL,4298ULL,11271ULL,2031ULL,6221ULL,3656ULL,6854ULL,6920ULL,11279ULL,325ULL,7500ULL,10484ULL,885ULL,10970ULL,1702ULL,11863ULL,10966ULL,2555ULL,5079ULL,7552ULL,11684ULL,3054ULL,6196ULL,5915ULL,1321ULL,4016ULL,3818ULL,3030ULL,11314ULL,2078ULL,5415ULL,9634ULL,3957ULL,7183ULL,1278ULL,3969ULL,4624ULL,9341ULL,1922ULL,1815ULL,3127ULL,5990ULL,6833ULL,8326ULL,241ULL,835ULL,3199ULL,2925ULL,6055ULL,8333ULL,7965ULL,418ULL,3029ULL,8455ULL,382ULL,10706ULL,8844ULL,6523ULL,6844ULL,2908ULL,6608ULL,4079ULL,11889ULL,11566ULL,9784ULL,2692ULL,3514ULL,6413ULL,11868ULL,683ULL,11035ULL,3202ULL,11502ULL,11143ULL,4749ULL,10335ULL,5009ULL,4046ULL,3565ULL,4754ULL,52ULL,1200ULL,2169ULL,7515ULL,4213ULL,1747ULL,5339ULL,1263ULL,10240ULL,3762ULL,2683ULL,2361ULL,3438ULL,10331ULL,5862ULL,9551ULL,151ULL,1594ULL,10316ULL,12133ULL,8689ULL,5782ULL,2033ULL,11939ULL,7048ULL,8561ULL,8500ULL,6147ULL,1003ULL,4240ULL,5206ULL,1975ULL,5874ULL,6992ULL,8214ULL,11836ULL,7507ULL,5919ULL,468ULL,10800ULL,7232ULL,6190ULL,1050ULL,3434ULL,11184ULL,11367ULL,6137ULL,9280ULL,11858ULL,8960ULL,6364ULL,6956ULL,3602ULL,12225ULL,1359ULL,2057ULL,6821ULL,10885ULL,4467ULL,2882ULL,6008ULL,9139ULL,1987ULL,3315ULL,2766ULL,6167ULL,9027ULL,1293ULL,9987ULL,5486ULL,3710ULL,1483ULL,192ULL,8212ULL,6118ULL,4115ULL,4212ULL,11177ULL,3643ULL,6554ULL,9450ULL,6328ULL,2344ULL,3991ULL,6077ULL,9786ULL,8410ULL,6906ULL,8120ULL,1159ULL,7840ULL,11713ULL,12231ULL,6224ULL,12233ULL,11942ULL,3336ULL,1360ULL,4916ULL,8517ULL,5594ULL,5257ULL,316ULL,6347ULL,7509ULL,11637ULL,3860ULL,218ULL,8812ULL,1058ULL,1728ULL,174ULL,5906ULL,168ULL,1041ULL,2281ULL,8209ULL,9830ULL,11316ULL,7796ULL,8807ULL,11341ULL,5537ULL,2051ULL,1956ULL,709ULL,11635ULL,10431ULL,9115ULL,7105ULL,11767ULL,6860ULL,11785ULL,9166ULL,5446ULL,12240ULL,7377ULL,2919ULL,1190ULL,10446ULL,2844ULL,7967ULL,6136ULL,6421ULL,10162ULL,1962ULL,5574ULL,9522ULL,3263ULL,1566ULL,3998ULL,1512ULL,9369ULL,8240ULL,147ULL,2447ULL,3532ULL,8719ULL,5529ULL,3757ULL,677ULL,6170ULL,5315ULL,6381ULL,6403ULL,7856ULL,8301ULL,2500ULL,7591ULL,295ULL,7753ULL,8760ULL,12147ULL,11848ULL,4948ULL,1693ULL,10710ULL,7991ULL,1018ULL,10258ULL,6068ULL,8633ULL,5435ULL,5369ULL,1010ULL,11964ULL,4789ULL,1805ULL,11404ULL,1319ULL,10587ULL,426ULL,1323ULL,9734ULL,7210ULL,4737ULL,605ULL,9235ULL,6093ULL,6374ULL,10968ULL,8273ULL,8471ULL,9259ULL,975ULL,10211ULL,6874ULL,2655ULL,8332ULL,5106ULL,11011ULL,8320ULL,7665ULL,2948ULL,10367ULL,10474ULL,9162ULL,6299ULL,5456ULL,3963ULL,12048ULL,11454ULL,9090ULL,9364ULL,6234ULL,3956ULL,4324ULL,11871ULL,9260ULL,3834ULL,11907ULL,1583ULL,3445ULL,5766ULL,5445ULL,9381ULL,5681ULL,8210ULL,400ULL,723ULL,2505ULL,9597ULL,8775ULL,5876ULL,421ULL,11606ULL,1254ULL,9087ULL,787ULL,1146ULL,7540ULL,1954ULL,7280ULL,8243ULL,8724ULL,7535ULL,12237ULL,11089ULL,10120ULL,4774ULL,8076ULL,10542ULL,6950ULL,11026ULL,2049ULL,8527ULL,9606ULL,9928ULL,8851ULL,1958ULL,6427ULL,2738ULL,12138ULL,10695ULL,1973ULL,156ULL,3600ULL,6507ULL,10256ULL,350ULL,5241ULL,3728ULL,3789ULL,6142ULL,11286ULL,8049ULL,7083ULL,10314ULL,6415ULL,5297ULL,4075ULL,453ULL,4782ULL,6370ULL,11821ULL,1489ULL,5057ULL,6099ULL,11239ULL,8855ULL,1105ULL,922ULL,6152ULL,3009ULL,431ULL,3329ULL,5925ULL,5333ULL,8687ULL,64ULL,10930ULL,10232ULL,5468ULL,1404ULL,7822ULL,9407ULL,6281ULL,3150ULL,10302ULL};
-inline constexpr PsiTables tables_512_12289{512, 12289, psi_512_12289, psi_inv_512_12289, twist_512_12289, twist_inv_512_12289};
+inline constexpr twiddle_t twist_512_12289[512] = {1,10302,3400,3150,8340,6281,5277,9407,12149,7822,3271,1404,12144,5468,10849,10232,7311,10930,9042,64,8011,8687,4976,5333,8736,5925,12176,3329,9048,431,3833,3009,5860,6152,3531,922,11336,1105,4096,8855,2963,11239,9509,6099,10530,5057,4143,1489,3006,11821,8241,6370,480,4782,9852,453,9275,4075,1426,5297,6534,6415,9377,10314,4134,7083,9273,8049,6915,11286,2143,6142,11112,3789,4414,3728,2731,5241,7205,350,5023,10256,8779,6507,10908,3600,11287,156,9542,1973,12129,10695,9005,12138,5101,2738,3621,6427,10111,1958,5067,8851,10911,9928,9198,9606,9984,8527,3382,2049,8585,11026,2625,6950,3186,10542,5791,8076,2422,4774,1170,10120,8653,11089,334,12237,5012,7535,8246,8724,5191,8243,2396,7280,11082,1954,726,7540,10600,1146,8652,787,9223,9087,8961,1254,2969,11606,5331,421,11414,5876,11227,8775,2166,9597,3289,2505,11899,723,1212,400,3985,8210,6522,5681,5444,9381,2366,5445,7394,5766,8595,3445,12047,1583,563,11907,9405,3834,1022,9260,9302,11871,7203,4324,10512,3956,4388,6234,354,9364,11567,9090,3000,11454,130,12048,11885,3963,2768,5456,10115,6299,6378,9162,7404,10474,5728,10367,9424,2948,4177,7665,8005,8320,9154,11011,7852,5106,5092,8332,9888,2655,8785,6874,6730,10211,12171,975,4337,9259,11289,8471,4053,8273,4231,10968,7270,6374,4821,6093,10163,9235,9821,605,2187,4737,955,7210,2704,9734,1428,1323,1045,426,1479,10587,2399,1319,8993,11404,1168,1805,1853,4789,8232,11964,6747,1010,8526,5369,10938,5435,2686,8633,1673,6068,10682,10258,4805,1018,4919,7991,11560,10710,3778,1693,3195,4948,11813,11848,3748,12147,11796,8760,7393,7753,5195,295,3707,7591,7575,2500,9545,8301,10040,7856,9447,6403,8643,6381,3201,5315,7635,6170,4632,677,6591,3757,6553,5529,243,8719,2837,3532,11224,2447,4255,147,2847,8240,8357,9369,1632,1512,6461,3998,6957,1566,9764,3263,5011,9522,4846,5574,9140,1962,9408,10162,11222,6421,9744,6136,10745,7967,10092,2844,1912,10446,12208,1190,7247,2919,355,7377,2678,12240,11340,5446,5407,9166,11745,11785,6039,6860,9970,11767,4938,7105,2426,9115,2481,10431,5146,11635,9153,709,4452,1956,9041,2051,4611,5537,8925,11341,3459,8807,27,7796,5777,11316,3978,9830,7300,8209,8509,2281,2294,1041,8374,168,10276,5906,773,174,10643,1728,7384,1058,11462,8812,2381,218,9238,3860,10805,11637,5179,7509,10752,6347,9314,316,11136,5257,12280,5594,6267,8517,10963,4916,1663,1360,1260,3336,7428,11942,1305,12233,671,6224,7935,12231,4645,11713,1635,7840,4372,1159,7399,8120,1017,6906,4591,8410,2370,9786,8705,6077,5088,3991,8577,2344,3,6328,10200,9450,442,6554,3542,3643,11869,11177,9813,4212,11854,4115,7969,6118,9644,8212,2548,192,11744,1483,2639,3710,1630,5486,11950,9987,2566,1293,11499,9027,5291,6167,10593,2766,9430,3315};
+inline constexpr twiddle_t untwist_512_12289[512] = {12265,5826,5118,4939,8452,540,4094,7735,5618,6454,139,6197,4153,8774,2253,3017,1891,11014,11498,4608,11996,464,10254,11653,6921,448,1849,2776,2021,10179,2209,1409,11274,9828,10608,5598,11309,4404,72,7100,9224,9761,11511,10669,7,1373,7724,5216,11872,5987,12119,10545,5530,3238,6616,3825,2373,10754,879,10897,6105,1908,3815,10945,6742,3961,6226,6330,5662,8062,3045,7383,5043,7784,2940,11366,12073,3278,9195,7584,2334,4860,12268,8170,1406,8930,1251,6617,510,5232,7988,2575,4730,814,5170,4605,9652,4176,6263,6565,844,4032,4352,406,5900,5588,7592,392,3154,2429,9449,1226,3469,2769,648,2455,9282,1826,5287,9998,63,68,8071,10077,8536,4727,10759,8882,614,4564,10388,9847,9068,10763,7911,12050,5789,4883,9757,193,11522,11071,6878,7814,1802,11113,2827,5002,8520,8611,1882,3982,10345,4924,9021,6811,8717,6873,12100,12085,365,6636,11259,10397,4590,10221,10447,10886,5703,7326,9663,4578,845,717,7211,9929,7596,11710,2301,3654,3944,1136,6883,3528,3808,9572,11307,11034,6643,343,5832,9806,9804,4145,10716,3959,567,612,11194,4670,3090,5676,10808,6204,5526,4209,7469,2600,7878,10844,9754,10138,2945,7080,1790,1737,5386,1327,457,8881,3929,1705,865,8151,2946,3765,4649,11260,7082,7449,7455,12143,4719,412,10588,10453,3285,10568,3019,7550,4443,5966,8000,11951,2171,4489,944,4335,7605,6453,3454,3338,6919,7078,8420,8308,10918,10224,502,7174,9694,125,3451,994,10631,3087,3332,2231,2213,438,10421,11053,5103,5508,2434,5163,3232,1928,11249,6680,578,1014,5776,11111,9457,11573,1763,5219,1927,2275,3821,3344,11607,11943,4113,6195,10783,3056,7785,11914,1936,9307,4974,3028,2293,5596,5650,10975,5604,3708,9269,8054,4987,9089,2593,6505,3120,4538,10555,9247,7250,3534,8496,2148,7000,8921,6508,5464,826,2257,2046,1038,12239,5993,4518,3121,1223,1125,6481,8946,9656,3205,5410,7790,7628,3942,7766,1165,9060,416,9617,9600,4510,5063,2929,10964,5202,9126,2828,1687,11379,5845,3578,10104,5054,8186,9811,5518,6151,9175,150,6599,11024,2926,8620,8914,5135,10029,7899,2674,8348,1208,1694,463,1280,8794,9687,11041,8016,8067,11048,9389,3502,3975,8972,9489,3805,7228,2730,7043,1555,6555,9416,20,7434,8024,6125,9342,11839,4781,3795,3511,11007,10125,9173,6780,881,4267,11823,8665,7207,10900,8449,10485,7806,3744,530,377,3723,8700,1783,364,9951,8400,874,2894,4099,3449,7624,4913,8619,12229,2276,506,6203,8841,1350,10235,904,1756,3846,6492,9348,4238,9646,11777,1398,10872,2957,4167,11520,5412,1160,1057,10699,11158,1120,10767,6940,11197,7014,11667,9667,3607,12281,1942,1706,9839,11010,180,5461,10771,5969,10344,8239,6162,9577,7021,751,5102,8823,11864,7929,1536,8095,4251,3418,12077,2307,8342,8809,9118,4770,3393,8929,4566,3758,3276,3536,1866,7866,1468};
+inline constexpr twiddle_t fwd_layers_512_12289[511] = {1,1,1479,1,8246,1479,5146,1,4134,8246,11567,1479,6553,5146,1305,1,5860,4134,3621,8246,1212,11567,8785,1479,3195,6553,9744,5146,10643,1305,3542,1,7311,5860,3006,4134,5023,3621,2625,8246,8961,1212,563,11567,5728,8785,4821,1479,10938,3195,9545,6553,6461,9744,11340,5146,5777,10643,9314,1305,4591,3542,2639,1,12149,7311,8736,5860,2963,3006,9275,4134,11112,5023,9542,3621,9198,2625,1170,8246,726,8961,11227,1212,2366,563,7203,11567,2768,5728,9154,8785,11289,4821,955,1479,1853,10938,4805,3195,7393,9545,3201,6553,4255,6461,4846,9744,12208,11340,9970,5146,4611,5777,2294,10643,9238,9314,10963,1305,1635,4591,8577,3542,7969,2639,11499,1,8340,12149,12144,7311,8011,8736,9048,5860,11336,2963,10530,3006,480,9275,6534,4134,6915,11112,2731,5023,10908,9542,9005,3621,5067,9198,3382,2625,5791,1170,334,8246,2396,726,8652,8961,5331,11227,3289,1212,6522,2366,8595,563,1022,7203,4388,11567,130,2768,6378,5728,4177,9154,5092,8785,12171,11289,4231,4821,9821,955,1428,1479,8993,1853,6747,10938,1673,4805,11560,3195,3748,7393,3707,9545,9447,3201,4632,6553,2837,4255,8357,6461,9764,4846,9408,9744,10092,12208,355,11340,11745,9970,2426,5146,4452,4611,3459,5777,7300,2294,10276,10643,11462,9238,5179,9314,12280,10963,1260,1305,7935,1635,7399,4591,8705,8577,10200,3542,9813,7969,2548,2639,11950,11499,10593,1,3400,8340,5277,12149,3271,12144,10849,7311,9042,8011,4976,8736,12176,9048,3833,5860,3531,11336,4096,2963,9509,10530,4143,3006,8241,480,9852,9275,1426,6534,9377,4134,9273,6915,2143,11112,4414,2731,7205,5023,8779,10908,11287,9542,12129,9005,5101,3621,10111,5067,10911,9198,9984,3382,8585,2625,3186,5791,2422,1170,8653,334,5012,8246,5191,2396,11082,726,10600,8652,9223,8961,2969,5331,11414,11227,2166,3289,11899,1212,3985,6522,5444,2366,7394,8595,12047,563,9405,1022,9302,7203,10512,4388,354,11567,3000,130,11885,2768,10115,6378,7404,5728,9424,4177,8005,9154,7852,5092,9888,8785,6730,12171,4337,11289,4053,4231,7270,4821,10163,9821,2187,955,2704,1428,1045,1479,2399,8993,1168,1853,8232,6747,8526,10938,2686,1673,10682,4805,4919,11560,3778,3195,11813,3748,11796,7393,5195,3707,7575,9545,10040,9447,8643,3201,7635,4632,6591,6553,243,2837,11224,4255,2847,8357,1632,6461,6957,9764,5011,4846,9140,9408,11222,9744,10745,10092,1912,12208,7247,355,2678,11340,5407,11745,6039,9970,4938,2426,2481,5146,9153,4452,9041,4611,8925,3459,27,5777,3978,7300,8509,2294,8374,10276,773,10643,7384,11462,2381,9238,10805,5179,10752,9314,11136,12280,6267,10963,1663,1260,7428,1305,671,7935,4645,1635,4372,7399,1017,4591,2370,8705,5088,8577,3,10200,442,3542,11869,9813,11854,7969,9644,2548,11744,2639,1630,11950,2566,11499,5291,10593,9430};
+inline constexpr twiddle_t inv_layers_512_12289[511] = {1,1,10810,1,7143,10810,4043,1,10984,7143,5736,10810,722,4043,8155,1,8747,10984,1646,7143,2545,5736,9094,10810,3504,722,11077,4043,8668,8155,6429,1,9650,8747,7698,10984,2975,1646,6512,7143,949,2545,5828,5736,2744,9094,1351,10810,7468,3504,6561,722,11726,11077,3328,4043,9664,8668,7266,8155,9283,6429,4978,1,790,9650,4320,8747,3712,7698,10654,10984,1326,2975,3051,1646,9995,6512,7678,7143,2319,949,81,2545,7443,5828,8034,5736,9088,2744,4896,9094,7484,1351,10436,10810,11334,7468,1000,3504,3135,6561,9521,722,5086,11726,9923,11077,1062,3328,11563,4043,11119,9664,3091,8668,2747,7266,1177,8155,3014,9283,9326,6429,3553,4978,140,1,1696,790,339,9650,9741,4320,2476,8747,2089,3712,3584,7698,4890,10654,4354,10984,11029,1326,9,2975,7110,3051,827,1646,2013,9995,4989,6512,8830,7678,7837,7143,9863,2319,544,949,11934,81,2197,2545,2881,7443,2525,5828,3932,8034,9452,5736,7657,9088,2842,2744,8582,4896,8541,9094,729,7484,10616,1351,5542,10436,3296,10810,10861,11334,2468,7468,8058,1000,118,3504,7197,3135,8112,6561,5911,9521,12159,722,7901,5086,11267,11726,3694,9923,5767,11077,9000,1062,6958,3328,3637,11563,9893,4043,11955,11119,6498,9664,8907,3091,7222,8668,3284,2747,1381,7266,9558,1177,5374,8155,5755,3014,11809,9283,1759,9326,953,6429,3241,3553,4278,4978,145,140,3949,1,2859,1696,6998,790,9723,339,10659,9650,545,9741,2645,4320,435,2476,420,8747,11847,2089,12286,3712,7201,3584,9919,7698,11272,4890,7917,10654,7644,4354,11618,10984,4861,11029,10626,1326,6022,9,1153,2975,1537,7110,1484,3051,9908,827,4905,1646,11516,2013,3915,9995,3780,4989,8311,6512,12262,8830,3364,7678,3248,7837,3136,7143,9808,9863,7351,2319,6250,544,6882,949,9611,11934,5042,81,10377,2197,1544,2545,1067,2881,3149,7443,7278,2525,5332,5828,10657,3932,9442,8034,1065,9452,12046,5736,5698,7657,4654,9088,3646,2842,2249,2744,4714,8582,7094,4896,493,8541,476,9094,8511,729,7370,7484,1607,10616,9603,1351,3763,5542,4057,10436,11121,3296,9890,10810,11244,10861,9585,11334,10102,2468,2126,7468,5019,8058,8236,1000,7952,118,5559,3504,2401,7197,4437,3135,4284,8112,2865,6561,4885,5911,2174,9521,404,12159,9289,722,11935,7901,1777,5086,2987,11267,2884,11726,242,3694,4895,9923,6845,5767,8304,11077,390,9000,10123,1062,875,6958,9320,3328,3066,3637,1689,11563,1207,9893,7098,4043,7277,11955,3636,11119,9867,6498,9103,9664,3704,8907,2305,3091,1378,7222,2178,8668,7188,3284,160,2747,1002,1381,3510,7266,5084,9558,7875,1177,10146,5374,3016,8155,2912,5755,10863,3014,2437,11809,4048,9283,8146,1759,2780,9326,8193,953,8758,6429,8456,3241,113,3553,7313,4278,3247,4978,1440,145,9018,140,7012,3949,8889};
+inline constexpr PsiTables tables_512_12289{512, 12289, psi_512_12289, psi_inv_512_12289, twist_512_12289, untwist_512_12289, fwd_layers_512_12289, inv_layers_512_12289};
 
 inline constexpr std::uint64_t psi_1024_18433 = 17660ULL;
 inline constexpr std::uint64_t psi_inv_1024_18433 = 18123ULL;
-inline constexpr std::uint64_t twist_1024_18433[1024] = {17660ULL,4197ULL,1130ULL,6980ULL,9675ULL,6584ULL,12612ULL,17059ULL,974ULL,8137ULL,2630ULL,14288ULL,10773ULL,7657ULL,6190ULL,12462ULL,8955ULL,11924ULL,9873ULL,14332ULL,16591ULL,4445ULL,5435ULL,7309ULL,8771ULL,1000ULL,4872ULL,732ULL,13004ULL,1863ULL,9224ULL,11465ULL,8669ULL,10973ULL,12318ULL,10023ULL,4003ULL,5641ULL,2709ULL,12166ULL,5006ULL,15099ULL,3222ULL,3753ULL,4423ULL,2526ULL,8915ULL,18365ULL,12793ULL,4964ULL,6194ULL,6288ULL,8663ULL,1801ULL,12756ULL,15991ULL,8895ULL,12369ULL,14253ULL,280ULL,10212ULL,16426ULL,10277ULL,17480ULL,5532ULL,14270ULL,1690ULL,8971ULL,5661ULL,8705ULL,10706ULL,9690ULL,11081ULL,11517ULL,2139ULL,7177ULL,9750ULL,10636ULL,7137ULL,16191ULL,13556ULL,16202ULL,5794ULL,15399ULL,997ULL,286ULL,951ULL,15988ULL,4309ULL,12588ULL,17237ULL,2726ULL,13576ULL,3765ULL,4334ULL,1650ULL,15412ULL,8581ULL,17770ULL,309ULL,11533ULL,14309ULL,6009ULL,6124ULL,3735ULL,13773ULL,3840ULL,8386ULL,14608ULL,14544ULL,2730ULL,7402ULL,3473ULL,12644ULL,4533ULL,17071ULL,885ULL,7261ULL,9127ULL,4504ULL,15750ULL,3002ULL,11529ULL,2050ULL,6301ULL,16247ULL,852ULL,12114ULL,11536ULL,462ULL,5790ULL,3140ULL,1289ULL,10409ULL,16501ULL,14329ULL,12005ULL,4664ULL,8419ULL,9755ULL,12135ULL,6772ULL,17362ULL,3335ULL,4451ULL,14607ULL,6871ULL,2803ULL,14541ULL,16577ULL,7621ULL,6457ULL,15090ULL,7897ULL,4410ULL,13375ULL,9864ULL,574ULL,17248ULL,13397ULL,12773ULL,17401ULL,7654ULL,1604ULL,12681ULL,11939ULL,14370ULL,13237ULL,1671ULL,10648ULL,7048ULL,15315ULL,1620ULL,6418ULL,10771ULL,10744ULL,6336ULL,8307ULL,16730ULL,1878ULL,13721ULL,10370ULL,12182ULL,17176ULL,13931ULL,18029ULL,15285ULL,11059ULL,8608ULL,3745ULL,16771ULL,3110ULL,10728ULL,12599ULL,9475ULL,1923ULL,8779ULL,7085ULL,4288ULL,17352ULL,337ULL,5181ULL,12265ULL,8880ULL,7872ULL,15348ULL,15200ULL,4009ULL,14813ULL,2271ULL,6198ULL,114ULL,8371ULL,10111ULL,15639ULL,17650ULL,1199ULL,1860ULL,4638ULL,11684ULL,11653ULL,13419ULL,15682ULL,15795ULL,16493ULL,8244ULL,12589ULL,6477ULL,2653ULL,6437ULL,9094ULL,9357ULL,18159ULL,17393ULL,1569ULL,2188ULL,14494ULL,6173ULL,11052ULL,10196ULL,4256ULL,11445ULL,2673ULL,12433ULL,7634ULL,14041ULL,14141ULL,7255ULL,18388ULL,4942ULL,3285ULL,7894ULL,18257ULL,13594ULL,12848ULL,3020ULL,2179ULL,736ULL,6830ULL,1571ULL,17534ULL,14348ULL,10328ULL,3277ULL,1809ULL,408ULL,15407ULL,7082ULL,18135ULL,17571ULL,3321ULL,7627ULL,15629ULL,14652ULL,1929ULL,17951ULL,6647ULL,16753ULL,12460ULL,12042ULL,12070ULL,5718ULL,3674ULL,6545ULL,8293ULL,1473ULL,2900ULL,3069ULL,9496ULL,15592ULL,7246ULL,4630ULL,5599ULL,12237ULL,15232ULL,9916ULL,12477ULL,13452ULL,10829ULL,13386ULL,2102ULL,18204ULL,12451ULL,16717ULL,12727ULL,14670ULL,11012ULL,16637ULL,7176ULL,2077ULL,10709ULL,14276ULL,10862ULL,8533ULL,18126ULL,3813ULL,3978ULL,16579ULL,4534ULL,6311ULL,812ULL,122ULL,14456ULL,9527ULL,13826ULL,4983ULL,4517ULL,4901ULL,2053ULL,10887ULL,16028ULL,16301ULL,9668ULL,8172ULL,13123ULL,11733ULL,537ULL,9842ULL,16098ULL,421ULL,4558ULL,6133ULL,17493ULL,13116ULL,13321ULL,1048ULL,4516ULL,15661ULL,2126ULL,18026ULL,10699ULL,11278ULL,11592ULL,6191ULL,1702ULL,8882ULL,4785ULL,15202ULL,922ULL,14667ULL,6426ULL,16856ULL,10160ULL,4523ULL,14073ULL,1615ULL,4919ULL,11136ULL,9573ULL,16557ULL,1625ULL,7917ULL,10406ULL,11915ULL,14548ULL,14989ULL,7110ULL,11783ULL,15527ULL,6192ULL,9375ULL,8809ULL,16079ULL,2098ULL,5945ULL,12743ULL,8407ULL,9844ULL,13011ULL,275ULL,8713ULL,16791ULL,9106ULL,9268ULL,17283ULL,5457ULL,10218ULL,7165ULL,9839ULL,11512ULL,640ULL,7542ULL,8579ULL,2424ULL,455ULL,7378ULL,3651ULL,14396ULL,9972ULL,18206ULL,9364ULL,16571ULL,16882ULL,6895ULL,2625ULL,12789ULL,11138ULL,6486ULL,16411ULL,5780ULL,142ULL,2019ULL,8067ULL,77ULL,965ULL,12812ULL,3287ULL,4807ULL,18111ULL,17749ULL,5073ULL,13066ULL,16764ULL,4698ULL,11239ULL,7273ULL,9038ULL,3628ULL,3814ULL,11651ULL,16506ULL,15828ULL,11640ULL,5835ULL,16631ULL,16437ULL,2515ULL,16677ULL,735ULL,17590ULL,1644ULL,6240ULL,9019ULL,5305ULL,5201ULL,18261ULL,7420ULL,12556ULL,11330ULL,5062ULL,2395ULL,17567ULL,9495ULL,7919ULL,7319ULL,11769ULL,270ULL,7214ULL,17156ULL,7935ULL,1056ULL,10601ULL,15077ULL,313ULL,5359ULL,14017ULL,14319ULL,9007ULL,5394ULL,6077ULL,11764ULL,17204ULL,7579ULL,15985ULL,18156ULL,12807ULL,1788ULL,5172ULL,16940ULL,9537ULL,16824ULL,4253ULL,6859ULL,2892ULL,15417ULL,10080ULL,17405ULL,1480ULL,1312ULL,2558ULL,14822ULL,16029ULL,5541ULL,9595ULL,1033ULL,19ULL,16756ULL,17046ULL,11823ULL,9086ULL,3272ULL,310ULL,773ULL,14236ULL,17303ULL,11453ULL,8758ULL,11849ULL,5821ULL,1374ULL,17459ULL,10296ULL,15803ULL,4145ULL,7660ULL,10776ULL,12243ULL,5971ULL,9478ULL,6509ULL,8560ULL,4101ULL,1842ULL,13988ULL,12998ULL,11124ULL,9662ULL,17433ULL,13561ULL,17701ULL,5429ULL,16570ULL,9209ULL,6968ULL,9764ULL,7460ULL,6115ULL,8410ULL,14430ULL,12792ULL,15724ULL,6267ULL,13427ULL,3334ULL,15211ULL,14680ULL,14010ULL,15907ULL,9518ULL,68ULL,5640ULL,13469ULL,12239ULL,12145ULL,9770ULL,16632ULL,5677ULL,2442ULL,9538ULL,6064ULL,4180ULL,18153ULL,8221ULL,2007ULL,8156ULL,953ULL,12901ULL,4163ULL,16743ULL,9462ULL,12772ULL,9728ULL,7727ULL,8743ULL,7352ULL,6916ULL,16294ULL,11256ULL,8683ULL,7797ULL,11296ULL,2242ULL,4877ULL,2231ULL,12639ULL,3034ULL,17436ULL,18147ULL,17482ULL,2445ULL,14124ULL,5845ULL,1196ULL,15707ULL,4857ULL,14668ULL,14099ULL,16783ULL,3021ULL,9852ULL,663ULL,18124ULL,6900ULL,4124ULL,12424ULL,12309ULL,14698ULL,4660ULL,14593ULL,10047ULL,3825ULL,3889ULL,15703ULL,11031ULL,14960ULL,5789ULL,13900ULL,1362ULL,17548ULL,11172ULL,9306ULL,13929ULL,2683ULL,15431ULL,6904ULL,16383ULL,12132ULL,2186ULL,17581ULL,6319ULL,6897ULL,17971ULL,12643ULL,15293ULL,17144ULL,8024ULL,1932ULL,4104ULL,6428ULL,13769ULL,10014ULL,8678ULL,6298ULL,11661ULL,1071ULL,15098ULL,13982ULL,3826ULL,11562ULL,15630ULL,3892ULL,1856ULL,10812ULL,11976ULL,3343ULL,10536ULL,14023ULL,5058ULL,8569ULL,17859ULL,1185ULL,5036ULL,5660ULL,1032ULL,10779ULL,16829ULL,5752ULL,6494ULL,4063ULL,5196ULL,16762ULL,7785ULL,11385ULL,3118ULL,16813ULL,12015ULL,7662ULL,7689ULL,12097ULL,10126ULL,1703ULL,16555ULL,4712ULL,8063ULL,6251ULL,1257ULL,4502ULL,404ULL,3148ULL,7374ULL,9825ULL,14688ULL,1662ULL,15323ULL,7705ULL,5834ULL,8958ULL,16510ULL,9654ULL,11348ULL,14145ULL,1081ULL,18096ULL,13252ULL,6168ULL,9553ULL,10561ULL,3085ULL,3233ULL,14424ULL,3620ULL,16162ULL,12235ULL,18319ULL,10062ULL,8322ULL,2794ULL,783ULL,17234ULL,16573ULL,13795ULL,6749ULL,6780ULL,5014ULL,2751ULL,2638ULL,1940ULL,10189ULL,5844ULL,11956ULL,15780ULL,11996ULL,9339ULL,9076ULL,274ULL,1040ULL,16864ULL,16245ULL,3939ULL,12260ULL,7381ULL,8237ULL,14177ULL,6988ULL,15760ULL,6000ULL,10799ULL,4392ULL,4292ULL,11178ULL,45ULL,13491ULL,15148ULL,10539ULL,176ULL,4839ULL,5585ULL,15413ULL,16254ULL,17697ULL,11603ULL,16862ULL,899ULL,4085ULL,8105ULL,15156ULL,16624ULL,18025ULL,3026ULL,11351ULL,298ULL,862ULL,15112ULL,10806ULL,2804ULL,3781ULL,16504ULL,482ULL,11786ULL,1680ULL,5973ULL,6391ULL,6363ULL,12715ULL,14759ULL,11888ULL,10140ULL,16960ULL,15533ULL,15364ULL,8937ULL,2841ULL,11187ULL,13803ULL,12834ULL,6196ULL,3201ULL,8517ULL,5956ULL,4981ULL,7604ULL,5047ULL,16331ULL,229ULL,5982ULL,1716ULL,5706ULL,3763ULL,7421ULL,1796ULL,11257ULL,16356ULL,7724ULL,4157ULL,7571ULL,9900ULL,307ULL,14620ULL,14455ULL,1854ULL,13899ULL,12122ULL,17621ULL,18311ULL,3977ULL,8906ULL,4607ULL,13450ULL,13916ULL,13532ULL,16380ULL,7546ULL,2405ULL,2132ULL,8765ULL,10261ULL,5310ULL,6700ULL,17896ULL,8591ULL,2335ULL,18012ULL,13875ULL,12300ULL,940ULL,5317ULL,5112ULL,17385ULL,13917ULL,2772ULL,16307ULL,407ULL,7734ULL,7155ULL,6841ULL,12242ULL,16731ULL,9551ULL,13648ULL,3231ULL,17511ULL,3766ULL,12007ULL,1577ULL,8273ULL,13910ULL,4360ULL,16818ULL,13514ULL,7297ULL,8860ULL,1876ULL,16808ULL,10516ULL,8027ULL,6518ULL,3885ULL,3444ULL,11323ULL,6650ULL,2906ULL,12241ULL,9058ULL,9624ULL,2354ULL,16335ULL,12488ULL,5690ULL,10026ULL,8589ULL,5422ULL,18158ULL,9720ULL,1642ULL,9327ULL,9165ULL,1150ULL,12976ULL,8215ULL,11268ULL,8594ULL,6921ULL,17793ULL,10891ULL,9854ULL,16009ULL,17978ULL,11055ULL,14782ULL,4037ULL,8461ULL,227ULL,9069ULL,1862ULL,1551ULL,11538ULL,15808ULL,5644ULL,7295ULL,11947ULL,2022ULL,12653ULL,18291ULL,16414ULL,10366ULL,18356ULL,17468ULL,5621ULL,15146ULL,13626ULL,322ULL,684ULL,13360ULL,5367ULL,1669ULL,13735ULL,7194ULL,11160ULL,9395ULL,14805ULL,14619ULL,6782ULL,1927ULL,2605ULL,6793ULL,12598ULL,1802ULL,1996ULL,15918ULL,1756ULL,17698ULL,843ULL,16789ULL,12193ULL,9414ULL,13128ULL,13232ULL,172ULL,11013ULL,5877ULL,7103ULL,13371ULL,16038ULL,866ULL,8938ULL,10514ULL,11114ULL,6664ULL,18163ULL,11219ULL,1277ULL,10498ULL,17377ULL,7832ULL,3356ULL,18120ULL,13074ULL,4416ULL,4114ULL,9426ULL,13039ULL,12356ULL,6669ULL,1229ULL,10854ULL,2448ULL,277ULL,5626ULL,16645ULL,13261ULL,1493ULL,8896ULL,1609ULL,14180ULL,11574ULL,15541ULL,3016ULL,8353ULL,1028ULL,16953ULL,17121ULL,15875ULL,3611ULL,2404ULL,12892ULL,8838ULL,17400ULL,18414ULL,1677ULL,1387ULL,6610ULL,9347ULL,15161ULL,18123ULL};
-inline constexpr std::uint64_t twist_inv_1024_18433[1024] = {18123ULL,15161ULL,9347ULL,6610ULL,1387ULL,1677ULL,18414ULL,17400ULL,8838ULL,12892ULL,2404ULL,3611ULL,15875ULL,17121ULL,16953ULL,1028ULL,8353ULL,3016ULL,15541ULL,11574ULL,14180ULL,1609ULL,8896ULL,1493ULL,13261ULL,16645ULL,5626ULL,277ULL,2448ULL,10854ULL,1229ULL,6669ULL,12356ULL,13039ULL,9426ULL,4114ULL,4416ULL,13074ULL,18120ULL,3356ULL,7832ULL,17377ULL,10498ULL,1277ULL,11219ULL,18163ULL,6664ULL,11114ULL,10514ULL,8938ULL,866ULL,16038ULL,13371ULL,7103ULL,5877ULL,11013ULL,172ULL,13232ULL,13128ULL,9414ULL,12193ULL,16789ULL,843ULL,17698ULL,1756ULL,15918ULL,1996ULL,1802ULL,12598ULL,6793ULL,2605ULL,1927ULL,6782ULL,14619ULL,14805ULL,9395ULL,11160ULL,7194ULL,13735ULL,1669ULL,5367ULL,13360ULL,684ULL,322ULL,13626ULL,15146ULL,5621ULL,17468ULL,18356ULL,10366ULL,16414ULL,18291ULL,12653ULL,2022ULL,11947ULL,7295ULL,5644ULL,15808ULL,11538ULL,1551ULL,1862ULL,9069ULL,227ULL,8461ULL,4037ULL,14782ULL,11055ULL,17978ULL,16009ULL,9854ULL,10891ULL,17793ULL,6921ULL,8594ULL,11268ULL,8215ULL,12976ULL,1150ULL,9165ULL,9327ULL,1642ULL,9720ULL,18158ULL,5422ULL,8589ULL,10026ULL,5690ULL,12488ULL,16335ULL,2354ULL,9624ULL,9058ULL,12241ULL,2906ULL,6650ULL,11323ULL,3444ULL,3885ULL,6518ULL,8027ULL,10516ULL,16808ULL,1876ULL,8860ULL,7297ULL,13514ULL,16818ULL,4360ULL,13910ULL,8273ULL,1577ULL,12007ULL,3766ULL,17511ULL,3231ULL,13648ULL,9551ULL,16731ULL,12242ULL,6841ULL,7155ULL,7734ULL,407ULL,16307ULL,2772ULL,13917ULL,17385ULL,5112ULL,5317ULL,940ULL,12300ULL,13875ULL,18012ULL,2335ULL,8591ULL,17896ULL,6700ULL,5310ULL,10261ULL,8765ULL,2132ULL,2405ULL,7546ULL,16380ULL,13532ULL,13916ULL,13450ULL,4607ULL,8906ULL,3977ULL,18311ULL,17621ULL,12122ULL,13899ULL,1854ULL,14455ULL,14620ULL,307ULL,9900ULL,7571ULL,4157ULL,7724ULL,16356ULL,11257ULL,1796ULL,7421ULL,3763ULL,5706ULL,1716ULL,5982ULL,229ULL,16331ULL,5047ULL,7604ULL,4981ULL,5956ULL,8517ULL,3201ULL,6196ULL,12834ULL,13803ULL,11187ULL,2841ULL,8937ULL,15364ULL,15533ULL,16960ULL,10140ULL,11888ULL,14759ULL,12715ULL,6363ULL,6391ULL,5973ULL,1680ULL,11786ULL,482ULL,16504ULL,3781ULL,2804ULL,10806ULL,15112ULL,862ULL,298ULL,11351ULL,3026ULL,18025ULL,16624ULL,15156ULL,8105ULL,4085ULL,899ULL,16862ULL,11603ULL,17697ULL,16254ULL,15413ULL,5585ULL,4839ULL,176ULL,10539ULL,15148ULL,13491ULL,45ULL,11178ULL,4292ULL,4392ULL,10799ULL,6000ULL,15760ULL,6988ULL,14177ULL,8237ULL,7381ULL,12260ULL,3939ULL,16245ULL,16864ULL,1040ULL,274ULL,9076ULL,9339ULL,11996ULL,15780ULL,11956ULL,5844ULL,10189ULL,1940ULL,2638ULL,2751ULL,5014ULL,6780ULL,6749ULL,13795ULL,16573ULL,17234ULL,783ULL,2794ULL,8322ULL,10062ULL,18319ULL,12235ULL,16162ULL,3620ULL,14424ULL,3233ULL,3085ULL,10561ULL,9553ULL,6168ULL,13252ULL,18096ULL,1081ULL,14145ULL,11348ULL,9654ULL,16510ULL,8958ULL,5834ULL,7705ULL,15323ULL,1662ULL,14688ULL,9825ULL,7374ULL,3148ULL,404ULL,4502ULL,1257ULL,6251ULL,8063ULL,4712ULL,16555ULL,1703ULL,10126ULL,12097ULL,7689ULL,7662ULL,12015ULL,16813ULL,3118ULL,11385ULL,7785ULL,16762ULL,5196ULL,4063ULL,6494ULL,5752ULL,16829ULL,10779ULL,1032ULL,5660ULL,5036ULL,1185ULL,17859ULL,8569ULL,5058ULL,14023ULL,10536ULL,3343ULL,11976ULL,10812ULL,1856ULL,3892ULL,15630ULL,11562ULL,3826ULL,13982ULL,15098ULL,1071ULL,11661ULL,6298ULL,8678ULL,10014ULL,13769ULL,6428ULL,4104ULL,1932ULL,8024ULL,17144ULL,15293ULL,12643ULL,17971ULL,6897ULL,6319ULL,17581ULL,2186ULL,12132ULL,16383ULL,6904ULL,15431ULL,2683ULL,13929ULL,9306ULL,11172ULL,17548ULL,1362ULL,13900ULL,5789ULL,14960ULL,11031ULL,15703ULL,3889ULL,3825ULL,10047ULL,14593ULL,4660ULL,14698ULL,12309ULL,12424ULL,4124ULL,6900ULL,18124ULL,663ULL,9852ULL,3021ULL,16783ULL,14099ULL,14668ULL,4857ULL,15707ULL,1196ULL,5845ULL,14124ULL,2445ULL,17482ULL,18147ULL,17436ULL,3034ULL,12639ULL,2231ULL,4877ULL,2242ULL,11296ULL,7797ULL,8683ULL,11256ULL,16294ULL,6916ULL,7352ULL,8743ULL,7727ULL,9728ULL,12772ULL,9462ULL,16743ULL,4163ULL,12901ULL,953ULL,8156ULL,2007ULL,8221ULL,18153ULL,4180ULL,6064ULL,9538ULL,2442ULL,5677ULL,16632ULL,9770ULL,12145ULL,12239ULL,13469ULL,5640ULL,68ULL,9518ULL,15907ULL,14010ULL,14680ULL,15211ULL,3334ULL,13427ULL,6267ULL,15724ULL,12792ULL,14430ULL,8410ULL,6115ULL,7460ULL,9764ULL,6968ULL,9209ULL,16570ULL,5429ULL,17701ULL,13561ULL,17433ULL,9662ULL,11124ULL,12998ULL,13988ULL,1842ULL,4101ULL,8560ULL,6509ULL,9478ULL,5971ULL,12243ULL,10776ULL,7660ULL,4145ULL,15803ULL,10296ULL,17459ULL,1374ULL,5821ULL,11849ULL,8758ULL,11453ULL,17303ULL,14236ULL,773ULL,310ULL,3272ULL,9086ULL,11823ULL,17046ULL,16756ULL,19ULL,1033ULL,9595ULL,5541ULL,16029ULL,14822ULL,2558ULL,1312ULL,1480ULL,17405ULL,10080ULL,15417ULL,2892ULL,6859ULL,4253ULL,16824ULL,9537ULL,16940ULL,5172ULL,1788ULL,12807ULL,18156ULL,15985ULL,7579ULL,17204ULL,11764ULL,6077ULL,5394ULL,9007ULL,14319ULL,14017ULL,5359ULL,313ULL,15077ULL,10601ULL,1056ULL,7935ULL,17156ULL,7214ULL,270ULL,11769ULL,7319ULL,7919ULL,9495ULL,17567ULL,2395ULL,5062ULL,11330ULL,12556ULL,7420ULL,18261ULL,5201ULL,5305ULL,9019ULL,6240ULL,1644ULL,17590ULL,735ULL,16677ULL,2515ULL,16437ULL,16631ULL,5835ULL,11640ULL,15828ULL,16506ULL,11651ULL,3814ULL,3628ULL,9038ULL,7273ULL,11239ULL,4698ULL,16764ULL,13066ULL,5073ULL,17749ULL,18111ULL,4807ULL,3287ULL,12812ULL,965ULL,77ULL,8067ULL,2019ULL,142ULL,5780ULL,16411ULL,6486ULL,11138ULL,12789ULL,2625ULL,6895ULL,16882ULL,16571ULL,9364ULL,18206ULL,9972ULL,14396ULL,3651ULL,7378ULL,455ULL,2424ULL,8579ULL,7542ULL,640ULL,11512ULL,9839ULL,7165ULL,10218ULL,5457ULL,17283ULL,9268ULL,9106ULL,16791ULL,8713ULL,275ULL,13011ULL,9844ULL,8407ULL,12743ULL,5945ULL,2098ULL,16079ULL,8809ULL,9375ULL,6192ULL,15527ULL,11783ULL,7110ULL,14989ULL,14548ULL,11915ULL,10406ULL,7917ULL,1625ULL,16557ULL,9573ULL,11136ULL,4919ULL,1615ULL,14073ULL,4523ULL,10160ULL,16856ULL,6426ULL,14667ULL,922ULL,15202ULL,4785ULL,8882ULL,1702ULL,6191ULL,11592ULL,11278ULL,10699ULL,18026ULL,2126ULL,15661ULL,4516ULL,1048ULL,13321ULL,13116ULL,17493ULL,6133ULL,4558ULL,421ULL,16098ULL,9842ULL,537ULL,11733ULL,13123ULL,8172ULL,9668ULL,16301ULL,16028ULL,10887ULL,2053ULL,4901ULL,4517ULL,4983ULL,13826ULL,9527ULL,14456ULL,122ULL,812ULL,6311ULL,4534ULL,16579ULL,3978ULL,3813ULL,18126ULL,8533ULL,10862ULL,14276ULL,10709ULL,2077ULL,7176ULL,16637ULL,11012ULL,14670ULL,12727ULL,16717ULL,12451ULL,18204ULL,2102ULL,13386ULL,10829ULL,13452ULL,12477ULL,9916ULL,15232ULL,12237ULL,5599ULL,4630ULL,7246ULL,15592ULL,9496ULL,3069ULL,2900ULL,1473ULL,8293ULL,6545ULL,3674ULL,5718ULL,12070ULL,12042ULL,12460ULL,16753ULL,6647ULL,17951ULL,1929ULL,14652ULL,15629ULL,7627ULL,3321ULL,17571ULL,18135ULL,7082ULL,15407ULL,408ULL,1809ULL,3277ULL,10328ULL,14348ULL,17534ULL,1571ULL,6830ULL,736ULL,2179ULL,3020ULL,12848ULL,13594ULL,18257ULL,7894ULL,3285ULL,4942ULL,18388ULL,7255ULL,14141ULL,14041ULL,7634ULL,12433ULL,2673ULL,11445ULL,4256ULL,10196ULL,11052ULL,6173ULL,14494ULL,2188ULL,1569ULL,17393ULL,18159ULL,9357ULL,9094ULL,6437ULL,2653ULL,6477ULL,12589ULL,8244ULL,16493ULL,15795ULL,15682ULL,13419ULL,11653ULL,11684ULL,4638ULL,1860ULL,1199ULL,17650ULL,15639ULL,10111ULL,8371ULL,114ULL,6198ULL,2271ULL,14813ULL,4009ULL,15200ULL,15348ULL,7872ULL,8880ULL,12265ULL,5181ULL,337ULL,17352ULL,4288ULL,7085ULL,8779ULL,1923ULL,9475ULL,12599ULL,10728ULL,3110ULL,16771ULL,3745ULL,8608ULL,11059ULL,15285ULL,18029ULL,13931ULL,17176ULL,12182ULL,10370ULL,13721ULL,1878ULL,16730ULL,8307ULL,6336ULL,10744ULL,10771ULL,6418ULL,1620ULL,15315ULL,7048ULL,10648ULL,1671ULL,13237ULL,14370ULL,11939ULL,12681ULL,1604ULL,7654ULL,17401ULL,12773ULL,13397ULL,17248ULL,574ULL,9864ULL,13375ULL,4410ULL,7897ULL,15090ULL,6457ULL,7621ULL,16577ULL,14541ULL,2803ULL,6871ULL,14607ULL,4451ULL,3335ULL,17362ULL,6772ULL,12135ULL,9755ULL,8419ULL,4664ULL,12005ULL,14329ULL,16501ULL,10409ULL,1289ULL,3140ULL,5790ULL,462ULL,11536ULL,12114ULL,852ULL,16247ULL,6301ULL,2050ULL,11529ULL,3002ULL,15750ULL,4504ULL,9127ULL,7261ULL,885ULL,17071ULL,4533ULL,12644ULL,3473ULL,7402ULL,2730ULL,14544ULL,14608ULL,8386ULL,3840ULL,13773ULL,3735ULL,6124ULL,6009ULL,14309ULL,11533ULL,309ULL,17770ULL,8581ULL,15412ULL,1650ULL,4334ULL,3765ULL,13576ULL,2726ULL,17237ULL,12588ULL,4309ULL,15988ULL,951ULL,286ULL,997ULL,15399ULL,5794ULL,16202ULL,13556ULL,16191ULL,7137ULL,10636ULL,9750ULL,7177ULL,2139ULL,11517ULL,11081ULL,9690ULL,10706ULL,8705ULL,5661ULL,8971ULL,1690ULL,14270ULL,5532ULL,17480ULL,10277ULL,16426ULL,10212ULL,280ULL,14253ULL,12369ULL,8895ULL,15991ULL,12756ULL,1801ULL,8663ULL,6288ULL,6194ULL,4964ULL,12793ULL,18365ULL,8915ULL,2526ULL,4423ULL,3753ULL,3222ULL,15099ULL,5006ULL,12166ULL,2709ULL,5641ULL,4003ULL,10023ULL,12318ULL,10973ULL,8669ULL,11465ULL,9224ULL,1863ULL,13004ULL,732ULL,4872ULL,1000ULL,8771ULL,7309ULL,5435ULL,4445ULL,16591ULL,14332ULL,9873ULL,11924ULL,8955ULL,12462ULL,6190ULL,7657ULL,10773ULL,14288ULL,2630ULL,8137ULL,974ULL,17059ULL,12612ULL,6584ULL,9675ULL,6980ULL,1130ULL,4197ULL,17660ULL};
-inline constexpr PsiTables tables_1024_18433{1024, 18433, psi_1024_18433, psi_inv_1024_18433, twist_1024_18433, twist_inv_1024_18433};
+inline constexpr twiddle_t twist_1024_18433[1024] = {1,17660,7673,4197,18360,1130,11294,6980,5329,9675,5023,6584,16509,12612,1981,17059,11421,974,2851,8137,14185,2630,13073,14288,15176,10773,4187,7657,16565,6190,7710,12462,7333,8955,8593,11924,17681,9873,17866,14332,18030,16591,4525,4445,10986,5435,1469,7309,9074,8771,3361,1000,1186,4872,12709,732,5587,13004,12326,1863,16108,9224,3419,11465,3828,8669,8475,10973,15484,12318,8047,10023,12514,4003,2425,5641,8128,2709,7305,12166,14945,5006,1292,15099,14995,3222,16282,3753,11345,4423,9559,2526,1300,8915,2647,18365,15698,12793,9532,4964,15325,6194,4618,6288,5688,8663,13113,1801,8735,12756,1267,15991,7500,8895,18107,12369,5490,14253,5365,280,4756,10212,13881,16426,3039,10277,502,17480,17782,5532,220,14270,10657,1690,2373,8971,14658,5661,11101,8705,17513,10706,679,9690,11861,11081,5732,11517,498,2139,5523,7177,512,9750,2347,10636,17923,7137,12999,16191,364,13556,9589,16202,10294,5794,457,15399,4291,997,3505,286,118,951,2197,15988,9819,4309,5516,12588,2100,17237,2858,2726,12597,13576,12562,3765,2069,4334,4624,1650,14860,15412,12675,8581,2767,17770,14808,309,772,11533,6563,14309,17376,6009,159,6124,3429,3735,6826,13773,7745,3840,17826,8386,6038,14608,7445,14544,1618,2730,9505,7402,10917,3473,6589,12644,14111,4533,16694,17071,2145,885,16349,7261,9312,9127,4668,4504,2245,15750,9463,3002,2012,11529,9655,2050,588,6301,14072,16247,12375,852,4992,12114,18275,11536,4244,462,11534,5790,3549,3140,5936,1289,17418,10409,9064,16501,363,14329,1916,12005,10367,4664,7596,8419,17395,9755,16915,12135,2042,6772,216,17362,16831,3335,2665,4451,6348,14607,8218,6871,15854,2803,8375,14541,3937,16577,15347,7621,7527,6457,4082,15090,3519,7897,15375,4410,1175,13375,2038,9864,6390,574,17123,17248,12788,13397,3465,12773,6559,17401,5117,7654,451,1604,13552,12681,3943,11939,6086,14370,7089,13237,16547,1671,17060,10648,8647,7048,8064,15315,13924,1620,1184,6418,15796,10771,5733,10744,8171,6336,5450,8307,11806,16730,7676,1878,4513,13721,11075,10370,2345,12182,2577,17176,13145,13931,14642,18029,17364,15285,248,11059,4305,8608,329,3745,17529,16771,12849,3110,10693,10728,2106,12599,12030,9475,12159,1923,6594,8779,15610,7085,16329,4288,3316,17352,6128,337,15994,5181,13481,12265,12150,8880,11269,7872,16267,15348,6848,15200,10654,4009,16220,14813,14877,2271,14085,6198,1526,114,4043,8371,17633,10111,18222,15639,3101,17650,15403,1199,13256,1860,18427,4638,9261,11684,438,11653,5968,13419,4892,15682,6728,15795,11544,16493,6547,8244,5206,12589,1327,6477,7055,2653,13727,6437,1109,9094,11744,9357,11208,18159,9039,17393,11301,1569,3741,2188,4512,14494,3402,6173,2418,11052,9716,10196,7816,4256,9619,11445,855,2673,16700,12433,11317,7634,15911,14041,3344,14141,18209,7255,13950,18388,16352,4942,13898,3285,4449,7894,17694,18257,7017,13594,17081,12848,3883,3020,6531,2179,11469,736,2495,6830,10681,1571,2195,17534,12906,14348,5662,10328,16378,3277,10633,1809,2551,408,16410,15407,16540,7082,215,18135,9158,17571,2738,3321,13487,7627,2889,15629,10831,14652,10299,1929,1956,17951,3926,6647,4676,16753,8330,12460,8879,12042,199,12070,15421,5718,3906,3674,17113,6545,9790,8293,4195,1473,4217,2900,7126,3069,5520,9496,14359,15592,2566,7246,2474,4630,15445,5599,3728,12237,15361,15232,4351,9916,3060,12477,14171,13452,16249,10829,16198,13386,11968,2102,15691,18204,11120,12451,15836,16717,17725,12727,5251,14670,14818,11012,3770,16637,5833,7176,1285,2077,16583,10709,16793,14276,6019,10862,9122,8533,3005,18126,16115,3813,1831,3978,3317,16579,13801,4534,15921,6311,6342,812,17479,122,16292,14456,14343,9527,8829,13826,3642,4983,638,4517,10629,4901,8725,2053,16702,10887,8230,16028,15765,16301,7499,9668,10434,8172,5563,13123,12504,11733,17860,537,8858,9842,4963,16098,16954,421,6361,4558,15802,6133,14905,17493,7733,13116,17915,13321,6914,1048,948,4516,11402,15661,4528,2126,15572,18026,1250,10699,6090,11278,915,11592,16255,6191,6937,1702,11530,8882,9723,4785,6228,15202,9108,922,6181,14667,17137,6426,9612,16856,2443,10160,17211,4523,5991,14073,15474,1615,5049,4919,13244,11136,83,9573,10137,16557,12374,1625,15752,7917,18348,10406,11383,11915,6205,14548,16959,14989,7860,7110,15437,11783,16076,15527,15945,6192,6164,9375,15727,8809,10853,16079,13208,2098,350,5945,12765,12743,11316,8407,8238,9844,3417,13011,6915,275,8621,8713,11329,16791,15822,9106,2468,9268,6273,17283,4166,5457,2896,10218,9243,7165,9788,9839,7282,11512,4363,640,2971,7542,13295,8579,4313,2424,6414,455,16945,7378,11036,3651,16459,14396,5424,9972,15071,18206,9574,9364,5797,16571,1552,16882,778,6895,15735,2625,16938,12789,12624,11138,16970,6486,98,16411,14634,5780,11279,142,832,2019,6118,8067,12996,77,14211,965,9808,12812,13278,3287,2903,4807,7655,18111,9277,17749,12608,5073,4800,13066,1266,16764,18260,4698,18180,11239,12629,7273,36,9038,18166,3628,15805,3814,1058,11651,7514,16506,14931,15828,4468,11640,16017,5835,5630,16631,10471,16437,12969,2515,9803,16677,11779,735,3268,17590,6484,1644,1065,6240,5926,9019,14420,5305,9794,5201,16454,18261,3925,7420,15436,12556,8403,11330,16018,5062,13303,2395,10398,17567,5830,9495,15132,7919,16802,7319,1344,11769,8465,270,12486,7214,8777,17156,10172,7935,4434,1056,13197,10601,8112,15077,13568,313,16113,5359,4918,14017,3463,14319,9646,9007,5263,5394,14729,6077,2894,11764,12330,17204,9934,7579,3127,15985,12138,18156,11358,12807,17143,1788,351,5172,2005,16940,11243,9537,1099,16824,8746,4253,11938,6859,6697,2892,13310,15417,8810,10080,5319,17405,2025,1480,17239,1312,18072,2558,13430,14822,7920,16029,14992,5541,11696,9595,11564,1033,12543,19,3746,16756,6011,17046,3037,11823,3589,9086,17928,3272,14498,310};
+inline constexpr twiddle_t untwist_1024_18433[1024] = {18415,5580,2902,3597,9343,16084,9303,10051,17800,11900,16033,6680,12129,342,4578,161,5389,6813,7765,7573,11794,12027,13529,8734,2111,9178,11935,5183,15374,8207,18017,18362,3577,15543,11116,1011,18384,15190,9948,12864,12121,2822,9964,7904,1349,5769,18044,9992,17657,931,6318,13751,13646,9330,1681,13447,15721,11235,987,7391,12915,14744,744,8989,15226,17221,7060,4927,2569,14662,7731,18113,7035,12677,14792,4297,13539,5634,4595,13324,16985,6488,16350,575,6080,13799,17199,13880,10522,821,3552,4860,4906,9079,5759,2711,7508,13511,14314,5013,12775,2845,2834,6244,18258,17384,11829,1177,3790,4812,1353,4529,15351,15337,1244,1453,10395,3325,1498,14878,14503,1722,737,11159,6114,3259,3525,13230,9259,5258,10557,8404,12246,938,4148,4430,9175,12865,11811,6757,6692,8409,10696,2180,6221,6955,611,13353,7995,10005,13627,15220,648,1883,6126,17972,13879,10832,15319,6824,4355,13992,12668,17582,5748,6121,1089,12637,8759,12794,15388,3867,17808,9420,10647,17370,16169,1386,12732,16175,17959,17909,14976,2556,259,11875,5350,470,1764,6150,10532,16154,6036,9006,9956,10384,6735,13512,14004,8948,9503,3350,12181,2655,6435,14347,13216,13599,5467,1066,1334,10419,14318,3773,10082,8190,4854,6766,3902,6958,18114,6725,16612,11520,4802,4453,2045,11205,10287,18372,477,18027,15262,6061,1256,16166,2316,927,7558,16444,8301,7310,1159,9370,7714,4950,13872,13002,6207,11295,820,3862,925,8178,8574,14845,6300,898,16548,12927,11024,11098,6591,2853,354,858,10515,2991,12873,9331,1371,17382,12449,11740,10334,3802,1092,11707,2131,2978,16903,13475,7041,10817,1536,3098,16569,6417,1494,16118,17196,14810,17150,10637,2037,13685,15673,7682,14870,16983,7108,8480,7119,5070,13538,5944,660,16596,16480,15574,1506,12398,9117,12412,4777,12203,14268,840,16095,5893,16470,241,17455,8252,4067,11107,3801,1402,7772,5403,2473,7556,17064,431,13854,149,9109,14892,10163,1513,10228,18229,7941,8312,3900,7578,10244,13269,15602,11259,11980,9666,8119,8431,3876,15018,7969,18065,3482,8127,5951,16923,7275,12009,676,11636,5708,88,9586,14486,6992,7574,11484,15962,10257,9239,11458,5589,112,2146,16761,2196,1261,14616,3558,3000,10083,7880,8789,3494,4407,16305,14525,13335,13575,12907,17224,6130,16732,11186,16177,17339,7346,8432,3566,520,4697,137,12829,4538,12561,13886,8662,5998,2353,7890,5689,5978,8553,2922,15830,14311,5943,970,12661,1319,15069,10592,15987,2507,15449,3390,18214,12591,4586,16114,3,17503,11805,8617,1515,9608,7666,1397,9322,4161,400,5031,7195,18376,17670,15334,2174,8081,1778,1810,10323,7212,13106,10833,15009,10759,1083,14497,3582,13993,12358,3084,2476,6626,10436,9048,15369,9757,16775,16289,1052,5674,10628,4827,15136,8255,3137,4479,12418,2917,17380,13069,3870,16878,2792,831,452,7344,9052,14129,7064,3687,18309,1574,9751,202,11112,2251,2644,9845,7928,12342,8044,13248,3679,2356,6960,17494,14595,10068,12530,5063,15708,15265,5131,13061,6350,3831,10535,15224,17841,17623,11471,1559,14401,14909,4893,13109,9903,8381,943,2598,5672,11248,15390,3247,7245,2876,11657,17631,8991,14606,6658,516,5937,2830,7484,2518,12039,9809,655,18146,15238,13501,17414,2529,8629,16228,1529,5268,7457,10888,16392,5988,5453,5406,1543,928,7248,1946,5029,7815,10506,5781,14324,1913,15259,6991,7884,7549,801,9752,18325,15047,17412,3149,759,4339,519,5007,14635,16101,4033,3214,17475,2052,9035,966,13901,4012,9724,8572,15465,16863,7442,15538,12666,18202,16311,12665,79,12376,15937,18007,3029,1093,11397,6066,18139,17408,4389,3452,17427,16932,4485,10558,8094,16181,16099,4653,13777,5586,1042,8774,8144,681,10086,6950,2161,12111,5922,7480,3758,14732,4464,17068,17624,11161,5494,11129,15414,14240,9520,16513,5344,2330,15020,7349,7502,15371,9137,6212,9745,2062,5935,3450,18047,9062,11029,9548,7833,4926,2879,10727,11003,17608,16121,16266,8182,7334,12152,11645,2918,17070,17004,598,17383,12139,15675,7062,4307,10439,8118,8741,18374,18290,7464,8718,7071,1517,8988,15536,13286,10332,4422,11655,18251,1121,2717,5648,255,13115,8043,13558,18177,5628,6455,8147,18184,3458,15567,3676,3286,13588,8877,13080,460,4864,3666,6386,11104,4731,8030,17588,3888,11298,18323,15667,9542,9693,18182,4078,7697,10220,2276,13327,16055,18293,6534,2090,15688,3032,163,4769,14683,1221,8583,12055,4849,8316,2660,4885,15589,15289,16124,15336,1554,15951,13667,2820,10584,34,7893,4759,17783,17170,4437,7005,3544,7340,10292,16822,1719,1667,17787,15930,1744,12350,5564,7862,14369,6396,8004,7215,12176,4205,5193,12274,10691,3730,4979,4882,16519,3484,7507,13821,10379,8285,12270,11931,6423,18067,2862,15997,17840,17933,7536,4831,13896,5562,8482,6499,12940,6994,6954,921,9418,11267,9500,4280,376,12471,4920,4739,5550,12202,14578,15338,934,5388,7123,3830,10845,11289,2680,17118,2124,5148,7791,17946,3506,687,8226,12127,962,15141,6705,4379,6552,14943,12786,17868,9253,7118,5380,9603,9216,155,7249,1636,8964,4543,11011,15128,10735,8523,12222,8378,1873,9226,15488,9733,5782,14014,5848,11987,7496,17231,3960,7411,6715,1279,9036,656,17836,740,10229,17919,11876,5040,4405,16925,6655,1446,12565,12646,5969,11343,4373,8412,9766,13985,14838,8470,10219,2586,9392,894,17788,15620,5679,9078,6069,17209,10780,13006,4967,8602,6165,5882,1447,12255,16581,2697,11848,13720,4823,16376,10948,16225,2459,11896,17273,9373,6784,16755,4056,14517,15815,528,2217,13184,5086,8578,13605,3607,6243,135,13449,15101,672,12876,8401,13176,7566,13964,2915,18000,5199,10414,15868,2531,8009,5665,13418,6278,7718,3710,11179,18347,8227,11817,4897,11869,7210,13726,2963,3120,9749,822,3242,8795,1634,9584,15106,17555,14118,10474,15701,17435,14452,17532,2815,12134,17225,5820,2234,7914,16682,8253,3757,15042,529,1907,17119,1814,9083,4519};
+inline constexpr twiddle_t fwd_layers_1024_18433[1023] = {1,1,6531,1,18275,6531,350,1,17782,18275,10693,6531,6342,350,11779,1,3828,17782,14860,18275,3465,10693,11544,6531,5520,6342,915,350,12624,11779,2894,1,7333,3828,15698,17782,364,14860,10917,18275,2665,3465,8171,10693,16220,11544,7816,6531,2889,5520,17725,6342,17860,915,83,350,4363,12624,1266,11779,16802,2894,5319,1,11421,7333,9074,3828,14945,15698,7500,17782,11861,364,9819,14860,3429,10917,2245,18275,1916,2665,4082,3465,16547,8171,13145,10693,6128,16220,15403,11544,11208,7816,13950,6531,10633,2889,199,5520,3060,17725,6019,6342,8725,17860,17915,915,17137,83,7860,350,15822,4363,5424,12624,14211,1266,7514,11779,3925,16802,8112,2894,2005,5319,11564,1,5329,11421,15176,7333,18030,9074,5587,3828,12514,14945,11345,15698,5688,7500,4756,17782,14658,11861,512,364,4291,9819,12597,14860,772,3429,6038,10917,2145,2245,588,18275,5936,1916,16915,2665,8375,4082,2038,3465,13552,16547,13924,8171,4513,13145,4305,10693,6594,6128,11269,16220,4043,15403,438,11544,7055,11208,4512,7816,11317,13950,17694,6531,2195,10633,215,2889,3926,199,9790,5520,15445,3060,11968,17725,5833,6019,1831,6342,8829,8725,7499,17860,6361,17915,4528,915,9723,17137,5991,83,18348,7860,6164,350,3417,15822,2896,4363,6414,5424,1552,12624,11279,14211,7655,1266,36,7514,5630,11779,5926,3925,13303,16802,8777,8112,3463,2894,12138,2005,11938,5319,13430,11564,3037,1,18360,5329,16509,11421,14185,15176,16565,7333,17681,18030,10986,9074,1186,5587,16108,3828,15484,12514,8128,14945,14995,11345,1300,15698,15325,5688,8735,7500,5490,4756,3039,17782,10657,14658,17513,11861,498,512,17923,364,10294,4291,118,9819,2100,12597,2069,14860,2767,772,17376,3429,7745,6038,1618,10917,14111,2145,9312,2245,2012,588,12375,18275,11534,5936,9064,1916,7596,16915,216,2665,8218,8375,15347,4082,15375,2038,17123,3465,5117,13552,6086,16547,8647,13924,15796,8171,11806,4513,2345,13145,17364,4305,17529,10693,12030,6594,16329,6128,13481,11269,6848,16220,14085,4043,18222,15403,18427,438,4892,11544,5206,7055,1109,11208,11301,4512,2418,7816,855,11317,3344,13950,13898,17694,17081,6531,2495,2195,5662,10633,16410,215,2738,2889,10299,3926,8330,199,3906,9790,4217,5520,2566,15445,15361,3060,16249,11968,11120,17725,14818,5833,16583,6019,3005,1831,13801,6342,16292,8829,638,8725,8230,7499,5563,17860,4963,6361,14905,17915,948,4528,1250,915,6937,9723,9108,17137,2443,5991,5049,83,12374,18348,6205,7860,16076,6164,10853,350,11316,3417,8621,15822,6273,2896,9788,4363,13295,6414,11036,5424,9574,1552,15735,12624,98,11279,6118,14211,13278,7655,12608,1266,18180,36,15805,7514,4468,5630,12969,11779,6484,5926,9794,3925,8403,13303,5830,16802,8465,8777,4434,8112,16113,3463,5263,2894,9934,12138,17143,2005,1099,11938,13310,5319,17239,13430,14992,11564,3746,3037,17928,1,7673,18360,11294,5329,5023,16509,1981,11421,2851,14185,13073,15176,4187,16565,7710,7333,8593,17681,17866,18030,4525,10986,1469,9074,3361,1186,12709,5587,12326,16108,3419,3828,8475,15484,8047,12514,2425,8128,7305,14945,1292,14995,16282,11345,9559,1300,2647,15698,9532,15325,4618,5688,13113,8735,1267,7500,18107,5490,5365,4756,13881,3039,502,17782,220,10657,2373,14658,11101,17513,679,11861,5732,498,5523,512,2347,17923,12999,364,9589,10294,457,4291,3505,118,2197,9819,5516,2100,2858,12597,12562,2069,4624,14860,12675,2767,14808,772,6563,17376,159,3429,6826,7745,17826,6038,7445,1618,9505,10917,6589,14111,16694,2145,16349,9312,4668,2245,9463,2012,9655,588,14072,12375,4992,18275,4244,11534,3549,5936,17418,9064,363,1916,10367,7596,17395,16915,2042,216,16831,2665,6348,8218,15854,8375,3937,15347,7527,4082,3519,15375,1175,2038,6390,17123,12788,3465,6559,5117,451,13552,3943,6086,7089,16547,17060,8647,8064,13924,1184,15796,5733,8171,5450,11806,7676,4513,11075,2345,2577,13145,14642,17364,248,4305,329,17529,12849,10693,2106,12030,12159,6594,15610,16329,3316,6128,15994,13481,12150,11269,16267,6848,10654,16220,14877,14085,1526,4043,17633,18222,3101,15403,13256,18427,9261,438,5968,4892,6728,11544,6547,5206,1327,7055,13727,1109,11744,11208,9039,11301,3741,4512,3402,2418,9716,7816,9619,855,16700,11317,15911,3344,18209,13950,16352,13898,4449,17694,7017,17081,3883,6531,11469,2495,10681,2195,12906,5662,16378,10633,2551,16410,16540,215,9158,2738,13487,2889,10831,10299,1956,3926,4676,8330,8879,199,15421,3906,17113,9790,4195,4217,7126,5520,14359,2566,2474,15445,3728,15361,4351,3060,14171,16249,16198,11968,15691,11120,15836,17725,5251,14818,3770,5833,1285,16583,16793,6019,9122,3005,16115,1831,3317,13801,15921,6342,17479,16292,14343,8829,3642,638,10629,8725,16702,8230,15765,7499,10434,5563,12504,17860,8858,4963,16954,6361,15802,14905,7733,17915,6914,948,11402,4528,15572,1250,6090,915,16255,6937,11530,9723,6228,9108,6181,17137,9612,2443,17211,5991,15474,5049,13244,83,10137,12374,15752,18348,11383,6205,16959,7860,15437,16076,15945,6164,15727,10853,13208,350,12765,11316,8238,3417,6915,8621,11329,15822,2468,6273,4166,2896,9243,9788,7282,4363,2971,13295,4313,6414,16945,11036,16459,5424,15071,9574,5797,1552,778,15735,16938,12624,16970,98,14634,11279,832,6118,12996,14211,9808,13278,2903,7655,9277,12608,4800,1266,18260,18180,12629,36,18166,15805,1058,7514,14931,4468,16017,5630,10471,12969,9803,11779,3268,6484,1065,5926,14420,9794,16454,3925,15436,8403,16018,13303,10398,5830,15132,16802,1344,8465,12486,8777,10172,4434,13197,8112,13568,16113,4918,3463,9646,5263,14729,2894,12330,9934,3127,12138,11358,17143,351,2005,11243,1099,8746,11938,6697,13310,8810,5319,2025,17239,18072,13430,7920,14992,11696,11564,12543,3746,6011,3037,3589,17928,14498};
+inline constexpr twiddle_t inv_layers_1024_18433[1023] = {1,1,11902,1,18083,11902,158,1,6654,18083,12091,11902,7740,158,651,1,15539,6654,5809,18083,17518,12091,12913,11902,6889,7740,14968,158,3573,651,14605,1,13114,15539,1631,6654,17167,5809,14070,18083,18350,17518,573,12091,708,12913,15544,11902,10617,6889,2213,7740,10262,14968,15768,158,7516,3573,18069,651,2735,14605,11100,1,6869,13114,16428,15539,10321,1631,14508,6654,10919,17167,4222,5809,13009,14070,2611,18083,10573,18350,1296,17518,518,573,9708,12091,12414,708,15373,12913,18234,15544,7800,11902,4483,10617,7225,6889,3030,2213,12305,7740,5288,10262,1886,14968,14351,15768,16517,158,16188,7516,15004,3573,8614,18069,6572,651,10933,2735,3488,14605,9359,11100,7012,1,15396,6869,5003,13114,6495,16428,6295,15539,14970,10321,9656,1631,5130,14508,12507,6654,12803,10919,18397,17167,10778,4222,7154,5809,16881,13009,12019,14070,15537,2611,15016,18083,12269,10573,85,18350,12442,1296,8710,17518,13905,518,12072,573,10934,9708,9604,12091,16602,12414,12600,708,6465,15373,2988,12913,8643,18234,14507,15544,18218,7800,16238,11902,739,4483,7116,10617,13921,7225,11378,6889,17995,3030,14390,2213,7164,12305,11839,7740,14128,5288,13920,10262,4509,1886,4881,14968,16395,14351,10058,15768,1518,16517,12497,158,17845,16188,16288,7516,12395,15004,17661,3573,5836,8614,14142,18069,17921,6572,3775,651,13677,10933,12745,2735,7088,3488,5919,14605,12846,9359,403,11100,3257,7012,13104,1,505,15396,14687,6869,3441,5003,1194,13114,5123,6495,17334,16428,1290,6295,8499,15539,13170,14970,2320,10321,13999,9656,9968,1631,12603,5130,10030,14508,8639,12507,11949,6654,5464,12803,13965,10919,2628,18397,253,17167,5825,10778,5155,4222,12315,7154,18335,5809,2698,16881,8859,13009,7397,12019,5138,14070,8645,15537,12160,2611,9812,15016,7117,18083,7580,12269,2357,10573,12228,85,6059,18350,13384,12442,15990,1296,9325,8710,11496,17518,17183,13905,17485,518,3528,12072,13470,573,12870,10934,10203,9708,17795,9604,2141,12091,4632,16602,15428,12414,1850,12600,3615,708,7313,6465,2184,15373,3072,2988,15867,12913,14216,8643,14527,18234,10103,14507,8134,15544,15695,18218,2023,7800,12771,16238,15938,11902,1352,739,4535,4483,15089,7116,17578,10617,16015,13921,7132,7225,17324,11378,13227,6889,13541,17995,6,3030,211,14390,4348,2213,11585,7164,4952,12305,2104,11839,6403,7740,904,14128,1069,5288,16088,13920,6627,10262,2637,4509,9786,1886,12347,4881,13316,14968,1310,16395,3058,14351,3086,10058,10215,15768,18217,1518,10837,16517,9369,12497,6899,158,6058,17845,16421,16188,9121,16288,4322,7516,16815,12395,10688,15004,1057,17661,15666,3573,16364,5836,16333,8614,18315,14142,8139,18069,510,17921,17935,6572,920,3775,7776,651,15394,13677,12943,10933,9698,12745,3108,2735,17133,7088,3438,3488,10305,5919,2949,14605,2325,12846,17247,9359,7447,403,752,11100,1868,3257,4248,7012,1924,13104,73,1,3935,505,14844,15396,12422,14687,5890,6869,6737,3441,10513,5003,361,1194,16408,13114,9623,5123,11736,6495,9687,17334,7190,16428,18082,1290,7075,6295,15306,8499,6103,15539,3704,13170,8787,14970,13515,2320,4865,10321,5236,13999,8261,9656,5947,9968,17089,1631,3301,12603,8035,5130,2415,10030,2997,14508,1979,8639,4013,12507,17368,11949,15165,6654,8630,5464,7962,12803,2416,13965,3502,10919,17375,2628,267,18397,5804,253,173,17167,13633,5825,9156,10778,15530,5155,8625,4222,5437,12315,17601,7154,3799,18335,1463,5809,1495,2698,17655,16881,12636,8859,3362,13009,1974,7397,1488,12019,14120,5138,15462,14070,11151,8645,9190,15537,14267,12160,15965,2611,7104,9812,11518,15016,10195,7117,5668,18083,5225,7580,2706,12269,2488,2357,2996,10573,1474,12228,7050,85,2681,6059,8296,18350,5189,13384,2959,12442,1222,15990,8821,1296,12252,9325,12205,8710,6903,11496,2178,17518,12343,17183,2861,13905,7031,17485,11519,518,10700,3528,2631,12072,1479,13470,9575,573,5929,12870,7999,10934,2668,10203,1731,9708,7804,17795,14791,9604,4090,2141,954,12091,2512,4632,15116,16602,2318,15428,9311,12414,1640,1850,17148,12600,14663,3615,13182,708,2597,7313,2742,6465,2235,2184,4262,15373,14082,3072,14705,2988,15959,15867,4074,12913,11307,14216,14238,8643,1320,14527,3012,18234,9554,10103,13757,14507,16477,8134,7602,15544,4946,15695,9275,18218,1893,2023,15882,7800,2055,12771,5527,16238,7752,15938,6964,11902,14550,1352,11416,739,13984,4535,2081,4483,224,15089,2522,7116,1733,17578,8814,10617,8717,16015,15031,13921,14692,7132,9394,7225,6689,17324,4706,11378,17106,13227,11886,6889,11705,13541,12465,17995,9172,6,5177,3030,15332,211,800,14390,16907,4348,3556,2213,7779,11585,2166,7164,6283,4952,2439,12305,15117,2104,2823,11839,6274,6403,16327,7740,5584,904,18104,14128,18185,1069,3791,5288,15856,16088,7358,13920,10757,6627,12983,10262,12700,2637,17249,4509,10369,9786,1373,1886,11344,12347,14490,4881,17982,13316,11874,14968,5645,1310,12043,16395,17258,3058,14914,14351,10906,3086,14496,10058,2579,10215,12085,15768,1602,18217,16391,1518,1038,10837,8066,16517,18070,9369,1015,12497,14884,6899,14189,158,13441,6058,4361,17845,8778,16421,8970,16188,13765,9121,2084,16288,1739,4322,11844,7516,8928,16815,10988,12395,607,10688,11607,15004,18274,1057,11870,17661,3625,15666,5758,3573,13809,16364,5871,5836,15575,16333,12917,8614,16236,18315,14928,14142,17976,8139,8844,18069,5434,510,16086,17921,12910,17935,12701,6572,17754,920,7332,3775,16060,7776,18213,651,17931,15394,4552,13677,13068,12943,326,10933,17166,9698,5320,12745,13815,3108,8901,2735,15786,17133,8874,7088,2151,3438,17141,3488,11128,10305,16008,5919,10386,2949,9958,14605,15014,2325,6107,12846,5724,17247,15072,9359,16964,7447,13908,403,567,752,9840,11100,10723,1868,14246,3257,5360,4248,15582,7012,16452,1924,13410,13104,7139,73,10760};
+inline constexpr PsiTables tables_1024_18433{1024, 18433, psi_1024_18433, psi_inv_1024_18433, twist_1024_18433, untwist_1024_18433, fwd_layers_1024_18433, inv_layers_1024_18433};
 
 inline constexpr const PsiTables* getPsiTables(std::size_t n, std::uint64_t q) {
     if (n == 8 && q == 7681) return &tables_8_7681;
@@ -54,6 +79,15 @@ inline constexpr const PsiTables* getPsiTables(std::size_t n, std::uint64_t q) {
     return nullptr;
 }
 
+/** @brief True if getPsiTables(n, q) is non-null; usable in constant expressions. */
+inline constexpr bool hasPsiTables(std::size_t n, std::uint64_t q) {
+    return (n == 8 && q == 7681) ||
+           (n == 32 && q == 7681) ||
+           (n == 256 && q == 7681) ||
+           (n == 512 && q == 12289) ||
+           (n == 1024 && q == 18433);
+}
+
 } // namespace ntt_tables
 
 #endif // NTT_TABLES_H
@@ -0,0 +1,201 @@
+#ifndef POLY_BATCH_H
+#define POLY_BATCH_H
+
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+
+#include <polynomial.h>
+#include <prepared_polynomial.h>
+
+/**
+ * @brief Batch operations over collections of polynomials, parallelized with OpenMP.
+ *
+ * Bulk jobs (rotating a keyset, replaying stored signatures) apply the
+ * same operation to many independent polynomials. The functions here
+ * spread those items over an OpenMP thread team; every item is still
+ * processed by one thread with the ordinary BasicPolynomial operations,
+ * so its scratch buffers come from that thread's poly_memory pool and the
+ * results are identical to a serial loop. The ring's NTT is resolved
+ * once per call and bound in every item (NTT::RingScope), so workers do
+ * not contend on the NTT registry lock.
+ *
+ * Inputs are only read through valuesView(), never through the lazily
+ * converting observers, so a batch may name the same polynomial several
+ * times and inputs in the NTT domain stay there. Collections are passed as
+ * pointer and count (std::span is C++20), with std::vector overloads. If
+ * an item throws, the remaining items still run and the first exception
+ * is rethrown on the calling thread.
+ *
+ * Without OpenMP support at build time everything runs serially. The
+ * functions are explicitly instantiated for uint16_t, uint32_t and
+ * uint64_t coefficients in poly_batch.cpp.
+ */
+namespace poly_batch {
+
+/**
+ * @brief Parallelization settings of one batch call.
+ */
+struct Options {
+    /**
+     * @brief Number of threads; 0 uses the OpenMP default
+     *        (OMP_NUM_THREADS or the number of cores).
+     */
+    int threads = 0;
+
+    /**
+     * @brief Items handed to a thread at a time (dynamic schedule).
+     *
+     * Batches of at most @c grain items run on the calling thread alone.
+     * Raise it for small rings, where one item is too little work to be
+     * worth a scheduling step.
+     */
+    std::size_t grain = 1;
+};
+
+/** @return Threads an Options with threads == 0 would use (1 without OpenMP). */
+int defaultThreads();
+
+/**
+ * @brief Element-wise sums a[i] + b[i].
+ *
+ * @throws std::invalid_argument If some pair is not in the same ring.
+ */
+template<typename Coeff>
+std::vector<BasicPolynomial<Coeff>> addMany(const BasicPolynomial<Coeff>* a,
+                                            const BasicPolynomial<Coeff>* b, std::size_t count,
+                                            const Options& options = {});
+
+/**
+ * @copydoc addMany(const BasicPolynomial<Coeff>*, const BasicPolynomial<Coeff>*, std::size_t, const Options&)
+ *
+ * @throws std::invalid_argument Also if the vectors differ in length.
+ */
+template<typename Coeff>
+std::vector<BasicPolynomial<Coeff>> addMany(const std::vector<BasicPolynomial<Coeff>>& a,
+                                            const std::vector<BasicPolynomial<Coeff>>& b,
+                                            const Options& options = {}) {
+    if (a.size() != b.size()) {
+        throw std::invalid_argument("Batch operands must have the same length");
+    }
+    return addMany(a.data(), b.data(), a.size(), options);
+}
+
+/**
+ * @brief Element-wise ring products a[i] * b[i].
+ *
+ * Results follow operator*: they stay in the NTT domain in rings with
+ * NTT tables.
+ *
+ * @throws std::invalid_argument If some pair is not in the same ring.
+ */
+template<typename Coeff>
+std::vector<BasicPolynomial<Coeff>> multiplyMany(const BasicPolynomial<Coeff>* a,
+                                                 const BasicPolynomial<Coeff>* b, std::size_t count,
+                                                 const Options& options = {});
+
+/**
+ * @copydoc multiplyMany(const BasicPolynomial<Coeff>*, const BasicPolynomial<Coeff>*, std::size_t, const Options&)
+ *
+ * @throws std::invalid_argument Also if the vectors differ in length.
+ */
+template<typename Coeff>
+std::vector<BasicPolynomial<Coeff>> multiplyMany(const std::vector<BasicPolynomial<Coeff>>& a,
+                                                 const std::vector<BasicPolynomial<Coeff>>& b,
+                                                 const Options& options = {}) {
+    if (a.size() != b.size()) {
+        throw std::invalid_argument("Batch operands must have the same length");
+    }
+    return multiplyMany(a.data(), b.data(), a.size(), options);
+}
+
+/**
+ * @brief Products polys[i] * fixed with one shared prepared operand.
+ *
+ * @throws std::invalid_argument If some polynomial is not in the ring of @p fixed.
+ */
+template<typename Coeff>
+std::vector<BasicPolynomial<Coeff>> multiplyMany(const BasicPolynomial<Coeff>* polys, std::size_t count,
+                                                 const PreparedPolynomial& fixed,
+                                                 const Options& options = {});
+
+/** @copydoc multiplyMany(const BasicPolynomial<Coeff>*, std::size_t, const PreparedPolynomial&, const Options&) */
+template<typename Coeff>
+std::vector<BasicPolynomial<Coeff>> multiplyMany(const std::vector<BasicPolynomial<Coeff>>& polys,
+                                                 const PreparedPolynomial& fixed,
+                                                 const Options& options = {}) {
+    return multiplyMany(polys.data(), polys.size(), fixed, options);
+}
+
+/** @brief BasicPolynomial::polySignal() of every polynomial. */
+template<typename Coeff>
+std::vector<BasicPolynomial<Coeff>> signalMany(const BasicPolynomial<Coeff>* polys, std::size_t count,
+                                               const Options& options = {});
+
+/** @copydoc signalMany(const BasicPolynomial<Coeff>*, std::size_t, const Options&) */
+template<typename Coeff>
+std::vector<BasicPolynomial<Coeff>> signalMany(const std::vector<BasicPolynomial<Coeff>>& polys,
+                                               const Options& options = {}) {
+    return signalMany(polys.data(), polys.size(), options);
+}
+
+/** @brief BasicPolynomial::toBytes() of every polynomial. */
+template<typename Coeff>
+std::vector<std::vector<std::uint8_t>> toBytesMany(const BasicPolynomial<Coeff>* polys, std::size_t count,
+                                                   const Options& options = {});
+
+/** @copydoc toBytesMany(const BasicPolynomial<Coeff>*, std::size_t, const Options&) */
+template<typename Coeff>
+std::vector<std::vector<std::uint8_t>> toBytesMany(const std::vector<BasicPolynomial<Coeff>>& polys,
+                                                   const Options& options = {}) {
+    return toBytesMany(polys.data(), polys.size(), options);
+}
+
+/** @brief BasicPolynomial::normInf() of every polynomial. */
+template<typename Coeff>
+std::vector<std::uint64_t> normInfMany(const BasicPolynomial<Coeff>* polys, std::size_t count,
+                                       const Options& options = {});
+
+/** @copydoc normInfMany(const BasicPolynomial<Coeff>*, std::size_t, const Options&) */
+template<typename Coeff>
+std::vector<std::uint64_t> normInfMany(const std::vector<BasicPolynomial<Coeff>>& polys,
+                                       const Options& options = {}) {
+    return normInfMany(polys.data(), polys.size(), options);
+}
+
+/** @brief BasicPolynomial::normL2Squared() of every polynomial. */
+template<typename Coeff>
+std::vector<std::uint64_t> normL2SquaredMany(const BasicPolynomial<Coeff>* polys, std::size_t count,
+                                             const Options& options = {});
+
+/** @copydoc normL2SquaredMany(const BasicPolynomial<Coeff>*, std::size_t, const Options&) */
+template<typename Coeff>
+std::vector<std::uint64_t> normL2SquaredMany(const std::vector<BasicPolynomial<Coeff>>& polys,
+                                             const Options& options = {}) {
+    return normL2SquaredMany(polys.data(), polys.size(), options);
+}
+
+/**
+ * @brief Screen a batch against a centered infinity-norm bound.
+ *
+ * Every polynomial is checked with BasicPolynomial::isBounded(view, bound),
+ * so unreduced values are rejected as well. All items are checked even
+ * after a failure.
+ *
+ * @return Index of the first polynomial that fails, or @p count if all pass.
+ */
+template<typename Coeff>
+std::size_t firstOutOfBound(const BasicPolynomial<Coeff>* polys, std::size_t count, std::uint64_t bound,
+                            const Options& options = {});
+
+/** @copydoc firstOutOfBound(const BasicPolynomial<Coeff>*, std::size_t, std::uint64_t, const Options&) */
+template<typename Coeff>
+std::size_t firstOutOfBound(const std::vector<BasicPolynomial<Coeff>>& polys, std::uint64_t bound,
+                            const Options& options = {}) {
+    return firstOutOfBound(polys.data(), polys.size(), bound, options);
+}
+
+} // namespace poly_batch
+
+#endif // POLY_BATCH_H
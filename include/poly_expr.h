@@ -0,0 +1,493 @@
+#ifndef POLY_EXPR_H
+#define POLY_EXPR_H
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <modulus.h>
+#include <ntt.h>
+#include <ntt_tables.h>
+#include <poly_memory.h>
+#include <polynomial.h>
+
+/**
+ * @brief Opt-in expression templates for fused polynomial arithmetic.
+ *
+ * Wrapping an operand with lazy() turns +, -, * and unary minus into
+ * lightweight expression nodes instead of eager BasicPolynomial
+ * operations. Assigning the expression to a polynomial (or passing it to
+ * evaluateInto()) evaluates it in one go:
+ *
+ *  - every product term is evaluated in the NTT domain, and all of them
+ *    are summed there, so @c a*s + b*r costs four forward transforms and
+ *    a single inverse;
+ *  - the remaining linear terms are added to the inverse-transformed sum,
+ *    with each term reduced on the fly, in one traversal of the output;
+ *  - the result is written straight into the destination polynomial; an
+ *    expression made only of products leaves it in the NTT domain (see
+ *    PolyDomain), and NTT-domain operands of products are used as they are.
+ *
+ * @code
+ *   using poly_expr::lazy;
+ *   Polynomial b = lazy(a) * s + e;       // one output allocation
+ *   poly_expr::evaluateInto(lazy(b) * r + e1 + m, u);  // reuses u's storage
+ * @endcode
+ *
+ * Expressions hold references to their operands and must be evaluated
+ * before those operands are modified or destroyed; in particular, do not
+ * store an expression in an @c auto variable beyond the statement that
+ * builds it. The destination may be one of the operands.
+ *
+ * Rings without NTT tables fall back to the eager BasicPolynomial product
+ * for each product term; linear terms are still fused.
+ */
+namespace poly_expr {
+
+/**
+ * @brief CRTP base class of all expression nodes.
+ *
+ * @tparam Derived Concrete node type.
+ */
+template<typename Derived>
+class Expression {
+public:
+    /** @return The concrete node. */
+    const Derived& self() const { return static_cast<const Derived&>(*this); }
+
+    /**
+     * @brief Evaluate into a new polynomial.
+     *
+     * Enables @c Polynomial p = expr; and @c p = expr;.
+     */
+    template<typename Coeff>
+    operator BasicPolynomial<Coeff>() const;
+};
+
+namespace detail {
+
+/**
+ * @brief Collects the terms of an expression and produces its value.
+ *
+ * Product terms are accumulated in the NTT domain; leaves outside any
+ * product are kept as (coefficients, factor) pairs and folded into the
+ * output in finish().
+ */
+template<typename Coeff>
+class Evaluator {
+public:
+    /// Word type of NTT buffers (see BasicPolynomial::operator*=).
+    using Word = std::conditional_t<(sizeof(Coeff) <= sizeof(std::uint32_t)),
+                                    std::uint32_t, std::uint64_t>;
+
+    /// NTT-domain work buffer, drawn from poly_memory::scratch().
+    using Buffer = std::pmr::vector<Word>;
+
+    Evaluator(std::size_t n, std::uint64_t q)
+        : n_(n), q_(q),
+          mod_(&Modulus::forValue(q)),
+          ntt_(ntt_tables::hasPsiTables(n, q) ? &NTT::forRing(n, q) : nullptr),
+          acc_(poly_memory::scratch()) {}
+
+    /** @return An empty work buffer from the same resource as the accumulator. */
+    Buffer makeBuffer() const { return Buffer(acc_.get_allocator()); }
+
+    /** @return True if products can be formed in the NTT domain. */
+    bool hasNTT() const { return ntt_ != nullptr; }
+
+    const NTT& ntt() const { return *ntt_; }
+
+    std::uint64_t modulus() const { return q_; }
+
+    void requireRing(const BasicPolynomial<Coeff>& p) const {
+        if (p.degree() != n_ || p.getModulus() != q_) {
+            throw std::invalid_argument("Polynomials must be in the same ring");
+        }
+    }
+
+    std::uint64_t reduce(std::uint64_t a) const {
+        return mod_->reduce(a);
+    }
+
+    std::uint64_t add(std::uint64_t a, std::uint64_t b) const {
+        std::uint64_t s = a + b;
+        return s >= q_ ? s - q_ : s;
+    }
+
+    std::uint64_t sub(std::uint64_t a, std::uint64_t b) const {
+        return a >= b ? a - b : a + q_ - b;
+    }
+
+    std::uint64_t mul(std::uint64_t a, std::uint64_t b) const {
+        return mod_->mul(a, b);
+    }
+
+    /** @brief Add factor * p to the result (p must outlive finish()). */
+    void addLinear(const BasicPolynomial<Coeff>& p, std::uint64_t factor) {
+        requireRing(p);
+        linear_.push_back({p.getCoeffs().data(), factor});
+    }
+
+    /** @brief Add factor * p to the result, taking ownership of p. */
+    void addOwned(BasicPolynomial<Coeff>&& p, std::uint64_t factor) {
+        owned_.push_back(std::move(p));
+        addLinear(owned_.back(), factor);
+    }
+
+    /** @brief Add factor * values (NTT domain) to the product accumulator. */
+    void addTransformed(Buffer&& values, std::uint64_t factor) {
+        if (factor != 1) {
+            for (auto& v : values) {
+                v = static_cast<Word>(mul(v, factor));
+            }
+        }
+        if (acc_.empty()) {
+            acc_ = std::move(values);
+            return;
+        }
+        for (std::size_t i = 0; i < n_; ++i) {
+            acc_[i] = static_cast<Word>(add(acc_[i], values[i]));
+        }
+    }
+
+    /** @brief Write the collected value into @p out. */
+    void finish(BasicPolynomial<Coeff>& out) {
+        if (out.degree() != n_ || out.getModulus() != q_) {
+            out = BasicPolynomial<Coeff>(n_, q_);
+        }
+        if (!acc_.empty() && linear_.empty()) {
+            // Only products: the result can stay in the NTT domain.
+            std::copy(acc_.begin(), acc_.end(), out.coeffs.begin());
+            out.value_domain = PolyDomain::NTT;
+            return;
+        }
+        if (!acc_.empty()) {
+            ntt_->inverse(acc_.data(), n_);
+        }
+
+        const std::uint64_t minus_one = q_ - 1;
+        for (std::size_t i = 0; i < n_; ++i) {
+            std::uint64_t v = acc_.empty() ? 0 : acc_[i];
+            for (const Term& t : linear_) {
+                const std::uint64_t c = t.coeffs[i];
+                if (t.factor == 1) {
+                    v = add(v, c);
+                } else if (t.factor == minus_one) {
+                    v = sub(v, c);
+                } else {
+                    v = add(v, mul(c, t.factor));
+                }
+            }
+            out.coeffs[i] = static_cast<Coeff>(v);
+        }
+        out.value_domain = PolyDomain::Coefficient;
+    }
+
+private:
+    struct Term {
+        const Coeff* coeffs;
+        std::uint64_t factor;
+    };
+
+    std::size_t n_;
+    std::uint64_t q_;
+    const Modulus* mod_;
+    const NTT* ntt_;
+    Buffer acc_;
+    std::vector<Term> linear_;
+    std::deque<BasicPolynomial<Coeff>> owned_;  // stable addresses
+};
+
+} // namespace detail
+
+/**
+ * @brief Expression leaf referring to an existing polynomial.
+ */
+template<typename Coeff>
+class Leaf : public Expression<Leaf<Coeff>> {
+public:
+    using coeff_type = Coeff;
+
+    explicit Leaf(const BasicPolynomial<Coeff>& poly) : poly_(&poly) {}
+
+    const BasicPolynomial<Coeff>& anyOperand() const { return *poly_; }
+
+    void collect(detail::Evaluator<Coeff>& ev, std::uint64_t factor) const {
+        ev.addLinear(*poly_, factor);
+    }
+
+    typename detail::Evaluator<Coeff>::Buffer
+    transformed(detail::Evaluator<Coeff>& ev) const {
+        ev.requireRing(*poly_);
+        typename detail::Evaluator<Coeff>::Buffer v = ev.makeBuffer();
+        v.assign(poly_->values().begin(), poly_->values().end());
+        if (poly_->domain() != PolyDomain::NTT) {
+            ev.ntt().forward(v.data(), v.size());
+        }
+        return v;
+    }
+
+    BasicPolynomial<Coeff> evaluate() const { return *poly_; }
+
+private:
+    const BasicPolynomial<Coeff>* poly_;
+};
+
+/**
+ * @brief Sum (Sign = +1) or difference (Sign = -1) of two expressions.
+ */
+template<typename L, typename R, int Sign>
+class Combination : public Expression<Combination<L, R, Sign>> {
+    static_assert(std::is_same<typename L::coeff_type, typename R::coeff_type>::value,
+                  "operands must use the same coefficient type");
+
+public:
+    using coeff_type = typename L::coeff_type;
+
+    Combination(const L& lhs, const R& rhs) : lhs_(lhs), rhs_(rhs) {}
+
+    const BasicPolynomial<coeff_type>& anyOperand() const { return lhs_.anyOperand(); }
+
+    void collect(detail::Evaluator<coeff_type>& ev, std::uint64_t factor) const {
+        lhs_.collect(ev, factor);
+        rhs_.collect(ev, Sign > 0 ? factor : ev.sub(0, factor));
+    }
+
+    typename detail::Evaluator<coeff_type>::Buffer
+    transformed(detail::Evaluator<coeff_type>& ev) const {
+        auto a = lhs_.transformed(ev);
+        auto b = rhs_.transformed(ev);
+        for (std::size_t i = 0; i < a.size(); ++i) {
+            a[i] = static_cast<typename detail::Evaluator<coeff_type>::Word>(
+                Sign > 0 ? ev.add(a[i], b[i]) : ev.sub(a[i], b[i]));
+        }
+        return a;
+    }
+
+private:
+    L lhs_;
+    R rhs_;
+};
+
+template<typename L, typename R>
+using Sum = Combination<L, R, 1>;
+
+template<typename L, typename R>
+using Difference = Combination<L, R, -1>;
+
+/**
+ * @brief Scalar multiple of an expression; also represents negation.
+ */
+template<typename E>
+class Scaled : public Expression<Scaled<E>> {
+public:
+    using coeff_type = typename E::coeff_type;
+
+    Scaled(const E& expr, std::uint64_t scalar, bool negate)
+        : expr_(expr), scalar_(scalar), negate_(negate) {}
+
+    const BasicPolynomial<coeff_type>& anyOperand() const { return expr_.anyOperand(); }
+
+    void collect(detail::Evaluator<coeff_type>& ev, std::uint64_t factor) const {
+        expr_.collect(ev, ev.mul(factor, factorIn(ev)));
+    }
+
+    typename detail::Evaluator<coeff_type>::Buffer
+    transformed(detail::Evaluator<coeff_type>& ev) const {
+        auto a = expr_.transformed(ev);
+        const std::uint64_t f = factorIn(ev);
+        for (auto& v : a) {
+            v = static_cast<typename detail::Evaluator<coeff_type>::Word>(ev.mul(v, f));
+        }
+        return a;
+    }
+
+private:
+    E expr_;
+    std::uint64_t scalar_;
+    bool negate_;
+
+    std::uint64_t factorIn(const detail::Evaluator<coeff_type>& ev) const {
+        const std::uint64_t s = ev.reduce(scalar_);
+        return negate_ ? ev.sub(0, s) : s;
+    }
+};
+
+/**
+ * @brief Ring product of two expressions.
+ */
+template<typename L, typename R>
+class Product : public Expression<Product<L, R>> {
+    static_assert(std::is_same<typename L::coeff_type, typename R::coeff_type>::value,
+                  "operands must use the same coefficient type");
+
+public:
+    using coeff_type = typename L::coeff_type;
+
+    Product(const L& lhs, const R& rhs) : lhs_(lhs), rhs_(rhs) {}
+
+    const BasicPolynomial<coeff_type>& anyOperand() const { return lhs_.anyOperand(); }
+
+    void collect(detail::Evaluator<coeff_type>& ev, std::uint64_t factor) const {
+        if (ev.hasNTT()) {
+            ev.addTransformed(transformed(ev), factor);
+            return;
+        }
+        BasicPolynomial<coeff_type> p = evaluateOperand(lhs_);
+        p *= evaluateOperand(rhs_);
+        ev.addOwned(std::move(p), factor);
+    }
+
+    typename detail::Evaluator<coeff_type>::Buffer
+    transformed(detail::Evaluator<coeff_type>& ev) const {
+        auto a = lhs_.transformed(ev);
+        auto b = rhs_.transformed(ev);
+        for (std::size_t i = 0; i < a.size(); ++i) {
+            a[i] = static_cast<typename detail::Evaluator<coeff_type>::Word>(ev.mul(a[i], b[i]));
+        }
+        return a;
+    }
+
+private:
+    L lhs_;
+    R rhs_;
+
+    template<typename E>
+    static BasicPolynomial<coeff_type> evaluateOperand(const E& expr);
+};
+
+/**
+ * @brief Start an expression from a polynomial.
+ *
+ * @param poly Operand; must outlive the evaluation of the expression.
+ */
+template<typename Coeff>
+Leaf<Coeff> lazy(const BasicPolynomial<Coeff>& poly) {
+    return Leaf<Coeff>(poly);
+}
+
+/// Temporaries would dangle before the expression is evaluated.
+template<typename Coeff>
+Leaf<Coeff> lazy(const BasicPolynomial<Coeff>&& poly) = delete;
+
+/**
+ * @brief Evaluate an expression into an existing polynomial.
+ *
+ * @p out is resized to the expression's ring if necessary; otherwise its
+ * storage is reused and no allocation is made for the result. @p out may
+ * appear in the expression.
+ *
+ * @throws std::invalid_argument If the operands are not all in the same ring.
+ */
+template<typename E>
+void evaluateInto(const Expression<E>& expr, BasicPolynomial<typename E::coeff_type>& out) {
+    const BasicPolynomial<typename E::coeff_type>& first = expr.self().anyOperand();
+    detail::Evaluator<typename E::coeff_type> ev(first.degree(), first.getModulus());
+    expr.self().collect(ev, 1);
+    ev.finish(out);
+}
+
+/**
+ * @brief Evaluate an expression into a new polynomial.
+ *
+ * @throws std::invalid_argument If the operands are not all in the same ring.
+ */
+template<typename E>
+BasicPolynomial<typename E::coeff_type> evaluate(const Expression<E>& expr) {
+    const BasicPolynomial<typename E::coeff_type>& first = expr.self().anyOperand();
+    BasicPolynomial<typename E::coeff_type> out(first.degree(), first.getModulus());
+    evaluateInto(expr, out);
+    return out;
+}
+
+template<typename Derived>
+template<typename Coeff>
+Expression<Derived>::operator BasicPolynomial<Coeff>() const {
+    static_assert(std::is_same<typename Derived::coeff_type, Coeff>::value,
+                  "expression evaluates to a different coefficient type");
+    return evaluate(*this);
+}
+
+template<typename L, typename R>
+template<typename E>
+BasicPolynomial<typename Product<L, R>::coeff_type> Product<L, R>::evaluateOperand(const E& expr) {
+    return evaluate(expr);
+}
+
+namespace detail {
+
+// Maps an operand to its node type: expressions stay as they are and
+// polynomials become leaves.
+template<typename T, typename = void>
+struct node_of {};
+
+template<typename Coeff>
+struct node_of<BasicPolynomial<Coeff>> {
+    using type = Leaf<Coeff>;
+    static type wrap(const BasicPolynomial<Coeff>& p) { return type(p); }
+};
+
+template<typename T>
+struct node_of<T, std::enable_if_t<std::is_base_of<Expression<T>, T>::value>> {
+    using type = T;
+    static const T& wrap(const T& e) { return e; }
+};
+
+template<typename T>
+using node_t = typename node_of<T>::type;
+
+template<typename T>
+constexpr bool is_expression_v = std::is_base_of<Expression<T>, T>::value;
+
+// Operators apply when at least one operand is an expression and both are
+// valid operands; plain polynomial arithmetic stays eager.
+template<typename L, typename R>
+using enable_binary_t = std::enable_if_t<(is_expression_v<L> || is_expression_v<R>),
+                                         std::pair<node_t<L>, node_t<R>>>;
+
+} // namespace detail
+
+/** @brief Lazy sum. */
+template<typename L, typename R, typename = detail::enable_binary_t<L, R>>
+Sum<detail::node_t<L>, detail::node_t<R>> operator+(const L& lhs, const R& rhs) {
+    return {detail::node_of<L>::wrap(lhs), detail::node_of<R>::wrap(rhs)};
+}
+
+/** @brief Lazy difference. */
+template<typename L, typename R, typename = detail::enable_binary_t<L, R>>
+Difference<detail::node_t<L>, detail::node_t<R>> operator-(const L& lhs, const R& rhs) {
+    return {detail::node_of<L>::wrap(lhs), detail::node_of<R>::wrap(rhs)};
+}
+
+/** @brief Lazy ring product. */
+template<typename L, typename R, typename = detail::enable_binary_t<L, R>>
+Product<detail::node_t<L>, detail::node_t<R>> operator*(const L& lhs, const R& rhs) {
+    return {detail::node_of<L>::wrap(lhs), detail::node_of<R>::wrap(rhs)};
+}
+
+/** @brief Lazy negation. */
+template<typename E>
+Scaled<E> operator-(const Expression<E>& expr) {
+    return Scaled<E>(expr.self(), 1, true);
+}
+
+/** @brief Lazy scalar multiple. */
+template<typename E>
+Scaled<E> operator*(const Expression<E>& expr, std::uint64_t scalar) {
+    return Scaled<E>(expr.self(), scalar, false);
+}
+
+/** @brief Lazy scalar multiple. */
+template<typename E>
+Scaled<E> operator*(std::uint64_t scalar, const Expression<E>& expr) {
+    return Scaled<E>(expr.self(), scalar, false);
+}
+
+} // namespace poly_expr
+
+#endif // POLY_EXPR_H
@@ -0,0 +1,131 @@
+#ifndef POLY_MEMORY_H
+#define POLY_MEMORY_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+
+/**
+ * @brief Size-class pool for polynomial work buffers.
+ *
+ * Polynomial buffers come in a handful of sizes: n words of 4 or 8 bytes
+ * for a power-of-two ring dimension n. The pool keeps one free list per
+ * power-of-two block size, so each (n, word size) pair maps to its own
+ * size class, and a buffer released by one multiplication is handed
+ * straight to the next one without touching malloc.
+ *
+ * Requests larger than max_block_bytes or with extended alignment are
+ * forwarded to the upstream resource. Cached blocks are returned upstream
+ * by release() or on destruction.
+ *
+ * A PolyPool is not synchronized; use one per thread (see threadLocal()).
+ */
+class PolyPool : public std::pmr::memory_resource {
+public:
+    /** @brief Smallest block handed out (and smallest size class). */
+    static constexpr std::size_t min_block_bytes = 64;
+
+    /** @brief Largest pooled block; HIGH (n = 1024) needs 8 KiB per buffer. */
+    static constexpr std::size_t max_block_bytes = std::size_t(1) << 20;
+
+    /**
+     * @brief Create an empty pool.
+     *
+     * @param upstream Resource that supplies and finally frees the blocks.
+     */
+    explicit PolyPool(std::pmr::memory_resource* upstream = std::pmr::new_delete_resource());
+
+    ~PolyPool() override;
+
+    PolyPool(const PolyPool&) = delete;
+    PolyPool& operator=(const PolyPool&) = delete;
+
+    /**
+     * @brief Return all cached (free) blocks to the upstream resource.
+     *
+     * Blocks still in use are unaffected and return to the pool when
+     * deallocated.
+     */
+    void release();
+
+    /** @return Number of free blocks currently cached. */
+    std::size_t cachedBlocks() const;
+
+    /** @return This thread's pool, created on first use. */
+    static PolyPool& threadLocal();
+
+private:
+    static constexpr std::size_t class_count = 15;  // 64 B .. 1 MiB
+
+    struct FreeBlock {
+        FreeBlock* next;
+    };
+
+    std::pmr::memory_resource* upstream_;
+    std::array<FreeBlock*, class_count> free_;
+
+    static std::size_t sizeClass(std::size_t bytes);
+
+    void* do_allocate(std::size_t bytes, std::size_t alignment) override;
+    void do_deallocate(void* p, std::size_t bytes, std::size_t alignment) override;
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override;
+};
+
+/**
+ * @brief Memory for the temporary buffers of polynomial arithmetic.
+ *
+ * NTT work vectors in BasicPolynomial products and inverses, NTT::forward
+ * and NTT::inverse on polynomials, and poly_expr evaluation allocate from
+ * the calling thread's scratch resource. By default that is the thread's
+ * PolyPool; setScratch() plugs in any std::pmr::memory_resource, and
+ * RequestScope switches to a per-request arena.
+ */
+namespace poly_memory {
+
+/** @return The calling thread's scratch resource. */
+std::pmr::memory_resource* scratch();
+
+/**
+ * @brief Replace the calling thread's scratch resource.
+ *
+ * @param resource New resource; nullptr restores PolyPool::threadLocal().
+ *                 Must outlive every buffer allocated from it.
+ * @return The previous resource.
+ */
+std::pmr::memory_resource* setScratch(std::pmr::memory_resource* resource);
+
+/**
+ * @brief Reset-per-request arena for server use.
+ *
+ * While a RequestScope is alive, scratch buffers on this thread are carved
+ * from a monotonic arena: allocation is a pointer bump and deallocation is
+ * free. Destroying the scope (or calling reset()) discards everything at
+ * once and hands the arena's chunks back to the thread's PolyPool, so the
+ * next request reuses them. Scopes nest and must be destroyed on the
+ * thread that created them.
+ */
+class RequestScope {
+public:
+    /**
+     * @param initial_bytes Size of the first arena chunk; later chunks grow
+     *                      geometrically.
+     */
+    explicit RequestScope(std::size_t initial_bytes = 64 * 1024);
+
+    ~RequestScope();
+
+    RequestScope(const RequestScope&) = delete;
+    RequestScope& operator=(const RequestScope&) = delete;
+
+    /** @brief Discard every allocation made in this scope so far. */
+    void reset() { arena_.release(); }
+
+private:
+    std::pmr::monotonic_buffer_resource arena_;
+    std::pmr::memory_resource* previous_;
+};
+
+} // namespace poly_memory
+
+#endif // POLY_MEMORY_H
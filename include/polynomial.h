@@ -3,10 +3,27 @@
 
 #include <vector>
 #include <cstdint>
+#include <functional>
+#include <limits>
+#include <memory_resource>
 #include <stdexcept>
 #include <string>
 #include <sstream>
+#include <type_traits>
+#include <utility>
 #include <logging.h>
+#include <modulus.h>
+#include <polynomial_view.h>
+
+namespace poly_expr {
+namespace detail {
+template<typename Coeff>
+class Evaluator;
+} // namespace detail
+} // namespace poly_expr
+
+class PolynomialAccumulator;
+class PreparedPolynomial;
 
 /**
  * @brief Represents a polynomial in the quotient ring Z_q[x]/(x^n + 1).
@@ -19,37 +36,139 @@
  * All coefficients are maintained in the canonical range
  * \f$[0, q-1]\f$ and arithmetic is performed modulo both \f$q\f$
  * and the polynomial modulus \f$x^n + 1\f$ where applicable.
+ *
+ * Coefficients are stored as @p Coeff, which must be able to hold q - 1.
+ * Every parameter set in this library has q < 2^16, so Polynomial16
+ * needs a quarter of the memory of Polynomial; intermediate values are
+ * always computed in 64-bit arithmetic and the NTT works on 32-bit words
+ * for the narrow types. Polynomial (64-bit coefficients) remains the type
+ * used by the KEM interface. Use coeff_type_for_t to pick the narrowest
+ * type for a compile-time modulus.
+ *
+ * Products leave their result in the NTT domain (see PolyDomain) when
+ * NTT tables exist for (n, q): a product of two NTT-domain polynomials is
+ * a single pointwise pass, and sums of NTT-domain polynomials stay there
+ * too, so chains such as @c a*s + b*r pay for one inverse transform in
+ * total. The inverse runs only when coefficients are observed through
+ * operator[], getCoeffs(), view(), polySignal() or toBytes(). Those
+ * observers are const but may convert the storage in place, so a shared
+ * NTT-domain polynomial must be converted (toCoefficients()) before it is
+ * read from several threads at once.
+ *
+ * The member functions are explicitly instantiated for uint16_t,
+ * uint32_t and uint64_t in polynomial.cpp.
+ *
+ * @tparam Coeff Unsigned coefficient storage type.
  */
-class Polynomial {
+template<typename Coeff>
+class BasicPolynomial {
+    static_assert(std::is_unsigned<Coeff>::value && sizeof(Coeff) <= sizeof(uint64_t),
+                  "BasicPolynomial requires an unsigned coefficient type of at most 64 bits");
+
 public:
+    /** @brief Coefficient storage type. */
+    using coeff_type = Coeff;
+
+    /**
+     * @brief Check whether residues modulo @p q fit the coefficient type.
+     *
+     * @param q Coefficient modulus.
+     * @return True if @f$1 \le q@f$ and @f$q - 1@f$ is representable as Coeff.
+     */
+    static bool supportsModulus(uint64_t q) {
+        return q >= 1 && q - 1 <= std::numeric_limits<Coeff>::max();
+    }
+
     /**
      * @brief Construct a zero polynomial in Z_q[x]/(x^n + 1).
      *
      * @param n Ring dimension (number of coefficients).
      * @param q Coefficient modulus.
+     *
+     * @throws std::invalid_argument If supportsModulus(q) is false.
      */
-    Polynomial(size_t n, uint64_t q)
-        : coeffs(n, 0), ring_dim(n), modulus(q) {
-        Logger::log("Created zero polynomial of degree " + std::to_string(n - 1) +
-                    " with modulus " + std::to_string(q));
+    BasicPolynomial(size_t n, uint64_t q)
+        : coeffs(n, 0), ring_dim(n), modulus(checkedModulus(q)),
+          modulus_info(&Modulus::forValue(modulus)) {
+        RLWE_LOG_TRACE("Created zero polynomial of degree " + std::to_string(n - 1) +
+                       " with modulus " + std::to_string(q));
     }
 
     /**
      * @brief Construct a polynomial from a vector of coefficients.
      *
-     * The coefficients are interpreted as elements of Z_q and reduced
-     * modulo @p q when set via setCoefficients().
+     * The coefficients are read as unsigned integers and reduced into the
+     * canonical range [0, q - 1]; values of 2^63 and above are not treated
+     * as negative.
      *
      * @param coefficients Coefficient vector in ascending degree order.
      * @param q Coefficient modulus.
+     *
+     * @throws std::invalid_argument If supportsModulus(q) is false.
      */
-    Polynomial(const std::vector<uint64_t>& coefficients, uint64_t q)
-        : coeffs(coefficients), ring_dim(coefficients.size()), modulus(q) {
-        Logger::log("Created polynomial from coefficients: " +
-                    Logger::vectorToString(coefficients) +
-                    " with modulus " + std::to_string(q));
+    BasicPolynomial(const std::vector<uint64_t>& coefficients, uint64_t q)
+        : coeffs(coefficients.size()), ring_dim(coefficients.size()), modulus(checkedModulus(q)),
+          modulus_info(&Modulus::forValue(modulus)) {
+        for (size_t i = 0; i < ring_dim; ++i) {
+            coeffs[i] = static_cast<Coeff>(modulus_info->reduce(coefficients[i]));
+        }
+        RLWE_LOG_TRACE("Created polynomial from coefficients: " +
+                       Logger::vectorToString(coefficients) +
+                       " with modulus " + std::to_string(q));
     }
 
+    /**
+     * @brief Construct a polynomial by adopting a coefficient vector.
+     *
+     * Same as the copying constructor, but for 64-bit coefficients the
+     * vector's storage is reused.
+     *
+     * @param coefficients Coefficient vector in ascending degree order.
+     * @param q Coefficient modulus.
+     *
+     * @throws std::invalid_argument If supportsModulus(q) is false.
+     */
+    BasicPolynomial(std::vector<uint64_t>&& coefficients, uint64_t q)
+        : ring_dim(coefficients.size()), modulus(checkedModulus(q)),
+          modulus_info(&Modulus::forValue(modulus)) {
+        takeCoefficients(std::move(coefficients));
+        RLWE_LOG_TRACE("Created polynomial from coefficients: " +
+                       Logger::vectorToString(coeffs) +
+                       " with modulus " + std::to_string(q));
+    }
+
+    /**
+     * @brief Convert a polynomial stored with a different coefficient type.
+     *
+     * @param other Polynomial to convert.
+     *
+     * @throws std::invalid_argument If the modulus of @p other does not fit Coeff.
+     */
+    template<typename OtherCoeff,
+             typename = std::enable_if_t<!std::is_same<OtherCoeff, Coeff>::value>>
+    explicit BasicPolynomial(const BasicPolynomial<OtherCoeff>& other)
+        : coeffs(other.getCoeffs().begin(), other.getCoeffs().end()),
+          ring_dim(other.degree()),
+          modulus(checkedModulus(other.getModulus())),
+          modulus_info(&other.getModulusInfo()) {}
+
+    /**
+     * @brief Copy a polynomial out of a view of any coefficient width.
+     *
+     * The copy keeps the view's domain.
+     *
+     * @param view Values in [0, q) with ring parameters.
+     *
+     * @throws std::invalid_argument If the modulus of @p view does not fit Coeff.
+     */
+    template<typename ViewCoeff>
+    explicit BasicPolynomial(const BasicPolynomialView<ViewCoeff>& view)
+        : coeffs(view.begin(), view.end()),
+          value_domain(view.domain()),
+          ring_dim(view.degree()),
+          modulus(checkedModulus(view.getModulus())),
+          modulus_info(&Modulus::forValue(modulus)) {}
+
     /**
      * @brief Access a coefficient by index.
      *
@@ -58,7 +177,8 @@ public:
      *
      * @note No bounds checking is performed.
      */
-    uint64_t& operator[](size_t idx) {
+    Coeff& operator[](size_t idx) {
+        ensureCoefficients();
         return coeffs[idx];
     }
 
@@ -70,7 +190,8 @@ public:
      *
      * @note No bounds checking is performed.
      */
-    const uint64_t& operator[](size_t idx) const {
+    const Coeff& operator[](size_t idx) const {
+        ensureCoefficients();
         return coeffs[idx];
     }
 
@@ -95,45 +216,269 @@ public:
         return modulus;
     }
 
+    /**
+     * @brief Get the interned reduction constants of the modulus.
+     *
+     * @return Modulus object for getModulus().
+     */
+    const Modulus& getModulusInfo() const {
+        return *modulus_info;
+    }
+
+    /**
+     * @brief Get the representation of the stored values.
+     *
+     * @return PolyDomain::NTT after a product in a ring with NTT tables or
+     *         after toNTT(), PolyDomain::Coefficient otherwise.
+     */
+    PolyDomain domain() const {
+        return value_domain;
+    }
+
+    /**
+     * @brief Move the stored values to the NTT domain (no-op if already there).
+     *
+     * @return Reference to this polynomial.
+     *
+     * @throws std::invalid_argument If no NTT tables exist for (n, q).
+     */
+    BasicPolynomial& toNTT();
+
+    /**
+     * @brief Move the stored values to the coefficient domain (no-op if already there).
+     *
+     * @return Reference to this polynomial.
+     */
+    BasicPolynomial& toCoefficients() {
+        ensureCoefficients();
+        return *this;
+    }
+
+    /**
+     * @brief Get the stored values in the current domain without converting.
+     *
+     * @return Coefficients or NTT evaluations, depending on domain().
+     */
+    const std::vector<Coeff>& values() const {
+        return coeffs;
+    }
+
+    /**
+     * @brief Get a non-owning view of the stored values without converting.
+     *
+     * Unlike view(), the result carries the current domain().
+     *
+     * @return View over the coefficients or NTT evaluations.
+     */
+    BasicPolynomialView<Coeff> valuesView() const {
+        return BasicPolynomialView<Coeff>(coeffs.data(), ring_dim, modulus, value_domain);
+    }
+
+    /**
+     * @brief Add another polynomial in place, coefficient-wise modulo q.
+     *
+     * Operands in the same domain are added there; if the domains differ
+     * the NTT-domain operand is converted to coefficients first.
+     *
+     * @param other Polynomial to add.
+     * @return Reference to this polynomial.
+     *
+     * @throws std::invalid_argument If the ring dimension or modulus does not match.
+     */
+    BasicPolynomial& operator+=(const BasicPolynomial& other);
+
+    /**
+     * @brief Add viewed values in place, e.g. straight from an external buffer.
+     *
+     * Domains are handled as in operator+=(const BasicPolynomial&); the
+     * viewed storage is never modified.
+     *
+     * @throws std::invalid_argument If the ring dimension or modulus does not match.
+     */
+    BasicPolynomial& operator+=(const BasicPolynomialView<Coeff>& other);
+
+    /**
+     * @brief Subtract another polynomial in place, coefficient-wise modulo q.
+     *
+     * Domains are handled as in operator+=().
+     *
+     * @param other Polynomial to subtract.
+     * @return Reference to this polynomial.
+     *
+     * @throws std::invalid_argument If the ring dimension or modulus does not match.
+     */
+    BasicPolynomial& operator-=(const BasicPolynomial& other);
+
+    /** @brief Subtract viewed values in place (see operator+=(const BasicPolynomialView<Coeff>&)). */
+    BasicPolynomial& operator-=(const BasicPolynomialView<Coeff>& other);
+
+    /**
+     * @brief Multiply by another polynomial in place in Z_q[x]/(x^n + 1).
+     *
+     * With NTT tables for (n, q) the product is formed pointwise in the
+     * NTT domain and stays there; operands already in the NTT domain are
+     * not transformed again. Otherwise the result is in coefficient form.
+     *
+     * @param other Polynomial to multiply by (may alias *this).
+     * @return Reference to this polynomial.
+     *
+     * @throws std::invalid_argument If the ring dimension or modulus does not match.
+     */
+    BasicPolynomial& operator*=(const BasicPolynomial& other);
+
+    /**
+     * @brief Multiply by viewed values in place.
+     *
+     * An NTT-domain view is used as it is; a coefficient-domain view is
+     * transformed through a scratch copy.
+     *
+     * @throws std::invalid_argument If the ring dimension or modulus does
+     *         not match, or the view is in the NTT domain but the ring has
+     *         no NTT tables.
+     */
+    BasicPolynomial& operator*=(const BasicPolynomialView<Coeff>& other);
+
+    /**
+     * @brief Multiply by a prepared operand in place.
+     *
+     * *this is forward-transformed unless it is in the NTT domain already
+     * and multiplied pointwise by the stored evaluations, using their
+     * Shoup companions when present. The product stays in the NTT domain.
+     * In rings without NTT tables this is the same as operator*=.
+     *
+     * @throws std::invalid_argument If the ring dimension or modulus does not match.
+     */
+    BasicPolynomial& operator*=(const PreparedPolynomial& other);
+
+    /**
+     * @brief Multiply by a scalar in place modulo q.
+     *
+     * @param scalar Multiplier in Z_q.
+     * @return Reference to this polynomial.
+     */
+    BasicPolynomial& operator*=(uint64_t scalar);
+
+    /**
+     * @brief Negate in place modulo q.
+     *
+     * @return Reference to this polynomial.
+     */
+    BasicPolynomial& negate();
+
     /**
      * @brief Add two polynomials coefficient-wise modulo the common modulus.
      *
+     * The overloads taking an rvalue operand reuse its storage for the
+     * result, so chains such as @c a * s + e allocate only once.
+     *
      * @param other Polynomial to add.
-     * @return Sum @f*this + other@f$ modulo @f$q@f$.
+     * @return Sum @f$this + other@f$ modulo @f$q@f$.
      *
      * @throws std::invalid_argument If the ring dimension or modulus does not match.
      */
-    Polynomial operator+(const Polynomial& other) const;
+    BasicPolynomial operator+(const BasicPolynomial& other) const & {
+        BasicPolynomial result(*this);
+        result += other;
+        return result;
+    }
+    BasicPolynomial operator+(const BasicPolynomial& other) && {
+        *this += other;
+        return std::move(*this);
+    }
+    BasicPolynomial operator+(BasicPolynomial&& other) const & {
+        other += *this;
+        return std::move(other);
+    }
+    BasicPolynomial operator+(BasicPolynomial&& other) && {
+        *this += other;
+        return std::move(*this);
+    }
 
     /**
      * @brief Subtract another polynomial coefficient-wise modulo the common modulus.
      *
+     * The overloads taking an rvalue operand reuse its storage for the result.
+     *
      * @param other Polynomial to subtract.
      * @return Difference @f$this - other@f$ modulo @f$q@f$.
      *
      * @throws std::invalid_argument If the ring dimension or modulus does not match.
      */
-    Polynomial operator-(const Polynomial& other) const;
+    BasicPolynomial operator-(const BasicPolynomial& other) const & {
+        BasicPolynomial result(*this);
+        result -= other;
+        return result;
+    }
+    BasicPolynomial operator-(const BasicPolynomial& other) && {
+        *this -= other;
+        return std::move(*this);
+    }
+    BasicPolynomial operator-(BasicPolynomial&& other) const & {
+        other.subtractFrom(valuesView());
+        return std::move(other);
+    }
+    BasicPolynomial operator-(BasicPolynomial&& other) && {
+        *this -= other;
+        return std::move(*this);
+    }
 
     /**
      * @brief Negate the polynomial modulo the coefficient modulus.
      *
      * @return Polynomial whose coefficients are @f$-c_i \bmod q@f$.
      */
-    Polynomial operator-() const;
+    BasicPolynomial operator-() const & {
+        BasicPolynomial result(*this);
+        result.negate();
+        return result;
+    }
+    BasicPolynomial operator-() && {
+        negate();
+        return std::move(*this);
+    }
 
     /**
      * @brief Multiply two polynomials in Z_q[x]/(x^n + 1).
      *
      * The product is reduced modulo both @f$q@f$ and the polynomial
-     * modulus @f$x^n + 1@f$.
+     * modulus @f$x^n + 1@f$. The overloads taking an rvalue operand reuse
+     * its storage for the result.
      *
      * @param other Polynomial to multiply by.
      * @return Product @f$this \cdot other@f$ in the quotient ring.
      *
      * @throws std::invalid_argument If the ring dimension or modulus does not match.
      */
-    Polynomial operator*(const Polynomial& other) const;
+    BasicPolynomial operator*(const BasicPolynomial& other) const & {
+        BasicPolynomial result(*this);
+        result *= other;
+        return result;
+    }
+    BasicPolynomial operator*(const BasicPolynomial& other) && {
+        *this *= other;
+        return std::move(*this);
+    }
+    BasicPolynomial operator*(BasicPolynomial&& other) const & {
+        other *= *this;
+        return std::move(other);
+    }
+    BasicPolynomial operator*(BasicPolynomial&& other) && {
+        *this *= other;
+        return std::move(*this);
+    }
+
+    /**
+     * @brief Multiply by a prepared operand (see operator*=(const PreparedPolynomial&)).
+     */
+    BasicPolynomial operator*(const PreparedPolynomial& other) const & {
+        BasicPolynomial result(*this);
+        result *= other;
+        return result;
+    }
+    BasicPolynomial operator*(const PreparedPolynomial& other) && {
+        *this *= other;
+        return std::move(*this);
+    }
 
     /**
      * @brief Multiply the polynomial by a scalar modulo the coefficient modulus.
@@ -142,17 +487,91 @@ public:
      * @return Scaled polynomial with each coefficient multiplied by @p scalar
      *         modulo @f$q@f$.
      */
-    Polynomial operator*(uint64_t scalar) const;
+    BasicPolynomial operator*(uint64_t scalar) const & {
+        BasicPolynomial result(*this);
+        result *= scalar;
+        return result;
+    }
+    BasicPolynomial operator*(uint64_t scalar) && {
+        *this *= scalar;
+        return std::move(*this);
+    }
+
+    /**
+     * @brief Compute the multiplicative inverse in Z_q[x]/(x^n + 1).
+     *
+     * The polynomial is mapped to the NTT domain, where the ring splits
+     * into n copies of Z_q, and every evaluation is inverted.
+     *
+     * @return Polynomial @f$p^{-1}@f$ with @f$p \cdot p^{-1} = 1@f$.
+     *
+     * @throws std::invalid_argument If no NTT tables exist for (n, q) or the
+     *         polynomial is not invertible (some evaluation is zero).
+     */
+    BasicPolynomial inverse() const;
+
+    /**
+     * @brief Invert many polynomials of the same ring at once.
+     *
+     * All NTT evaluations of all inputs are inverted together with
+     * Montgomery's batch trick, so k polynomials cost k forward and k
+     * inverse NTTs, one scalar inversion and about @f$3kn@f$ modular
+     * multiplications.
+     *
+     * @param polys Polynomials sharing ring dimension and modulus.
+     * @return Inverses in the same order as @p polys.
+     *
+     * @throws std::invalid_argument If the rings differ, no NTT tables exist
+     *         for (n, q), or any input is not invertible.
+     */
+    static std::vector<BasicPolynomial> batchInverse(const std::vector<BasicPolynomial>& polys);
+
+    /**
+     * @brief Sum many polynomials of the same ring with one reduction.
+     *
+     * Runs the terms through a PolynomialAccumulator: each is added to
+     * unreduced 64-bit words and the total is reduced once, instead of
+     * reducing and allocating after every addition as a chain of
+     * operator+ does. The result is in the domain of the first term.
+     * Moduli above 2^63 fall back to repeated operator+=.
+     *
+     * @param polys Pointer to @p count polynomials sharing ring dimension and modulus.
+     * @param count Number of terms (at least one).
+     * @return Sum of all terms modulo q.
+     *
+     * @throws std::invalid_argument If @p count is zero or the rings differ.
+     */
+    static BasicPolynomial sum(const BasicPolynomial* polys, size_t count);
+
+    /** @copydoc sum(const BasicPolynomial*, size_t) */
+    static BasicPolynomial sum(const std::vector<BasicPolynomial>& polys) {
+        return sum(polys.data(), polys.size());
+    }
 
     /**
      * @brief Get a const reference to the internal coefficient vector.
      *
      * @return Coefficient vector in ascending degree order.
      */
-    const std::vector<uint64_t>& getCoeffs() const {
+    const std::vector<Coeff>& getCoeffs() const {
+        ensureCoefficients();
         return coeffs;
     }
 
+    /**
+     * @brief Get a non-owning view of the coefficients.
+     *
+     * The view is invalidated by any operation that reallocates the
+     * coefficient storage or changes its domain, and by destruction of
+     * the polynomial.
+     *
+     * @return View over this polynomial.
+     */
+    BasicPolynomialView<Coeff> view() const {
+        ensureCoefficients();
+        return BasicPolynomialView<Coeff>(coeffs.data(), ring_dim, modulus);
+    }
+
     /**
      * @brief Map coefficients to a binary "signal" representation.
      *
@@ -164,13 +583,69 @@ public:
      *
      * @return Polynomial with coefficients in the set {0, q/2}.
      */
-    Polynomial polySignal() const;
+    BasicPolynomial polySignal() const;
+
+    /**
+     * @brief polySignal() of viewed values, without copying them first.
+     *
+     * NTT-domain values are inverse-transformed in the result's storage.
+     *
+     * @throws std::invalid_argument If the modulus of @p view does not fit Coeff.
+     */
+    static BasicPolynomial polySignal(const BasicPolynomialView<Coeff>& view);
+
+    /**
+     * @brief Centered infinity norm @f$\max_i |c_i|@f$.
+     *
+     * Each coefficient is read as its centered representative in
+     * @f$(-q/2, q/2]@f$, so q - 1 has magnitude 1.
+     *
+     * @return Largest centered magnitude (0 for the zero polynomial).
+     */
+    uint64_t normInf() const;
+
+    /** @brief normInf() of viewed values; NTT-domain values are inverse-transformed in scratch. */
+    static uint64_t normInf(const BasicPolynomialView<Coeff>& view);
+
+    /**
+     * @brief Squared centered L2 norm @f$\sum_i c_i^2@f$.
+     *
+     * Exact in integers, so it can be compared against a squared bound
+     * without rounding. Saturates to UINT64_MAX if it does not fit 64 bits,
+     * which needs a modulus above 2^16 or more than 2^34 coefficients.
+     */
+    uint64_t normL2Squared() const;
+
+    /** @brief normL2Squared() of viewed values (see normInf(const BasicPolynomialView&)). */
+    static uint64_t normL2Squared(const BasicPolynomialView<Coeff>& view);
+
+    /** @return Centered L2 norm, the square root of normL2Squared(). */
+    double normL2() const;
+
+    /**
+     * @brief Check that every centered coefficient has magnitude at most @p bound.
+     *
+     * Equivalent to normInf() <= bound, but a single pass with no early exit.
+     */
+    bool isBounded(uint64_t bound) const;
+
+    /**
+     * @brief Bounds check of untrusted viewed values.
+     *
+     * Unlike normInf(), also rejects coefficient-domain values that are
+     * not reduced below q, so views over decoded or externally supplied
+     * buffers can be screened before any arithmetic.
+     *
+     * @return True if every value is below q with centered magnitude at most @p bound.
+     */
+    static bool isBounded(const BasicPolynomialView<Coeff>& view, uint64_t bound);
 
     /**
      * @brief Replace the polynomial coefficients.
      *
      * The input vector must match the current ring dimension. Each value
-     * is reduced modulo the coefficient modulus @f$q@f$.
+     * is read as an unsigned integer and reduced modulo the coefficient
+     * modulus @f$q@f$, exactly as in the constructors.
      *
      * @param new_coeffs New coefficient vector.
      *
@@ -179,35 +654,198 @@ public:
      */
     void setCoefficients(const std::vector<uint64_t>& new_coeffs);
 
+    /**
+     * @brief Replace the polynomial coefficients, reusing the vector's storage.
+     *
+     * Reduces like the copying overload. For 64-bit coefficients
+     * @p new_coeffs is reduced in place and adopted without copying;
+     * narrower types convert it.
+     *
+     * @param new_coeffs New coefficient vector.
+     *
+     * @throws std::invalid_argument If @p new_coeffs has a different size
+     *         than the ring dimension.
+     */
+    void setCoefficients(std::vector<uint64_t>&& new_coeffs);
+
     /**
      * @brief Convert the polynomial to a human-readable string.
      *
-     * The string contains the ring dimension, modulus, and the coefficient
-     * vector, primarily for logging and debugging.
+     * The string contains the ring dimension, modulus, and the stored
+     * values, primarily for logging and debugging. NTT-domain values are
+     * printed as they are (marked "NTT") rather than converted, so logging
+     * never changes the representation.
      *
      * @return Descriptive string representation.
      */
     std::string toString() const;
 
     /**
-     * @brief Serialize the polynomial to a byte vector.
+     * @brief Serialize the polynomial to its canonical packed encoding.
      *
-     * The byte encoding has the following layout:
-     * - ring dimension (size_t)
-     * - modulus (uint64_t)
-     * - coefficients (uint64_t[ring_dim])
+     * The byte encoding has the following layout, independent of host
+     * endianness and of the coefficient type:
+     * - ring dimension (uint32_t, little-endian)
+     * - modulus (uint64_t, little-endian)
+     * - coefficients, coefficientBits(q) bits each, packed into a
+     *   little-endian bit stream (coefficient 0 in the lowest bits of the
+     *   first byte) and padded with zero bits to a whole byte
      *
-     * All values are written in the native endianness of the host.
+     * A KYBER512 polynomial (13-bit coefficients) takes 12 + 416 bytes.
      *
      * @return Contiguous byte representation of the polynomial.
      */
     std::vector<uint8_t> toBytes() const;
 
+    /**
+     * @brief Canonical packed encoding of viewed values (see toBytes()).
+     *
+     * NTT-domain values are inverse-transformed through a scratch copy.
+     */
+    static std::vector<uint8_t> toBytes(const BasicPolynomialView<Coeff>& view);
+
+    /**
+     * @brief Receives consecutive pieces of an encoding (see writeBytes()).
+     */
+    using ByteSink = std::function<void(const uint8_t* data, size_t size)>;
+
+    /**
+     * @brief Stream the canonical packed encoding of viewed values.
+     *
+     * Emits exactly the bytes of toBytes(view), in order, as the header
+     * followed by chunks of at most a few KiB packed in a stack buffer,
+     * so consumers such as a digest never see a full-size allocation.
+     *
+     * @param view Values to encode; NTT-domain values are inverse-transformed in scratch.
+     * @param sink Called once per piece.
+     *
+     * @throws std::invalid_argument If the ring dimension does not fit 32 bits.
+     */
+    static void writeBytes(const BasicPolynomialView<Coeff>& view, const ByteSink& sink);
+
+    /**
+     * @brief Decode the encoding produced by toBytes().
+     *
+     * Coefficients are unpacked straight into the new polynomial's
+     * storage; no intermediate buffer is built.
+     *
+     * @param data Encoded bytes.
+     * @param size Number of bytes at @p data.
+     * @return Decoded polynomial (coefficient domain).
+     *
+     * @throws std::invalid_argument If the header is malformed, the size
+     *         does not match, the modulus does not fit Coeff, a coefficient
+     *         is not below q, or the padding bits are not zero.
+     */
+    static BasicPolynomial fromBytes(const uint8_t* data, size_t size);
+
+    /** @copydoc fromBytes(const uint8_t*, size_t) */
+    static BasicPolynomial fromBytes(const std::vector<uint8_t>& bytes) {
+        return fromBytes(bytes.data(), bytes.size());
+    }
+
+    /**
+     * @brief Bits per coefficient in the packed encoding.
+     *
+     * @return @f$\lceil \log_2 q \rceil@f$, i.e. the bit length of q - 1
+     *         (at least 1).
+     */
+    static unsigned coefficientBits(uint64_t q);
+
+    /**
+     * @brief Size of toBytes() for a ring.
+     *
+     * @return Header size plus @f$\lceil n \cdot bits / 8 \rceil@f$ bytes.
+     */
+    static size_t packedSize(size_t n, uint64_t q);
+
+    /**
+     * @brief Check whether Compress_d/Decompress_d are defined for a modulus.
+     *
+     * @return True if @f$1 \le d < @f$ coefficientBits(q) and
+     *         coefficientBits(q) + 2d <= 62, the range of the kernels.
+     */
+    static bool supportsCompression(uint64_t q, unsigned d);
+
+    /**
+     * @brief Lossy compression to @p d bits per coefficient (Compress_d).
+     *
+     * Each coefficient x becomes @f$\lfloor 2^d x / q \rceil \bmod 2^d@f$,
+     * keeping only its high-order bits, which is all polySignal() looks at.
+     * The result is a polynomial over the same ring whose coefficients lie
+     * in @f$[0, 2^d)@f$; decompress() with the same @p d maps it back to
+     * within @f$\lceil q / 2^{d+1} \rceil@f$ of the original, cyclically.
+     *
+     * @return This polynomial (coefficient domain).
+     *
+     * @throws std::invalid_argument If supportsCompression(q, d) is false.
+     */
+    BasicPolynomial& compress(unsigned d);
+
+    /**
+     * @brief Inverse of compress() (Decompress_d).
+     *
+     * Each coefficient y < 2^d becomes @f$\lfloor q y / 2^d \rceil@f$.
+     *
+     * @return This polynomial (coefficient domain).
+     *
+     * @throws std::invalid_argument If supportsCompression(q, d) is false
+     *         or a coefficient is not below 2^d.
+     */
+    BasicPolynomial& decompress(unsigned d);
+
+    /**
+     * @brief Serialize a compressed copy of the polynomial.
+     *
+     * Same layout as toBytes() with one extra header byte: ring dimension
+     * (uint32_t), modulus (uint64_t), d (uint8_t), then compress(d)
+     * coefficients packed at @p d bits each. The polynomial itself is not
+     * modified.
+     *
+     * @throws std::invalid_argument If supportsCompression(q, d) is false.
+     */
+    std::vector<uint8_t> toCompressedBytes(unsigned d) const;
+
+    /**
+     * @brief Decode toCompressedBytes() and decompress the result.
+     *
+     * @return Decompressed polynomial (coefficient domain).
+     *
+     * @throws std::invalid_argument If the header is malformed, the size
+     *         does not match, the modulus does not fit Coeff, d is not
+     *         supported for the modulus, or the padding bits are not zero.
+     */
+    static BasicPolynomial fromCompressedBytes(const uint8_t* data, size_t size);
+
+    /** @copydoc fromCompressedBytes(const uint8_t*, size_t) */
+    static BasicPolynomial fromCompressedBytes(const std::vector<uint8_t>& bytes) {
+        return fromCompressedBytes(bytes.data(), bytes.size());
+    }
+
+    /**
+     * @brief Size of toCompressedBytes() for a ring.
+     *
+     * @return Header size plus @f$\lceil n \cdot d / 8 \rceil@f$ bytes.
+     */
+    static size_t compressedSize(size_t n, unsigned d);
+
 private:
+    template<typename>
+    friend class poly_expr::detail::Evaluator;
+    friend class PolynomialAccumulator;
+
     /**
-     * @brief Coefficient storage in ascending degree order.
+     * @brief Stored values: coefficients in ascending degree order, or NTT
+     *        evaluations (see value_domain).
+     *
+     * Mutable so that const observers can convert lazily.
      */
-    std::vector<uint64_t> coeffs;
+    mutable std::vector<Coeff> coeffs;
+
+    /**
+     * @brief Representation of @ref coeffs.
+     */
+    mutable PolyDomain value_domain = PolyDomain::Coefficient;
 
     /**
      * @brief Polynomial ring dimension (number of coefficients).
@@ -220,16 +858,111 @@ private:
     uint64_t modulus;
 
     /**
-     * @brief Reduce an integer modulo a positive modulus.
+     * @brief Interned reduction constants for @ref modulus (never null).
+     */
+    const Modulus* modulus_info;
+
+    /**
+     * @brief Validate that residues modulo @p q fit the coefficient type.
      *
-     * @param x Value to reduce.
-     * @param m Positive modulus.
-     * @return Result in the canonical range @f$[0, m-1]@f$.
+     * @throws std::invalid_argument If supportsModulus(q) is false.
      */
-    static uint64_t mod(int64_t x, uint64_t m) {
-        int64_t r = x % static_cast<int64_t>(m);
-        return r < 0 ? r + m : r;
+    static uint64_t checkedModulus(uint64_t q) {
+        if (!supportsModulus(q)) {
+            throw std::invalid_argument("Modulus does not fit the polynomial coefficient type");
+        }
+        return q;
+    }
+
+    /**
+     * @brief Replace the coefficients with already reduced values.
+     *
+     * @param values Values in [0, q) of any unsigned width, from any
+     *               allocator (e.g. poly_memory scratch buffers).
+     */
+    template<typename Word, typename Alloc>
+    void assignReduced(const std::vector<Word, Alloc>& values);
+
+    /**
+     * @brief Reduce @p values modulo q and make them the coefficients.
+     *
+     * Adopts the vector's storage when Coeff is uint64_t.
+     */
+    void takeCoefficients(std::vector<uint64_t>&& values);
+
+    /**
+     * @brief Inverse-transform the stored values if they are in the NTT domain.
+     */
+    void ensureCoefficients() const {
+        if (value_domain != PolyDomain::Coefficient) {
+            convertToCoefficients();
+        }
+    }
+
+    /**
+     * @brief Out-of-line slow path of ensureCoefficients().
+     */
+    void convertToCoefficients() const;
+
+    /**
+     * @brief Bring the operands of an element-wise operation to one domain.
+     *
+     * Converts *this to coefficients if only it is in the NTT domain;
+     * inverse-transforms a copy of @p other into @p scratch if only
+     * @p other is.
+     *
+     * @return @p other's values in the domain of *this.
+     */
+    const Coeff* alignDomain(const BasicPolynomialView<Coeff>& other,
+                             std::pmr::vector<Coeff>& scratch);
+
+    /**
+     * @brief Replace *this by @p lhs - *this.
+     */
+    void subtractFrom(const BasicPolynomialView<Coeff>& lhs);
+
+    /**
+     * @brief Throw unless @p other is in the same ring.
+     */
+    void requireSameRing(const BasicPolynomialView<Coeff>& other) const {
+        if (ring_dim != other.degree() || modulus != other.getModulus()) {
+            throw std::invalid_argument("Polynomials must be in the same ring");
+        }
     }
 };
 
+/** @brief Polynomial with 64-bit coefficients; the type used by the KEM. */
+using Polynomial = BasicPolynomial<uint64_t>;
+
+/** @brief Polynomial with 32-bit coefficients for moduli up to 2^32. */
+using Polynomial32 = BasicPolynomial<uint32_t>;
+
+/** @brief Polynomial with 16-bit coefficients for moduli up to 2^16. */
+using Polynomial16 = BasicPolynomial<uint16_t>;
+
+/**
+ * @brief Narrowest supported coefficient type for a compile-time modulus.
+ *
+ * @tparam Q Coefficient modulus.
+ */
+template<uint64_t Q>
+struct coeff_type_for {
+    static_assert(Q >= 2, "modulus must be at least 2");
+    using type = std::conditional_t<(Q - 1 <= std::numeric_limits<uint16_t>::max()), uint16_t,
+                 std::conditional_t<(Q - 1 <= std::numeric_limits<uint32_t>::max()), uint32_t,
+                                    uint64_t>>;
+};
+
+/** @brief Shorthand for coeff_type_for<Q>::type. */
+template<uint64_t Q>
+using coeff_type_for_t = typename coeff_type_for<Q>::type;
+
+/** @brief Polynomial type with the narrowest storage for modulus Q. */
+template<uint64_t Q>
+using PolynomialFor = BasicPolynomial<coeff_type_for_t<Q>>;
+
+extern template class BasicPolynomial<uint16_t>;
+extern template class BasicPolynomial<uint32_t>;
+extern template class BasicPolynomial<uint64_t>;
+
 #endif // POLYNOMIAL_H
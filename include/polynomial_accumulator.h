@@ -0,0 +1,145 @@
+#ifndef POLYNOMIAL_ACCUMULATOR_H
+#define POLYNOMIAL_ACCUMULATOR_H
+
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+#include <vector>
+
+#include <polynomial.h>
+#include <polynomial_view.h>
+
+/**
+ * @brief Sum of many polynomials of one ring with a single final reduction.
+ *
+ * Every BasicPolynomial addition reduces each coefficient modulo q. When
+ * many terms are summed (aggregated error terms, batched blinding sums)
+ * that work is wasted: with q < 2^16, a 64-bit word holds the sum of
+ * 2^48 reduced coefficients. The accumulator keeps one unreduced 64-bit
+ * word per coefficient, tracks an upper bound on their values, and adds
+ * each term with a plain vectorized add. It folds the words back below q
+ * only when the next term could overflow them, which for the library's
+ * parameter sets never happens, and once more in result().
+ *
+ * Terms of any coefficient width can be added. The accumulator adopts the
+ * domain of its first term; later terms in the other domain are
+ * transformed through a scratch copy, so summing NTT-domain products
+ * needs no inverse transform until the result is read.
+ */
+class PolynomialAccumulator {
+public:
+    /**
+     * @brief Create an empty accumulator (the zero polynomial) for a ring.
+     *
+     * @param n Ring dimension.
+     * @param q Coefficient modulus.
+     *
+     * @throws std::invalid_argument If supportsModulus(q) is false.
+     */
+    PolynomialAccumulator(std::size_t n, std::uint64_t q);
+
+    /**
+     * @brief Check whether sums modulo @p q can be deferred.
+     *
+     * @return True if @f$1 \le q \le 2^{63}@f$, so that a reduced value
+     *         plus one more term always fits 64 bits.
+     */
+    static bool supportsModulus(std::uint64_t q) {
+        return q >= 1 && q <= (std::uint64_t(1) << 63);
+    }
+
+    /**
+     * @brief Add viewed values.
+     *
+     * @throws std::invalid_argument If the ring dimension or modulus does not match.
+     */
+    template<typename Coeff>
+    PolynomialAccumulator& add(const BasicPolynomialView<Coeff>& term);
+
+    /** @brief Add a polynomial in its current domain (see add(const BasicPolynomialView&)). */
+    template<typename Coeff>
+    PolynomialAccumulator& add(const BasicPolynomial<Coeff>& term) {
+        return add(term.valuesView());
+    }
+
+    /**
+     * @brief Subtract viewed values.
+     *
+     * Each value a is added as q - a, so subtraction also defers reduction.
+     *
+     * @throws std::invalid_argument If the ring dimension or modulus does not match.
+     */
+    template<typename Coeff>
+    PolynomialAccumulator& subtract(const BasicPolynomialView<Coeff>& term);
+
+    /** @brief Subtract a polynomial in its current domain. */
+    template<typename Coeff>
+    PolynomialAccumulator& subtract(const BasicPolynomial<Coeff>& term) {
+        return subtract(term.valuesView());
+    }
+
+    /** @brief Shorthand for add(). */
+    template<typename Term>
+    PolynomialAccumulator& operator+=(const Term& term) {
+        return add(term);
+    }
+
+    /** @brief Shorthand for subtract(). */
+    template<typename Term>
+    PolynomialAccumulator& operator-=(const Term& term) {
+        return subtract(term);
+    }
+
+    /**
+     * @brief Reduce the sum into a polynomial.
+     *
+     * The accumulator is left unchanged and can keep accumulating.
+     *
+     * @return Sum of all terms modulo q, in the accumulator's domain().
+     *
+     * @throws std::invalid_argument If the modulus does not fit Coeff.
+     */
+    template<typename Coeff = std::uint64_t>
+    BasicPolynomial<Coeff> result() const;
+
+    /** @brief Forget all terms; the next term sets the domain again. */
+    void reset();
+
+    /** @return Number of terms added or subtracted since construction or reset(). */
+    std::size_t terms() const { return term_count; }
+
+    /** @return Domain of the accumulated values (Coefficient while empty). */
+    PolyDomain domain() const { return value_domain; }
+
+    /** @return Ring dimension n. */
+    std::size_t degree() const { return ring_dim; }
+
+    /** @return Coefficient modulus q. */
+    std::uint64_t getModulus() const { return modulus; }
+
+private:
+    std::size_t ring_dim;
+    std::uint64_t modulus;
+    PolyDomain value_domain = PolyDomain::Coefficient;
+
+    /** @brief Unreduced sums, one per coefficient. */
+    std::vector<std::uint64_t> sums;
+
+    /** @brief Upper bound on every entry of @ref sums. */
+    std::uint64_t bound = 0;
+
+    std::size_t term_count = 0;
+
+    /**
+     * @brief Check the ring, bring @p term to this domain and make room.
+     *
+     * Reduces @ref sums first if adding @p headroom could overflow them.
+     *
+     * @return @p term's values in domain(), possibly via @p scratch.
+     */
+    template<typename Coeff>
+    const Coeff* prepare(const BasicPolynomialView<Coeff>& term, std::uint64_t headroom,
+                         std::pmr::vector<Coeff>& scratch);
+};
+
+#endif // POLYNOMIAL_ACCUMULATOR_H
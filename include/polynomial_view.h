@@ -0,0 +1,92 @@
+#ifndef POLYNOMIAL_VIEW_H
+#define POLYNOMIAL_VIEW_H
+
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * @brief Representation of a polynomial's stored values.
+ */
+enum class PolyDomain {
+    /** Coefficients c_0, ..., c_{n-1} in ascending degree order. */
+    Coefficient,
+    /** Evaluations at the roots used by the ring's NTT (NTT::forRing). */
+    NTT,
+};
+
+/**
+ * @brief Non-owning, read-only view of a polynomial in Z_q[x]/(x^n + 1).
+ *
+ * A view is a pointer to n values in [0, q) together with the ring
+ * parameters and the domain the values are in. It is the common currency
+ * between polynomial types with different storage (BasicPolynomial,
+ * FixedPolynomial): each can produce a view of itself and be constructed
+ * from a view of any width.
+ *
+ * Views also wrap external buffers (network packets, memory-mapped files,
+ * batch arrays) so they can be used without first copying them into a
+ * polynomial: BasicPolynomial's compound arithmetic, polySignal() and
+ * toBytes(), NTT::forward()/inverse() and SHA256::polyToHash() accept
+ * views directly.
+ *
+ * The viewed storage must outlive the view.
+ *
+ * @tparam Coeff Unsigned coefficient type of the viewed storage.
+ */
+template<typename Coeff>
+class BasicPolynomialView {
+public:
+    /** @brief Coefficient type of the viewed storage. */
+    using coeff_type = Coeff;
+
+    /**
+     * @brief Create a view over existing coefficients.
+     *
+     * @param data   Pointer to @p n values: coefficients in ascending
+     *               degree order, or NTT evaluations.
+     * @param n      Ring dimension.
+     * @param q      Coefficient modulus.
+     * @param domain Representation of the values at @p data.
+     */
+    constexpr BasicPolynomialView(const Coeff* data, std::size_t n, std::uint64_t q,
+                                  PolyDomain domain = PolyDomain::Coefficient)
+        : data_(data), ring_dim_(n), modulus_(q), domain_(domain) {}
+
+    /** @return Coefficient at @p idx (no bounds checking). */
+    constexpr const Coeff& operator[](std::size_t idx) const { return data_[idx]; }
+
+    /** @return Pointer to the first coefficient. */
+    constexpr const Coeff* data() const { return data_; }
+
+    /** @return Ring dimension n. */
+    constexpr std::size_t degree() const { return ring_dim_; }
+
+    /** @return Coefficient modulus q. */
+    constexpr std::uint64_t getModulus() const { return modulus_; }
+
+    /** @return Representation of the viewed values. */
+    constexpr PolyDomain domain() const { return domain_; }
+
+    /** @return Iterator to the first coefficient. */
+    constexpr const Coeff* begin() const { return data_; }
+
+    /** @return Iterator past the last coefficient. */
+    constexpr const Coeff* end() const { return data_ + ring_dim_; }
+
+private:
+    const Coeff* data_;
+    std::size_t ring_dim_;
+    std::uint64_t modulus_;
+    PolyDomain domain_;
+};
+
+/** @brief View over 64-bit coefficients (e.g. a Polynomial). */
+using PolynomialView = BasicPolynomialView<std::uint64_t>;
+
+/** @brief View over 32-bit coefficients. */
+using PolynomialView32 = BasicPolynomialView<std::uint32_t>;
+
+/** @brief View over 16-bit coefficients. */
+using PolynomialView16 = BasicPolynomialView<std::uint16_t>;
+
+#endif // POLYNOMIAL_VIEW_H
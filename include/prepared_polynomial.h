@@ -0,0 +1,81 @@
+#ifndef PREPARED_POLYNOMIAL_H
+#define PREPARED_POLYNOMIAL_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include <polynomial.h>
+#include <polynomial_view.h>
+
+/**
+ * @brief A fixed multiplicand stored in the form products consume.
+ *
+ * Operands such as the public key (a, b) and the secret s are multiplied
+ * many times but never change. Multiplying a BasicPolynomial by one of
+ * them re-transforms it on every call unless it happens to be in the NTT
+ * domain already. A PreparedPolynomial is transformed once, when it is
+ * created, and optionally keeps the Shoup companion floor(w * 2^32 / q)
+ * of every evaluation w. A product with it then costs one forward NTT of
+ * the other operand and a single Shoup multiply per coefficient; the
+ * inverse NTT runs when the result is read, as for any NTT-domain
+ * product (see BasicPolynomial).
+ *
+ * In rings without NTT tables the coefficients are kept as they are and
+ * products take the same FFT or schoolbook fallback as operator*=.
+ */
+class PreparedPolynomial {
+public:
+    /**
+     * @brief Prepare a polynomial for repeated multiplication.
+     *
+     * Values already in the NTT domain are adopted without transforming.
+     *
+     * @param poly       Multiplicand of any coefficient width.
+     * @param with_shoup Also compute Shoup companions (ignored for q > 2^32).
+     */
+    template<typename Coeff>
+    explicit PreparedPolynomial(const BasicPolynomial<Coeff>& poly, bool with_shoup = true);
+
+    /** @return Ring dimension n. */
+    std::size_t degree() const { return ring_dim; }
+
+    /** @return Coefficient modulus q. */
+    std::uint64_t getModulus() const { return modulus; }
+
+    /** @return PolyDomain::NTT if the ring has NTT tables, PolyDomain::Coefficient otherwise. */
+    PolyDomain domain() const { return value_domain; }
+
+    /** @return True if Shoup companions are stored. */
+    bool hasShoup() const { return !companions.empty(); }
+
+    /** @return Stored evaluations (or coefficients, see domain()). */
+    const std::vector<std::uint64_t>& values() const { return evals; }
+
+    /** @return Shoup companions of values(); empty unless hasShoup(). */
+    const std::vector<std::uint64_t>& shoupCompanions() const { return companions; }
+
+    /** @return View over values() tagged with domain(). */
+    PolynomialView valuesView() const {
+        return PolynomialView(evals.data(), ring_dim, modulus, value_domain);
+    }
+
+    /**
+     * @brief Rebuild an ordinary polynomial (in domain()).
+     *
+     * @throws std::invalid_argument If the modulus does not fit Coeff.
+     */
+    template<typename Coeff = std::uint64_t>
+    BasicPolynomial<Coeff> toPolynomial() const {
+        return BasicPolynomial<Coeff>(valuesView());
+    }
+
+private:
+    std::size_t ring_dim;
+    std::uint64_t modulus;
+    PolyDomain value_domain;
+    std::vector<std::uint64_t> evals;
+    std::vector<std::uint64_t> companions;
+};
+
+#endif // PREPARED_POLYNOMIAL_H
@@ -1,6 +1,7 @@
 #ifndef SHA256_H
 #define SHA256_H
 
+#include <memory>
 #include <vector>
 #include <string>
 #include <cstdint>
@@ -17,6 +18,41 @@
  */
 class SHA256 {
 public:
+    /**
+     * @brief Incremental SHA-256 computation over pieces of input.
+     *
+     * Feeding the pieces of a message through update() yields the same
+     * digest as hash() over their concatenation, without building it.
+     */
+    class Context {
+    public:
+        /**
+         * @brief Start a new digest.
+         *
+         * @throws std::runtime_error if the underlying OpenSSL calls fail.
+         */
+        Context();
+
+        /**
+         * @brief Append @p size bytes at @p data to the message.
+         *
+         * @throws std::runtime_error if the underlying OpenSSL call fails.
+         */
+        void update(const uint8_t* data, size_t size);
+
+        /**
+         * @brief Finish the digest; the context cannot be updated afterwards.
+         *
+         * @return Hash bytes of length hashSize().
+         *
+         * @throws std::runtime_error if the underlying OpenSSL call fails.
+         */
+        std::vector<uint8_t> finish();
+
+    private:
+        std::unique_ptr<EVP_MD_CTX, decltype(&EVP_MD_CTX_free)> mdctx;
+    };
+
     /**
      * @brief Compute the SHA-256 hash of a byte vector.
      *
@@ -41,14 +77,34 @@ public:
     /**
      * @brief Compute the SHA-256 hash of a polynomial.
      *
-     * The polynomial is first serialized to a byte vector via
-     * Polynomial::toBytes() and then hashed.
+     * The digest is that of the canonical packed encoding
+     * Polynomial::toBytes(), so it is the same on every host. The encoding
+     * is streamed into the digest in chunks (Polynomial::writeBytes())
+     * rather than built first, and the polynomial keeps its domain.
      *
      * @param poly Polynomial to hash.
      * @return Hash bytes of length hashSize().
      */
     static std::vector<uint8_t> polyToHash(const Polynomial& poly);
 
+    /**
+     * @brief Compute the SHA-256 hash of viewed polynomial values.
+     *
+     * Produces the same digest as polyToHash() on the equivalent
+     * polynomial, without copying an external buffer into one first.
+     *
+     * @param view Values of any coefficient width, in either domain.
+     * @return Hash bytes of length hashSize().
+     */
+    template<typename Coeff>
+    static std::vector<uint8_t> polyToHash(const BasicPolynomialView<Coeff>& view) {
+        Context context;
+        BasicPolynomial<Coeff>::writeBytes(view, [&context](const uint8_t* data, size_t size) {
+            context.update(data, size);
+        });
+        return context.finish();
+    }
+
     /**
      * @brief Get the SHA-256 digest size in bytes.
      *
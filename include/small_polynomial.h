@@ -0,0 +1,175 @@
+#ifndef SMALL_POLYNOMIAL_H
+#define SMALL_POLYNOMIAL_H
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+#include <vector>
+
+#include <modulus.h>
+#include <polynomial.h>
+
+/**
+ * @brief Polynomial in Z_q[x]/(x^n + 1) with small, centered coefficients.
+ *
+ * Secrets and noise terms are drawn from narrow distributions around zero,
+ * but a BasicPolynomial stores a negative sample x as q + x, so to every
+ * kernel it looks like a full-size residue. A BasicSmallPolynomial keeps
+ * the centered value itself in a signed 8- or 16-bit integer: a KYBER512
+ * secret takes 256 bytes instead of 2 KiB.
+ *
+ * Small coefficients also make products cheaper. multiply() accumulates
+ * @f$\sum_j s_j b_{k-j}@f$ in 64-bit signed words with no reduction until
+ * the end (the sum of |s_j| times q bounds every word), visiting only the
+ * nonzero s_j. That direct product is used for sparse operands and in
+ * rings without NTT tables; dense operands in NTT rings go through the
+ * usual NTT product of the lifted polynomial.
+ *
+ * The member functions are explicitly instantiated for int8_t and
+ * int16_t in small_polynomial.cpp.
+ *
+ * @tparam SmallInt Signed coefficient storage type.
+ */
+template<typename SmallInt>
+class BasicSmallPolynomial {
+    static_assert(std::is_signed<SmallInt>::value && std::is_integral<SmallInt>::value &&
+                      sizeof(SmallInt) <= sizeof(std::int16_t),
+                  "BasicSmallPolynomial requires a signed integer type of at most 16 bits");
+
+public:
+    /** @brief Coefficient storage type. */
+    using value_type = SmallInt;
+
+    /**
+     * @brief Check whether a centered value can be stored for modulus @p q.
+     *
+     * @return True if @p value fits SmallInt and @f$|value| < q@f$.
+     */
+    static bool fits(std::int64_t value, std::uint64_t q) {
+        const std::uint64_t magnitude =
+            value < 0 ? std::uint64_t(0) - static_cast<std::uint64_t>(value) : static_cast<std::uint64_t>(value);
+        return value >= std::numeric_limits<SmallInt>::min() &&
+               value <= std::numeric_limits<SmallInt>::max() && magnitude < q;
+    }
+
+    /**
+     * @brief Construct the zero polynomial.
+     *
+     * @throws std::invalid_argument If q is zero.
+     */
+    BasicSmallPolynomial(std::size_t n, std::uint64_t q);
+
+    /**
+     * @brief Construct from centered coefficients.
+     *
+     * @param values Coefficients in ascending degree order.
+     * @param q      Coefficient modulus.
+     *
+     * @throws std::invalid_argument If q is zero or a value does not fit().
+     */
+    BasicSmallPolynomial(const std::vector<std::int64_t>& values, std::uint64_t q);
+
+    /**
+     * @brief Centered lift of a polynomial: residues above q/2 become negative.
+     *
+     * @throws std::invalid_argument If a centered coefficient does not fit SmallInt.
+     */
+    template<typename Coeff>
+    static BasicSmallPolynomial fromPolynomial(const BasicPolynomial<Coeff>& poly);
+
+    /** @return Centered coefficient at @p idx (no bounds checking). */
+    SmallInt operator[](std::size_t idx) const { return coeffs[idx]; }
+
+    /**
+     * @brief Replace the coefficient at @p idx (no bounds checking).
+     *
+     * @throws std::invalid_argument If @p value does not fit().
+     */
+    void set(std::size_t idx, std::int64_t value);
+
+    /** @return Centered coefficients in ascending degree order. */
+    const std::vector<SmallInt>& values() const { return coeffs; }
+
+    /** @return Ring dimension n. */
+    std::size_t degree() const { return ring_dim; }
+
+    /** @return Coefficient modulus q. */
+    std::uint64_t getModulus() const { return modulus; }
+
+    /** @return Number of nonzero coefficients. */
+    std::size_t weight() const;
+
+    /** @return Sum of the absolute values of the coefficients. */
+    std::uint64_t absoluteSum() const;
+
+    /**
+     * @brief Add the lifted coefficients into @p target: target += this.
+     *
+     * @throws std::invalid_argument If @p target is in a different ring.
+     */
+    template<typename Coeff>
+    void addTo(BasicPolynomial<Coeff>& target) const;
+
+    /**
+     * @brief Lift to residues in [0, q): x becomes x mod q.
+     */
+    template<typename Coeff = std::uint64_t>
+    BasicPolynomial<Coeff> toPolynomial() const;
+
+    /**
+     * @brief Product with a full-size polynomial in Z_q[x]/(x^n + 1).
+     *
+     * @param large Other factor, in either domain.
+     * @return Product in coefficient form (direct path) or the NTT domain
+     *         (NTT path, see the class description).
+     *
+     * @throws std::invalid_argument If @p large is in a different ring.
+     */
+    template<typename Coeff>
+    BasicPolynomial<Coeff> multiply(const BasicPolynomial<Coeff>& large) const;
+
+    /**
+     * @brief Whether multiply() takes the direct, reduction-free path.
+     *
+     * True in rings without NTT tables, and for operands of at most
+     * 2 log2(n) nonzero coefficients, where weight * n additions beat
+     * the three n log n transforms of an NTT product. In both cases the
+     * unreduced sums must also fit 63 bits.
+     */
+    bool usesDirectProduct() const;
+
+private:
+    std::size_t ring_dim;
+    std::uint64_t modulus;
+    const Modulus* modulus_info;
+    std::vector<SmallInt> coeffs;
+
+    /** @brief Throw unless @p value fits(). */
+    void requireFits(std::int64_t value) const;
+};
+
+/** @brief Small polynomial with 8-bit coefficients (|x| <= 127). */
+using SmallPolynomial = BasicSmallPolynomial<std::int8_t>;
+
+/** @brief Small polynomial with 16-bit coefficients (|x| <= 32767). */
+using SmallPolynomial16 = BasicSmallPolynomial<std::int16_t>;
+
+/** @brief Product of a small and a full-size polynomial (see BasicSmallPolynomial::multiply()). */
+template<typename SmallInt, typename Coeff>
+BasicPolynomial<Coeff> operator*(const BasicSmallPolynomial<SmallInt>& small,
+                                 const BasicPolynomial<Coeff>& large) {
+    return small.multiply(large);
+}
+
+/** @copydoc operator*(const BasicSmallPolynomial<SmallInt>&, const BasicPolynomial<Coeff>&) */
+template<typename SmallInt, typename Coeff>
+BasicPolynomial<Coeff> operator*(const BasicPolynomial<Coeff>& large,
+                                 const BasicSmallPolynomial<SmallInt>& small) {
+    return small.multiply(large);
+}
+
+extern template class BasicSmallPolynomial<std::int8_t>;
+extern template class BasicSmallPolynomial<std::int16_t>;
+
+#endif // SMALL_POLYNOMIAL_H
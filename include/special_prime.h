@@ -0,0 +1,108 @@
+#ifndef SPECIAL_PRIME_H
+#define SPECIAL_PRIME_H
+
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * @brief Division-free modular reduction for primes q = c * 2^k + 1.
+ *
+ * Implements the K-RED reduction of Longa and Naehrig: writing
+ * @f$x = x_0 + 2^k x_1@f$ with @f$0 \le x_0 < 2^k@f$, the value
+ * @f$c x_0 - x_1@f$ is congruent to @f$c x@f$ modulo q and much smaller
+ * than x. Applying it twice maps any product of two reduced residues to
+ * a value congruent to @f$c^2 x@f$ that needs at most one conditional
+ * correction to land in [0, q). Only shifts, masks, small multiplies and
+ * compares are used.
+ *
+ * The extra factor @f$c^2@f$ is cancelled by pre-scaling one operand by
+ * @f$c^{-2}@f$ (see prescale()), which is free for constants such as NTT
+ * twiddles or a fixed scalar.
+ *
+ * All production moduli have this form: 7681 = 15 * 2^9 + 1,
+ * 12289 = 3 * 2^12 + 1 and 18433 = 9 * 2^11 + 1.
+ */
+class SpecialPrimeReducer {
+public:
+    /**
+     * @brief Build a reducer for q.
+     *
+     * @param q Modulus of the form c * 2^k + 1 (see isSpecialForm()).
+     *
+     * @throws std::invalid_argument If q does not qualify.
+     */
+    explicit SpecialPrimeReducer(std::uint64_t q);
+
+    /**
+     * @brief Check whether double K-RED is exact for q.
+     *
+     * Requires q = c * 2^k + 1 with k >= 1, q < 2^31, and that every input
+     * @f$x \le (q-1)^2@f$ ends up in (-q, 2q) after two K-RED steps.
+     */
+    static bool isSpecialForm(std::uint64_t q);
+
+    /**
+     * @brief Get a shared reducer for q, or nullptr if q is not special.
+     *
+     * Reducers are interned for the lifetime of the process.
+     */
+    static const SpecialPrimeReducer* forModulus(std::uint64_t q);
+
+    /** @return Modulus q. */
+    std::uint64_t modulus() const { return q_; }
+
+    /** @return Odd factor c in q = c * 2^k + 1. */
+    std::uint64_t factor() const { return c_; }
+
+    /** @return Exponent k in q = c * 2^k + 1. */
+    unsigned shift() const { return k_; }
+
+    /**
+     * @brief Two K-RED steps with final correction.
+     *
+     * @param x Value with @f$x \le (q-1)^2@f$.
+     * @return @f$c^2 x \bmod q@f$ in [0, q).
+     */
+    std::uint64_t kred2(std::uint64_t x) const {
+        std::int64_t r = kred(static_cast<std::int64_t>(x));
+        r = kred(r);
+        const std::int64_t q = static_cast<std::int64_t>(q_);
+        if (r < 0) r += q;
+        if (r >= q) r -= q;
+        return static_cast<std::uint64_t>(r);
+    }
+
+    /**
+     * @brief Pre-scale a constant for use with kred2().
+     *
+     * @param w Value in [0, q).
+     * @return @f$w c^{-2} \bmod q@f$, so kred2(a * prescale(w)) = a w mod q.
+     */
+    std::uint64_t prescale(std::uint64_t w) const;
+
+    /**
+     * @brief Exact modular product of two reduced residues.
+     *
+     * @param a Value in [0, q).
+     * @param b Value in [0, q).
+     * @return @f$a b \bmod q@f$.
+     */
+    std::uint64_t mulMod(std::uint64_t a, std::uint64_t b) const {
+        return kred2(kred2(a * b) * c_inv4_);
+    }
+
+private:
+    std::uint64_t q_;
+    std::uint64_t c_;
+    unsigned k_;
+    std::int64_t mask_;
+    std::uint64_t c_inv2_;  ///< c^{-2} mod q
+    std::uint64_t c_inv4_;  ///< c^{-4} mod q
+
+    /** One K-RED step: returns c * (x mod 2^k) - floor(x / 2^k). */
+    std::int64_t kred(std::int64_t x) const {
+        return static_cast<std::int64_t>(c_) * (x & mask_) - (x >> k_);
+    }
+};
+
+#endif // SPECIAL_PRIME_H
@@ -0,0 +1,157 @@
+#include <binary_polynomial.h>
+
+#include <algorithm>
+#include <memory_resource>
+#include <stdexcept>
+
+#include <elementwise.h>
+#include <ntt.h>
+#include <poly_memory.h>
+#include <sha256.h>
+
+namespace {
+
+std::size_t popcount64(std::uint64_t x) {
+#if defined(__GNUC__) || defined(__clang__)
+    return static_cast<std::size_t>(__builtin_popcountll(x));
+#else
+    std::size_t count = 0;
+    for (; x; x &= x - 1) {
+        ++count;
+    }
+    return count;
+#endif
+}
+
+// Load up to eight bytes as a little-endian word and reverse the bit order
+// inside every byte, so that MSB-first byte bits land LSB-first in the word.
+std::uint64_t loadReversedBytes(const std::uint8_t* in, std::size_t count) {
+    std::uint64_t w = 0;
+    for (std::size_t i = 0; i < count; ++i) {
+        w |= static_cast<std::uint64_t>(in[i]) << (8 * i);
+    }
+    w = ((w >> 4) & 0x0F0F0F0F0F0F0F0FULL) | ((w & 0x0F0F0F0F0F0F0F0FULL) << 4);
+    w = ((w >> 2) & 0x3333333333333333ULL) | ((w & 0x3333333333333333ULL) << 2);
+    w = ((w >> 1) & 0x5555555555555555ULL) | ((w & 0x5555555555555555ULL) << 1);
+    return w;
+}
+
+} // namespace
+
+BinaryPolynomial::BinaryPolynomial(std::size_t n, std::uint64_t q, std::uint64_t one_value)
+    : ring_dim(n), modulus(q), one(one_value), bits((n + 63) / 64, 0) {
+    if (n == 0 || q == 0) {
+        throw std::invalid_argument("Ring dimension and modulus must be positive");
+    }
+    if (one == 0 || one >= q) {
+        throw std::invalid_argument("Set-bit value must lie in [1, q)");
+    }
+}
+
+void BinaryPolynomial::loadBytesMSBFirst(const std::uint8_t* data, std::size_t size,
+                                         std::size_t offset) {
+    // offset is a multiple of 64, so every chunk of eight bytes fills
+    // exactly one word.
+    std::size_t word = offset / 64;
+    for (std::size_t pos = 0; pos < size && word < bits.size(); pos += 8, ++word) {
+        bits[word] = loadReversedBytes(data + pos, std::min<std::size_t>(8, size - pos));
+    }
+    if (ring_dim % 64 != 0) {
+        bits.back() &= (std::uint64_t(1) << (ring_dim % 64)) - 1;
+    }
+}
+
+BinaryPolynomial BinaryPolynomial::fromBytes(const std::uint8_t* data, std::size_t size,
+                                             std::size_t n, std::uint64_t q,
+                                             std::uint64_t one_value) {
+    BinaryPolynomial result(n, q, one_value);
+    result.loadBytesMSBFirst(data, size, 0);
+    return result;
+}
+
+BinaryPolynomial BinaryPolynomial::fromSHA256(const std::vector<std::uint8_t>& message,
+                                              std::size_t n, std::uint64_t q) {
+    BinaryPolynomial result(n, q, q / 2);
+
+    std::vector<std::uint8_t> block(4 + message.size());
+    std::copy(message.begin(), message.end(), block.begin() + 4);
+    const std::size_t bits_per_block = 8 * SHA256::hashSize();
+    for (std::uint32_t counter = 0; counter * bits_per_block < n; ++counter) {
+        for (std::size_t i = 0; i < 4; ++i) {
+            block[i] = static_cast<std::uint8_t>(counter >> (8 * i));
+        }
+        const std::vector<std::uint8_t> digest = SHA256::hash(block);
+        result.loadBytesMSBFirst(digest.data(), digest.size(), counter * bits_per_block);
+    }
+    return result;
+}
+
+template<typename Coeff>
+BinaryPolynomial BinaryPolynomial::signalOf(const BasicPolynomialView<Coeff>& view) {
+    const std::size_t n = view.degree();
+    const std::uint64_t q = view.getModulus();
+    BinaryPolynomial result(n, q, q / 2);
+
+    std::pmr::vector<Coeff> signal(n, poly_memory::scratch());
+    if (view.domain() == PolyDomain::NTT) {
+        NTT::forRing(n, q).inverse(view, signal.data());
+        Elementwise::signal(signal.data(), signal.data(), n, q);
+    } else {
+        Elementwise::signal(view.data(), signal.data(), n, q);
+    }
+
+    for (std::size_t i = 0; i < n; ++i) {
+        result.bits[i / 64] |= static_cast<std::uint64_t>(signal[i] != 0) << (i % 64);
+    }
+    return result;
+}
+
+std::size_t BinaryPolynomial::popcount() const {
+    std::size_t count = 0;
+    for (std::uint64_t w : bits) {
+        count += popcount64(w);
+    }
+    return count;
+}
+
+void BinaryPolynomial::requireSameShape(const BinaryPolynomial& other) const {
+    if (ring_dim != other.ring_dim || modulus != other.modulus || one != other.one) {
+        throw std::invalid_argument("Binary polynomials must share ring and set-bit value");
+    }
+}
+
+std::size_t BinaryPolynomial::distance(const BinaryPolynomial& other) const {
+    requireSameShape(other);
+    std::size_t count = 0;
+    for (std::size_t w = 0; w < bits.size(); ++w) {
+        count += popcount64(bits[w] ^ other.bits[w]);
+    }
+    return count;
+}
+
+bool BinaryPolynomial::operator==(const BinaryPolynomial& other) const {
+    return ring_dim == other.ring_dim && modulus == other.modulus && one == other.one &&
+           bits == other.bits;
+}
+
+template<typename Coeff>
+void BinaryPolynomial::addTo(BasicPolynomial<Coeff>& target) const {
+    if (target.degree() != ring_dim || target.getModulus() != modulus) {
+        throw std::invalid_argument("Polynomials must be in the same ring");
+    }
+
+    // All-ones mask for set bits selects `one`, zero otherwise.
+    std::pmr::vector<Coeff> addend(ring_dim, poly_memory::scratch());
+    for (std::size_t i = 0; i < ring_dim; ++i) {
+        const std::uint64_t bit = (bits[i / 64] >> (i % 64)) & 1;
+        addend[i] = static_cast<Coeff>((std::uint64_t(0) - bit) & one);
+    }
+    target += BasicPolynomialView<Coeff>(addend.data(), ring_dim, modulus);
+}
+
+template BinaryPolynomial BinaryPolynomial::signalOf(const BasicPolynomialView<std::uint16_t>&);
+template BinaryPolynomial BinaryPolynomial::signalOf(const BasicPolynomialView<std::uint32_t>&);
+template BinaryPolynomial BinaryPolynomial::signalOf(const BasicPolynomialView<std::uint64_t>&);
+template void BinaryPolynomial::addTo(BasicPolynomial<std::uint16_t>&) const;
+template void BinaryPolynomial::addTo(BasicPolynomial<std::uint32_t>&) const;
+template void BinaryPolynomial::addTo(BasicPolynomial<std::uint64_t>&) const;
@@ -0,0 +1,486 @@
+#include <elementwise.h>
+
+#include <algorithm>
+#include <atomic>
+#include <stdexcept>
+#include <type_traits>
+
+#include <modulus.h>
+#include <special_prime.h>
+
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#define RLWE_ELEMENTWISE_X86 1
+#else
+#define RLWE_ELEMENTWISE_X86 0
+#endif
+
+namespace {
+
+// Lane type for intermediate values: wide enough to hold q itself, which
+// may exceed the storage type by one (e.g. q = 2^16 with 16-bit storage).
+template<typename Word>
+using Wide = std::conditional_t<(sizeof(Word) < sizeof(std::uint32_t)), std::uint32_t, std::uint64_t>;
+
+// Kernel bodies. None of them branches on the data: every conditional is a
+// select the compiler lowers to a packed compare and blend, so the same
+// source vectorizes under each target of the dispatch below.
+
+template<typename Word>
+void addLoop(Word* a, const Word* b, std::size_t n, std::uint64_t q) {
+    using W = Wide<Word>;
+    const W m = static_cast<W>(q);
+    for (std::size_t i = 0; i < n; ++i) {
+        // a + b - q computed as a - (q - b), which cannot overflow.
+        const W x = a[i];
+        const W d = m - b[i];
+        a[i] = static_cast<Word>(x - d + (x < d ? m : 0));
+    }
+}
+
+template<typename Word>
+void subLoop(Word* a, const Word* b, std::size_t n, std::uint64_t q) {
+    using W = Wide<Word>;
+    const W m = static_cast<W>(q);
+    for (std::size_t i = 0; i < n; ++i) {
+        const W x = a[i];
+        const W y = b[i];
+        a[i] = static_cast<Word>(x - y + (x < y ? m : 0));
+    }
+}
+
+template<typename Word>
+void subFromLoop(Word* a, const Word* b, std::size_t n, std::uint64_t q) {
+    using W = Wide<Word>;
+    const W m = static_cast<W>(q);
+    for (std::size_t i = 0; i < n; ++i) {
+        const W x = b[i];
+        const W y = a[i];
+        a[i] = static_cast<Word>(x - y + (x < y ? m : 0));
+    }
+}
+
+template<typename Word>
+void negateLoop(Word* a, std::size_t n, std::uint64_t q) {
+    using W = Wide<Word>;
+    const W m = static_cast<W>(q);
+    for (std::size_t i = 0; i < n; ++i) {
+        const W x = a[i];
+        a[i] = static_cast<Word>(x == 0 ? 0 : m - x);
+    }
+}
+
+template<typename Word>
+void scaleLoop(Word* a, std::size_t n, std::uint64_t scalar, std::uint64_t q) {
+    if (const SpecialPrimeReducer* shared = SpecialPrimeReducer::forModulus(q)) {
+        // Local copy: its fields cannot alias the output array.
+        const SpecialPrimeReducer red = *shared;
+        const std::uint64_t w = red.prescale(scalar);
+        for (std::size_t i = 0; i < n; ++i) {
+            a[i] = static_cast<Word>(red.kred2(a[i] * w));
+        }
+        return;
+    }
+    const Modulus mod = Modulus::forValue(q);
+    const std::uint64_t s = mod.reduce(scalar);
+    if (q <= (std::uint64_t(1) << 32)) {
+        // Shoup: one multiply-high estimate of the quotient per element.
+        const std::uint64_t s_shoup = mod.shoup(s);
+        for (std::size_t i = 0; i < n; ++i) {
+            a[i] = static_cast<Word>(mod.mulShoup(a[i], s, s_shoup));
+        }
+        return;
+    }
+    for (std::size_t i = 0; i < n; ++i) {
+        a[i] = static_cast<Word>(mod.mul(a[i], s));
+    }
+}
+
+template<typename Word>
+void mulLoop(Word* a, const Word* b, std::size_t n, std::uint64_t q) {
+    if (const SpecialPrimeReducer* shared = SpecialPrimeReducer::forModulus(q)) {
+        const SpecialPrimeReducer red = *shared;
+        for (std::size_t i = 0; i < n; ++i) {
+            a[i] = static_cast<Word>(red.mulMod(a[i], b[i]));
+        }
+        return;
+    }
+    const Modulus mod = Modulus::forValue(q);
+    if (mod.hasWordBarrett()) {
+        for (std::size_t i = 0; i < n; ++i) {
+            a[i] = static_cast<Word>(mod.reduceProduct(static_cast<std::uint64_t>(a[i]) * b[i]));
+        }
+        return;
+    }
+    for (std::size_t i = 0; i < n; ++i) {
+        a[i] = static_cast<Word>(mod.mul(a[i], b[i]));
+    }
+}
+
+template<typename Word>
+void mulShoupLoop(Word* a, const std::uint64_t* w, const std::uint64_t* w_shoup, std::size_t n,
+                  std::uint64_t q) {
+    const Modulus mod = Modulus::forValue(q);
+    for (std::size_t i = 0; i < n; ++i) {
+        a[i] = static_cast<Word>(mod.mulShoup(a[i], w[i], w_shoup[i]));
+    }
+}
+
+template<typename Word>
+void signalLoop(const Word* a, Word* out, std::size_t n, std::uint64_t q) {
+    using W = Wide<Word>;
+    const W m = static_cast<W>(q);
+    const W half = m / 2;
+    for (std::size_t i = 0; i < n; ++i) {
+        const W c = a[i];
+        const W to_zero = std::min<W>(c, m - c);
+        const bool upper = c >= half;
+        const W near = upper ? c - half : half - c;
+        const W far = upper ? m - c + half : m - half + c;
+        const W to_half = std::min<W>(near, far);
+        out[i] = static_cast<Word>(to_zero <= to_half ? 0 : half);
+    }
+}
+
+template<typename Word>
+std::uint64_t normInfLoop(const Word* a, std::size_t n, std::uint64_t q) {
+    using W = Wide<Word>;
+    const W m = static_cast<W>(q);
+    W best = 0;
+    for (std::size_t i = 0; i < n; ++i) {
+        const W c = a[i];
+        best = std::max<W>(best, std::min<W>(c, m - c));
+    }
+    return best;
+}
+
+template<typename Word>
+std::uint64_t normL2Loop(const Word* a, std::size_t n, std::uint64_t q) {
+    // Squares of magnitudes up to 2^32 - 1 fit; saturation is tracked in a
+    // flag so the loop stays branch-free.
+    std::uint64_t sum = 0;
+    std::uint64_t saturated = 0;
+    for (std::size_t i = 0; i < n; ++i) {
+        const std::uint64_t c = a[i];
+        const std::uint64_t d = std::min<std::uint64_t>(c, q - c);
+        const std::uint64_t next = sum + d * d;
+        saturated |= static_cast<std::uint64_t>(d > 0xFFFFFFFFu) | static_cast<std::uint64_t>(next < sum);
+        sum = next;
+    }
+    return saturated ? ~std::uint64_t(0) : sum;
+}
+
+template<typename Word>
+bool withinBoundLoop(const Word* a, std::size_t n, std::uint64_t q, std::uint64_t bound) {
+    using W = Wide<Word>;
+    const W m = static_cast<W>(q);
+    const W b = static_cast<W>(std::min<std::uint64_t>(bound, q));
+    W bad = 0;
+    for (std::size_t i = 0; i < n; ++i) {
+        const W c = a[i];
+        bad |= static_cast<W>(c >= m) | static_cast<W>(std::min<W>(c, m - c) > b);
+    }
+    return bad == 0;
+}
+
+template<typename Word>
+void compressLoop(Word* a, std::size_t n, unsigned d, std::uint64_t q) {
+    // floor(x / q) for x < 2^s via m = floor(2^s / q): the estimate is at
+    // most one too small, so a single select corrects it.
+    const unsigned s = 63 - d;
+    const std::uint64_t m = (std::uint64_t(1) << s) / q;
+    const std::uint64_t half = q / 2;
+    const std::uint64_t mask = (std::uint64_t(1) << d) - 1;
+    for (std::size_t i = 0; i < n; ++i) {
+        const std::uint64_t x = (static_cast<std::uint64_t>(a[i]) << d) + half;
+        std::uint64_t t = (x * m) >> s;
+        t += (x - t * q >= q) ? 1 : 0;
+        a[i] = static_cast<Word>(t & mask);
+    }
+}
+
+template<typename Word>
+void decompressLoop(Word* a, std::size_t n, unsigned d, std::uint64_t q) {
+    const std::uint64_t round = std::uint64_t(1) << (d - 1);
+    for (std::size_t i = 0; i < n; ++i) {
+        a[i] = static_cast<Word>((static_cast<std::uint64_t>(a[i]) * q + round) >> d);
+    }
+}
+
+template<typename Word>
+void accumulateLoop(std::uint64_t* acc, const Word* a, std::size_t n) {
+    for (std::size_t i = 0; i < n; ++i) {
+        acc[i] += a[i];
+    }
+}
+
+template<typename Word>
+void accumulateNegatedLoop(std::uint64_t* acc, const Word* a, std::size_t n, std::uint64_t q) {
+    for (std::size_t i = 0; i < n; ++i) {
+        acc[i] += q - a[i];
+    }
+}
+
+template<typename Word>
+void reduceWideLoop(const std::uint64_t* acc, Word* out, std::size_t n, std::uint64_t q) {
+    const Modulus mod = Modulus::forValue(q);
+    for (std::size_t i = 0; i < n; ++i) {
+        out[i] = static_cast<Word>(mod.reduce(acc[i]));
+    }
+}
+
+// Target trampolines: flatten inlines the kernel body, so it is compiled
+// (and vectorized) for the wrapper's instruction set.
+#if RLWE_ELEMENTWISE_X86
+template<typename Fn>
+__attribute__((target("avx2"), flatten)) void runAVX2(const Fn& fn) {
+    fn();
+}
+
+template<typename Fn>
+__attribute__((target("avx2,avx512f,avx512bw,avx512vl,avx512dq"), flatten))
+void runAVX512(const Fn& fn) {
+    fn();
+}
+#endif
+
+template<typename Fn>
+void dispatch(const Fn& fn) {
+#if RLWE_ELEMENTWISE_X86
+    switch (Elementwise::preferredKernel()) {
+    case ElementwiseKernel::AVX512:
+        runAVX512(fn);
+        return;
+    case ElementwiseKernel::AVX2:
+        runAVX2(fn);
+        return;
+    case ElementwiseKernel::Scalar:
+        break;
+    }
+#endif
+    fn();
+}
+
+constexpr int kNoPreference = -1;
+
+std::atomic<int>& preferredSlot() {
+    static std::atomic<int> slot{kNoPreference};
+    return slot;
+}
+
+ElementwiseKernel widestSupported() {
+    static const ElementwiseKernel widest = [] {
+        if (Elementwise::isKernelSupported(ElementwiseKernel::AVX512)) {
+            return ElementwiseKernel::AVX512;
+        }
+        if (Elementwise::isKernelSupported(ElementwiseKernel::AVX2)) {
+            return ElementwiseKernel::AVX2;
+        }
+        return ElementwiseKernel::Scalar;
+    }();
+    return widest;
+}
+
+} // namespace
+
+bool Elementwise::isKernelSupported(ElementwiseKernel kernel) {
+    switch (kernel) {
+    case ElementwiseKernel::Scalar:
+        return true;
+#if RLWE_ELEMENTWISE_X86
+    case ElementwiseKernel::AVX2:
+        __builtin_cpu_init();
+        return __builtin_cpu_supports("avx2");
+    case ElementwiseKernel::AVX512:
+        __builtin_cpu_init();
+        return __builtin_cpu_supports("avx2") && __builtin_cpu_supports("avx512f") &&
+               __builtin_cpu_supports("avx512bw") && __builtin_cpu_supports("avx512vl") &&
+               __builtin_cpu_supports("avx512dq");
+#else
+    case ElementwiseKernel::AVX2:
+    case ElementwiseKernel::AVX512:
+        return false;
+#endif
+    }
+    return false;
+}
+
+std::vector<ElementwiseKernel> Elementwise::allKernels() {
+    return {ElementwiseKernel::Scalar, ElementwiseKernel::AVX2, ElementwiseKernel::AVX512};
+}
+
+const char* Elementwise::kernelName(ElementwiseKernel kernel) {
+    switch (kernel) {
+    case ElementwiseKernel::Scalar:
+        return "scalar";
+    case ElementwiseKernel::AVX2:
+        return "avx2";
+    case ElementwiseKernel::AVX512:
+        return "avx512";
+    }
+    return "unknown";
+}
+
+ElementwiseKernel Elementwise::kernelFromName(const std::string& name) {
+    for (ElementwiseKernel kernel : allKernels()) {
+        if (name == kernelName(kernel)) {
+            return kernel;
+        }
+    }
+    throw std::invalid_argument("Elementwise: unknown kernel name '" + name + "'");
+}
+
+void Elementwise::setPreferredKernel(ElementwiseKernel kernel) {
+    if (!isKernelSupported(kernel)) {
+        throw std::invalid_argument(std::string("Elementwise: kernel '") + kernelName(kernel) +
+                                    "' is not supported on this host");
+    }
+    preferredSlot().store(static_cast<int>(kernel), std::memory_order_relaxed);
+}
+
+ElementwiseKernel Elementwise::preferredKernel() {
+    const int preferred = preferredSlot().load(std::memory_order_relaxed);
+    return preferred == kNoPreference ? widestSupported() : static_cast<ElementwiseKernel>(preferred);
+}
+
+void Elementwise::clearPreferredKernel() {
+    preferredSlot().store(kNoPreference, std::memory_order_relaxed);
+}
+
+template<typename Word>
+void Elementwise::add(Word* a, const Word* b, std::size_t n, std::uint64_t q) {
+    dispatch([=] { addLoop(a, b, n, q); });
+}
+
+template<typename Word>
+void Elementwise::sub(Word* a, const Word* b, std::size_t n, std::uint64_t q) {
+    dispatch([=] { subLoop(a, b, n, q); });
+}
+
+template<typename Word>
+void Elementwise::subFrom(Word* a, const Word* b, std::size_t n, std::uint64_t q) {
+    dispatch([=] { subFromLoop(a, b, n, q); });
+}
+
+template<typename Word>
+void Elementwise::negate(Word* a, std::size_t n, std::uint64_t q) {
+    dispatch([=] { negateLoop(a, n, q); });
+}
+
+template<typename Word>
+void Elementwise::scale(Word* a, std::size_t n, std::uint64_t scalar, std::uint64_t q) {
+    dispatch([=] { scaleLoop(a, n, scalar, q); });
+}
+
+template<typename Word>
+void Elementwise::mulPointwise(Word* a, const Word* b, std::size_t n, std::uint64_t q) {
+    dispatch([=] { mulLoop(a, b, n, q); });
+}
+
+template<typename Word>
+void Elementwise::mulPointwiseShoup(Word* a, const std::uint64_t* w, const std::uint64_t* w_shoup,
+                                    std::size_t n, std::uint64_t q) {
+    dispatch([=] { mulShoupLoop(a, w, w_shoup, n, q); });
+}
+
+template<typename Word>
+void Elementwise::signal(const Word* a, Word* out, std::size_t n, std::uint64_t q) {
+    dispatch([=] { signalLoop(a, out, n, q); });
+}
+
+template<typename Word>
+std::uint64_t Elementwise::normInf(const Word* a, std::size_t n, std::uint64_t q) {
+    std::uint64_t result = 0;
+    dispatch([&] { result = normInfLoop(a, n, q); });
+    return result;
+}
+
+template<typename Word>
+std::uint64_t Elementwise::normL2Squared(const Word* a, std::size_t n, std::uint64_t q) {
+    std::uint64_t result = 0;
+    dispatch([&] { result = normL2Loop(a, n, q); });
+    return result;
+}
+
+template<typename Word>
+bool Elementwise::withinBound(const Word* a, std::size_t n, std::uint64_t q, std::uint64_t bound) {
+    bool result = false;
+    dispatch([&] { result = withinBoundLoop(a, n, q, bound); });
+    return result;
+}
+
+template<typename Word>
+void Elementwise::compress(Word* a, std::size_t n, unsigned d, std::uint64_t q) {
+    dispatch([=] { compressLoop(a, n, d, q); });
+}
+
+template<typename Word>
+void Elementwise::decompress(Word* a, std::size_t n, unsigned d, std::uint64_t q) {
+    dispatch([=] { decompressLoop(a, n, d, q); });
+}
+
+template<typename Word>
+void Elementwise::accumulate(std::uint64_t* acc, const Word* a, std::size_t n) {
+    dispatch([=] { accumulateLoop(acc, a, n); });
+}
+
+template<typename Word>
+void Elementwise::accumulateNegated(std::uint64_t* acc, const Word* a, std::size_t n, std::uint64_t q) {
+    dispatch([=] { accumulateNegatedLoop(acc, a, n, q); });
+}
+
+template<typename Word>
+void Elementwise::reduceWide(const std::uint64_t* acc, Word* out, std::size_t n, std::uint64_t q) {
+    dispatch([=] { reduceWideLoop(acc, out, n, q); });
+}
+
+template void Elementwise::add(std::uint16_t*, const std::uint16_t*, std::size_t, std::uint64_t);
+template void Elementwise::add(std::uint32_t*, const std::uint32_t*, std::size_t, std::uint64_t);
+template void Elementwise::add(std::uint64_t*, const std::uint64_t*, std::size_t, std::uint64_t);
+template void Elementwise::sub(std::uint16_t*, const std::uint16_t*, std::size_t, std::uint64_t);
+template void Elementwise::sub(std::uint32_t*, const std::uint32_t*, std::size_t, std::uint64_t);
+template void Elementwise::sub(std::uint64_t*, const std::uint64_t*, std::size_t, std::uint64_t);
+template void Elementwise::subFrom(std::uint16_t*, const std::uint16_t*, std::size_t, std::uint64_t);
+template void Elementwise::subFrom(std::uint32_t*, const std::uint32_t*, std::size_t, std::uint64_t);
+template void Elementwise::subFrom(std::uint64_t*, const std::uint64_t*, std::size_t, std::uint64_t);
+template void Elementwise::negate(std::uint16_t*, std::size_t, std::uint64_t);
+template void Elementwise::negate(std::uint32_t*, std::size_t, std::uint64_t);
+template void Elementwise::negate(std::uint64_t*, std::size_t, std::uint64_t);
+template void Elementwise::scale(std::uint16_t*, std::size_t, std::uint64_t, std::uint64_t);
+template void Elementwise::scale(std::uint32_t*, std::size_t, std::uint64_t, std::uint64_t);
+template void Elementwise::scale(std::uint64_t*, std::size_t, std::uint64_t, std::uint64_t);
+template void Elementwise::mulPointwise(std::uint16_t*, const std::uint16_t*, std::size_t, std::uint64_t);
+template void Elementwise::mulPointwise(std::uint32_t*, const std::uint32_t*, std::size_t, std::uint64_t);
+template void Elementwise::mulPointwise(std::uint64_t*, const std::uint64_t*, std::size_t, std::uint64_t);
+template void Elementwise::mulPointwiseShoup(std::uint16_t*, const std::uint64_t*, const std::uint64_t*,
+                                             std::size_t, std::uint64_t);
+template void Elementwise::mulPointwiseShoup(std::uint32_t*, const std::uint64_t*, const std::uint64_t*,
+                                             std::size_t, std::uint64_t);
+template void Elementwise::mulPointwiseShoup(std::uint64_t*, const std::uint64_t*, const std::uint64_t*,
+                                             std::size_t, std::uint64_t);
+template void Elementwise::signal(const std::uint16_t*, std::uint16_t*, std::size_t, std::uint64_t);
+template void Elementwise::signal(const std::uint32_t*, std::uint32_t*, std::size_t, std::uint64_t);
+template void Elementwise::signal(const std::uint64_t*, std::uint64_t*, std::size_t, std::uint64_t);
+template std::uint64_t Elementwise::normInf(const std::uint16_t*, std::size_t, std::uint64_t);
+template std::uint64_t Elementwise::normInf(const std::uint32_t*, std::size_t, std::uint64_t);
+template std::uint64_t Elementwise::normInf(const std::uint64_t*, std::size_t, std::uint64_t);
+template std::uint64_t Elementwise::normL2Squared(const std::uint16_t*, std::size_t, std::uint64_t);
+template std::uint64_t Elementwise::normL2Squared(const std::uint32_t*, std::size_t, std::uint64_t);
+template std::uint64_t Elementwise::normL2Squared(const std::uint64_t*, std::size_t, std::uint64_t);
+template bool Elementwise::withinBound(const std::uint16_t*, std::size_t, std::uint64_t, std::uint64_t);
+template bool Elementwise::withinBound(const std::uint32_t*, std::size_t, std::uint64_t, std::uint64_t);
+template bool Elementwise::withinBound(const std::uint64_t*, std::size_t, std::uint64_t, std::uint64_t);
+template void Elementwise::compress(std::uint16_t*, std::size_t, unsigned, std::uint64_t);
+template void Elementwise::compress(std::uint32_t*, std::size_t, unsigned, std::uint64_t);
+template void Elementwise::compress(std::uint64_t*, std::size_t, unsigned, std::uint64_t);
+template void Elementwise::decompress(std::uint16_t*, std::size_t, unsigned, std::uint64_t);
+template void Elementwise::decompress(std::uint32_t*, std::size_t, unsigned, std::uint64_t);
+template void Elementwise::decompress(std::uint64_t*, std::size_t, unsigned, std::uint64_t);
+template void Elementwise::accumulate(std::uint64_t*, const std::uint16_t*, std::size_t);
+template void Elementwise::accumulate(std::uint64_t*, const std::uint32_t*, std::size_t);
+template void Elementwise::accumulate(std::uint64_t*, const std::uint64_t*, std::size_t);
+template void Elementwise::accumulateNegated(std::uint64_t*, const std::uint16_t*, std::size_t, std::uint64_t);
+template void Elementwise::accumulateNegated(std::uint64_t*, const std::uint32_t*, std::size_t, std::uint64_t);
+template void Elementwise::accumulateNegated(std::uint64_t*, const std::uint64_t*, std::size_t, std::uint64_t);
+template void Elementwise::reduceWide(const std::uint64_t*, std::uint16_t*, std::size_t, std::uint64_t);
+template void Elementwise::reduceWide(const std::uint64_t*, std::uint32_t*, std::size_t, std::uint64_t);
+template void Elementwise::reduceWide(const std::uint64_t*, std::uint64_t*, std::size_t, std::uint64_t);
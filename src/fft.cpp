@@ -0,0 +1,173 @@
+#include <fft.h>
+
+#include <cmath>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <utility>
+
+#include <modulus.h>
+
+namespace {
+
+// Largest allowed bound on |product coefficient|; leaves 5 bits of the
+// 53-bit mantissa for accumulated rounding error.
+constexpr double MAX_PRODUCT_MAGNITUDE = 281474976710656.0;  // 2^48
+
+// Maximum distance from an integer accepted when rounding a coefficient.
+constexpr double ROUNDING_TOLERANCE = 0.25;
+
+bool isPowerOfTwo(std::size_t n) {
+    return n && ((n & (n - 1)) == 0);
+}
+
+} // namespace
+
+bool FFTMultiplier::isSupported(std::size_t n, std::uint64_t q) {
+    if (n < 2 || !isPowerOfTwo(n) || q < 2) {
+        return false;
+    }
+    const double half_q = static_cast<double>(q / 2);
+    return static_cast<double>(n) * half_q * half_q <= MAX_PRODUCT_MAGNITUDE;
+}
+
+FFTMultiplier::FFTMultiplier(std::size_t n, std::uint64_t q)
+    : n_(n), m_(n / 2), q_(q) {
+    if (!isSupported(n, q)) {
+        throw std::invalid_argument("FFTMultiplier: (n, q) exceeds the double-precision budget");
+    }
+
+    const double pi = std::acos(-1.0);
+
+    twist_re_.resize(m_);
+    twist_im_.resize(m_);
+    for (std::size_t j = 0; j < m_; ++j) {
+        double angle = pi * static_cast<double>(j) / static_cast<double>(n_);
+        twist_re_[j] = std::cos(angle);
+        twist_im_[j] = std::sin(angle);
+    }
+
+    root_re_.resize(m_ > 1 ? m_ - 1 : 0);
+    root_im_.resize(root_re_.size());
+    for (std::size_t half = 1; half < m_; half <<= 1) {
+        for (std::size_t j = 0; j < half; ++j) {
+            double angle = -pi * static_cast<double>(j) / static_cast<double>(half);
+            root_re_[half - 1 + j] = std::cos(angle);
+            root_im_[half - 1 + j] = std::sin(angle);
+        }
+    }
+}
+
+const FFTMultiplier& FFTMultiplier::forRing(std::size_t n, std::uint64_t q) {
+    static std::mutex mutex;
+    static std::map<std::pair<std::size_t, std::uint64_t>, std::unique_ptr<const FFTMultiplier>> instances;
+
+    std::lock_guard<std::mutex> lock(mutex);
+    auto key = std::make_pair(n, q);
+    auto it = instances.find(key);
+    if (it == instances.end()) {
+        it = instances.emplace(key, std::make_unique<const FFTMultiplier>(n, q)).first;
+    }
+    return *it->second;
+}
+
+void FFTMultiplier::bitReverse(std::vector<double>& re, std::vector<double>& im) const {
+    std::size_t j = 0;
+    for (std::size_t i = 1; i + 1 < m_; ++i) {
+        std::size_t bit = m_ >> 1;
+        for (; j & bit; bit >>= 1) {
+            j ^= bit;
+        }
+        j ^= bit;
+        if (i < j) {
+            std::swap(re[i], re[j]);
+            std::swap(im[i], im[j]);
+        }
+    }
+}
+
+void FFTMultiplier::fold(const std::vector<std::uint64_t>& a, std::vector<double>& re,
+                         std::vector<double>& im) const {
+    const std::uint64_t half_q = q_ / 2;
+    auto center = [&](std::uint64_t c) {
+        return (c > half_q) ? -static_cast<double>(q_ - c) : static_cast<double>(c);
+    };
+
+    re.resize(m_);
+    im.resize(m_);
+    for (std::size_t j = 0; j < m_; ++j) {
+        double x = center(a[j]);
+        double y = center(a[j + m_]);
+        re[j] = x * twist_re_[j] - y * twist_im_[j];
+        im[j] = x * twist_im_[j] + y * twist_re_[j];
+    }
+}
+
+void FFTMultiplier::transform(std::vector<double>& re, std::vector<double>& im, bool inverse) const {
+    bitReverse(re, im);
+
+    const double sign = inverse ? -1.0 : 1.0;
+    for (std::size_t half = 1; half < m_; half <<= 1) {
+        const double* w_re = root_re_.data() + (half - 1);
+        const double* w_im = root_im_.data() + (half - 1);
+        for (std::size_t i = 0; i < m_; i += 2 * half) {
+            for (std::size_t j = 0; j < half; ++j) {
+                const double wr = w_re[j];
+                const double wi = sign * w_im[j];
+                const double vr = re[i + j + half] * wr - im[i + j + half] * wi;
+                const double vi = re[i + j + half] * wi + im[i + j + half] * wr;
+                const double ur = re[i + j];
+                const double ui = im[i + j];
+                re[i + j] = ur + vr;
+                im[i + j] = ui + vi;
+                re[i + j + half] = ur - vr;
+                im[i + j + half] = ui - vi;
+            }
+        }
+    }
+}
+
+bool FFTMultiplier::tryMultiply(const std::vector<std::uint64_t>& a,
+                                const std::vector<std::uint64_t>& b,
+                                std::vector<std::uint64_t>& out) const {
+    if (a.size() != n_ || b.size() != n_) {
+        throw std::invalid_argument("FFTMultiplier: operand size mismatch");
+    }
+
+    std::vector<double> a_re, a_im, b_re, b_im;
+    fold(a, a_re, a_im);
+    fold(b, b_re, b_im);
+
+    transform(a_re, a_im, /*inverse=*/false);
+    transform(b_re, b_im, /*inverse=*/false);
+
+    for (std::size_t j = 0; j < m_; ++j) {
+        const double re = a_re[j] * b_re[j] - a_im[j] * b_im[j];
+        const double im = a_re[j] * b_im[j] + a_im[j] * b_re[j];
+        a_re[j] = re;
+        a_im[j] = im;
+    }
+
+    transform(a_re, a_im, /*inverse=*/true);
+
+    // Untwist by zeta^{-j}, scale by 1/m, round and reduce. The real part
+    // holds coefficient j and the imaginary part coefficient j + n/2.
+    const double scale = 1.0 / static_cast<double>(m_);
+    const Modulus& mod = Modulus::forValue(q_);
+    out.resize(n_);
+    for (std::size_t j = 0; j < m_; ++j) {
+        const double re = (a_re[j] * twist_re_[j] + a_im[j] * twist_im_[j]) * scale;
+        const double im = (a_im[j] * twist_re_[j] - a_re[j] * twist_im_[j]) * scale;
+        const double re_round = std::nearbyint(re);
+        const double im_round = std::nearbyint(im);
+        if (std::fabs(re - re_round) > ROUNDING_TOLERANCE ||
+            std::fabs(im - im_round) > ROUNDING_TOLERANCE) {
+            return false;
+        }
+
+        out[j] = mod.reduceSigned(static_cast<std::int64_t>(re_round));
+        out[j + m_] = mod.reduceSigned(static_cast<std::int64_t>(im_round));
+    }
+    return true;
+}
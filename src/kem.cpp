@@ -1,10 +1,14 @@
 #include <polynomial.h>
+#include <binary_polynomial.h>
+#include <ntt.h>
 #include <kem.h>
 #include <cmath>
+#include <algorithm>
 #include <cstring>
 #include <stdexcept>
 #include <limits>
 #include <random>
+#include <utility>
 #include <sha256.h>
 
 #if defined(_WIN32)
@@ -57,7 +61,9 @@ double KEM::getRandomDouble() {
     getSecureRandomBytes(reinterpret_cast<uint8_t*>(&r1), sizeof(r1));
     getSecureRandomBytes(reinterpret_cast<uint8_t*>(&r2), sizeof(r2));
     
-    double u1 = static_cast<double>(r1) / std::numeric_limits<uint64_t>::max();
+    // u1 = (r1 + 1) / 2^64 lies in [2^-64, 1], so log(u1) is finite and the
+    // radius is bounded (see kGaussianTail).
+    double u1 = std::ldexp(static_cast<double>(r1) + 1.0, -64);
     double u2 = static_cast<double>(r2) / std::numeric_limits<uint64_t>::max();
     
     double radius = std::sqrt(-2 * std::log(u1));
@@ -93,6 +99,21 @@ static bool validatePowerOfTwo(size_t n) {
 #endif
 }
 
+// Bound on |getRandomDouble()|: u1 >= 2^-64 there, so sqrt(-2 ln u1) <= 9.42.
+static constexpr double kGaussianTail = 9.5;
+
+// Every rounded sample of sigma * getRandomDouble() must be storable in a
+// SmallPolynomial16 for modulus q, so sampleGaussian() never truncates.
+static void requireSamplableStddev(double sigma, uint64_t q) {
+    const double window = std::min(static_cast<double>(std::numeric_limits<int16_t>::max()),
+                                   static_cast<double>(q - 1));
+    if (!(sigma * kGaussianTail + 0.5 <= window)) {
+        throw std::invalid_argument("Gaussian standard deviation " + std::to_string(sigma) +
+                                    " is too large for q=" + std::to_string(q) +
+                                    " and 16-bit centered samples");
+    }
+}
+
 RLWEParams KEM::getParameterSet(SecurityLevel level) {
     switch (level) {
         case SecurityLevel::TEST_TINY:
@@ -118,17 +139,21 @@ RLWEParams KEM::getParameterSet(SecurityLevel level) {
 KEM::KEM(size_t n, uint64_t q, double sigma)
     : ring_dim_n(n),
       modulus(q),
+      modulus_info(&Modulus::forValue(q)),
       gaussian_stddev(sigma > 0 ? sigma : 3.2),
       a(n, q),
       b(n, q),
-      s(n, q)
+      s(n, q),
+      b_prepared(b),
+      s_prepared(s.toPolynomial())
 {
     if (!validatePowerOfTwo(n)) {
         throw std::invalid_argument("n must be a power of 2");
     }
+    requireSamplableStddev(gaussian_stddev, q);
 
-    Logger::log("Created RLWE instance with n=" + std::to_string(n) + 
-                ", q=" + std::to_string(q) + ", σ=" + std::to_string(gaussian_stddev));
+    RLWE_LOG_INFO("Created RLWE instance with n=" + std::to_string(n) + 
+                  ", q=" + std::to_string(q) + ", σ=" + std::to_string(gaussian_stddev));
     
     validateSecurityParameters();
 }
@@ -136,46 +161,53 @@ KEM::KEM(size_t n, uint64_t q, double sigma)
 KEM::KEM(SecurityLevel level) 
     : ring_dim_n(0),
       modulus(0),
+      modulus_info(nullptr),
       gaussian_stddev(0),
       a(1, 1),
       b(1, 1),
-      s(1, 1)
+      s(1, 1),
+      b_prepared(b),
+      s_prepared(s.toPolynomial())
 {
     RLWEParams params = getParameterSet(level);
     
     ring_dim_n = params.n;
     modulus = params.q;
+    modulus_info = &Modulus::forValue(params.q);
     gaussian_stddev = params.sigma;
     
     a = Polynomial(params.n, params.q);
     b = Polynomial(params.n, params.q);
-    s = Polynomial(params.n, params.q);
+    s = SmallPolynomial16(params.n, params.q);
+    b_prepared = PreparedPolynomial(b);
+    s_prepared = PreparedPolynomial(s.toPolynomial());
     
     if (!validatePowerOfTwo(ring_dim_n)) {
         throw std::invalid_argument("n must be a power of 2");
     }
-    
-    Logger::log("\n" + std::string(70, '='));
-    Logger::log("RLWE INSTANCE CREATED");
-    Logger::log(std::string(70, '='));
-    Logger::log("Security Level: " + std::string(params.name));
-    Logger::log("Parameters: n=" + std::to_string(params.n) + 
-                ", q=" + std::to_string(params.q) + 
-                ", σ=" + std::to_string(params.sigma));
-    Logger::log("Estimated Security:");
-    Logger::log("  Classical: ~" + std::to_string(params.classical_bits) + " bits");
-    Logger::log("  Quantum:   ~" + std::to_string(params.quantum_bits) + " bits");
+    requireSamplableStddev(gaussian_stddev, modulus);
+    
+    RLWE_LOG_INFO("\n" + std::string(70, '='));
+    RLWE_LOG_INFO("RLWE INSTANCE CREATED");
+    RLWE_LOG_INFO(std::string(70, '='));
+    RLWE_LOG_INFO("Security Level: " + std::string(params.name));
+    RLWE_LOG_INFO("Parameters: n=" + std::to_string(params.n) + 
+                  ", q=" + std::to_string(params.q) + 
+                  ", σ=" + std::to_string(params.sigma));
+    RLWE_LOG_INFO("Estimated Security:");
+    RLWE_LOG_INFO("  Classical: ~" + std::to_string(params.classical_bits) + " bits");
+    RLWE_LOG_INFO("  Quantum:   ~" + std::to_string(params.quantum_bits) + " bits");
     
     if (!params.is_secure) {
-        Logger::log("\n⚠️  WARNING: INSECURE PARAMETERS ⚠️");
-        Logger::log("These parameters provide insufficient security!");
-        Logger::log("Only use for testing and development.");
-        Logger::log("For production, use SecurityLevel::KYBER512 or higher.");
-        Logger::log("⚠️  DO NOT USE IN PRODUCTION ⚠️\n");
+        RLWE_LOG_WARN("\n⚠️  WARNING: INSECURE PARAMETERS ⚠️");
+        RLWE_LOG_WARN("These parameters provide insufficient security!");
+        RLWE_LOG_WARN("Only use for testing and development.");
+        RLWE_LOG_WARN("For production, use SecurityLevel::KYBER512 or higher.");
+        RLWE_LOG_WARN("⚠️  DO NOT USE IN PRODUCTION ⚠️\n");
     } else {
-        Logger::log("\n✓ Parameters meet cryptographic security requirements");
+        RLWE_LOG_INFO("\n✓ Parameters meet cryptographic security requirements");
     }
-    Logger::log(std::string(70, '=') + "\n");
+    RLWE_LOG_INFO(std::string(70, '=') + "\n");
     
     validateSecurityParameters();
 }
@@ -207,131 +239,100 @@ RLWEParams KEM::getParameters() const {
 void KEM::validateSecurityParameters() {
     double alpha = gaussian_stddev / modulus;
     
-    Logger::log("\nValidating security parameters...");
-    Logger::log("Ring dimension (n):     " + std::to_string(ring_dim_n));
-    Logger::log("Modulus (q):            " + std::to_string(modulus));
-    Logger::log("Gaussian σ:             " + std::to_string(gaussian_stddev));
-    Logger::log("Noise ratio (α = σ/q):  " + std::to_string(alpha));
+    RLWE_LOG_DEBUG("\nValidating security parameters...");
+    RLWE_LOG_DEBUG("Ring dimension (n):     " + std::to_string(ring_dim_n));
+    RLWE_LOG_DEBUG("Modulus (q):            " + std::to_string(modulus));
+    RLWE_LOG_DEBUG("Gaussian σ:             " + std::to_string(gaussian_stddev));
+    RLWE_LOG_DEBUG("Noise ratio (α = σ/q):  " + std::to_string(alpha));
     
     if (ring_dim_n < 256) {
-        Logger::log("⚠️  WARNING: Ring dimension n=" + std::to_string(ring_dim_n) + 
-                   " is below recommended minimum of 256");
-        Logger::log("   Current security: ~" + std::to_string(ring_dim_n * 0.5) + 
-                   " bits (INSECURE)");
-        Logger::log("   Recommended: n >= 256 for production use");
+        RLWE_LOG_WARN("⚠️  WARNING: Ring dimension n=" + std::to_string(ring_dim_n) + 
+                     " is below recommended minimum of 256");
+        RLWE_LOG_WARN("   Current security: ~" + std::to_string(ring_dim_n * 0.5) + 
+                     " bits (INSECURE)");
+        RLWE_LOG_WARN("   Recommended: n >= 256 for production use");
     }
     
     if (alpha > 0.01) {
-        Logger::log("⚠️  WARNING: Large noise ratio α=" + std::to_string(alpha) + 
-                   " may affect correctness");
+        RLWE_LOG_WARN("⚠️  WARNING: Large noise ratio α=" + std::to_string(alpha) + 
+                     " may affect correctness");
     }
     
     if (validatePowerOfTwo(ring_dim_n)) {
-        Logger::log("✓ Ring dimension is a power of 2 (required for efficiency)");
+        RLWE_LOG_DEBUG("✓ Ring dimension is a power of 2 (required for efficiency)");
     }
     
-    Logger::log("Parameter validation complete.\n");
+    RLWE_LOG_DEBUG("Parameter validation complete.\n");
 }
 
 void KEM::generateKeys() {
-    Logger::log("\nGenerating keys...");
-    a = sampleUniform();
+    RLWE_LOG_INFO("\nGenerating keys...");
+    a = sampleUniformNTT();
     s = sampleGaussian(gaussian_stddev);
+    s_prepared = PreparedPolynomial(s.toPolynomial());
     
-    Logger::log("Sampling gaussian polynomial e with σ=" + std::to_string(gaussian_stddev));
-    Polynomial e = sampleGaussian(gaussian_stddev);
+    RLWE_LOG_DEBUG("Sampling gaussian polynomial e with σ=" + std::to_string(gaussian_stddev));
+    const SmallPolynomial16 e = sampleGaussian(gaussian_stddev);
     
-    Logger::log("Computing b = a*s + e");
-    b = a * s + e;
+    RLWE_LOG_DEBUG("Computing b = a*s + e");
+    // a is NTT-domain and s is prepared, so a*s is a single pointwise pass.
+    b = a * s_prepared;
+    e.addTo(b);
+    b_prepared = PreparedPolynomial(b);
     
-    Logger::log("Public key a: " + a.toString());
-    Logger::log("Public key b: " + b.toString());  
-    Logger::log("Secret key s: " + s.toString());
+    RLWE_LOG_TRACE("Public key a: " + a.toString());
+    RLWE_LOG_TRACE("Public key b: " + b.toString());  
+    RLWE_LOG_TRACE("Secret key s: " + s.toPolynomial().toString());
 }
 
 Polynomial KEM::sampleUniform() {
     std::vector<uint64_t> coeffs(ring_dim_n);
     
     for (size_t i = 0; i < ring_dim_n; i++) {
-        coeffs[i] = getRandomUint64() % modulus;
+        coeffs[i] = modulus_info->reduce(getRandomUint64());
     }
     
-    return Polynomial(coeffs, modulus);
+    return Polynomial(std::move(coeffs), modulus);
 }
 
-Polynomial KEM::sampleGaussian(double stddev) {
-    std::vector<uint64_t> coeffs(ring_dim_n);
+Polynomial KEM::sampleUniformNTT() {
+    if (!NTT::hasTables(ring_dim_n, modulus)) {
+        return sampleUniform();
+    }
+
+    std::vector<uint64_t> evals(ring_dim_n);
+    for (size_t i = 0; i < ring_dim_n; i++) {
+        evals[i] = modulus_info->reduce(getRandomUint64());
+    }
+
+    return Polynomial(PolynomialView(evals.data(), ring_dim_n, modulus, PolyDomain::NTT));
+}
+
+SmallPolynomial16 KEM::sampleGaussian(double stddev) {
+    SmallPolynomial16 result(ring_dim_n, modulus);
     
     for (size_t i = 0; i < ring_dim_n; i++) {
         double sample = getRandomDouble() * stddev;
         int64_t rounded = static_cast<int64_t>(std::round(sample));
         
-        if (rounded < 0) {
-            rounded += modulus;
-        }
-        
-        coeffs[i] = rounded;
+        result.set(i, rounded);
     }
     
-    return Polynomial(coeffs, modulus);
+    return result;
 }
 
 Polynomial KEM::messageToPolynomial(const std::vector<uint8_t>& message) {
-    std::vector<uint64_t> coeffs(ring_dim_n, 0);
-    
-    size_t coeff_idx = 0;
-    for (size_t byte_idx = 0; byte_idx < message.size() && coeff_idx < ring_dim_n; byte_idx++) {
-        uint8_t byte = message[byte_idx];
-        for (int j = 7; j >= 0 && coeff_idx < ring_dim_n; j--) {
-            coeffs[coeff_idx++] = (byte >> j) & 1;
-        }
-    }
-        
-    return Polynomial(coeffs, modulus);
+    return BinaryPolynomial::fromBytes(message.data(), message.size(), ring_dim_n, modulus, 1)
+        .toPolynomial();
 }
 
 Polynomial KEM::hashToPolynomial(const std::vector<uint8_t>& message) {
-    Logger::log("\nConverting message to polynomial using counter-based hashing");
-    logMessageBytes("Input message", message);
-    
-    std::vector<uint64_t> coeffs(ring_dim_n, 0);
-        
-    size_t coeff_idx = 0;
-    uint32_t counter = 0;
-    
-    while (coeff_idx < ring_dim_n) {
-        std::vector<uint8_t> block;
-        block.reserve(message.size() + sizeof(counter));
-        const uint8_t* counter_bytes = reinterpret_cast<const uint8_t*>(&counter);
-        block.insert(block.end(), counter_bytes, counter_bytes + sizeof(counter));
-        block.insert(block.end(), message.begin(), message.end());
-        Logger::log("Block " + std::to_string(counter) + " content:");
-        logMessageBytes("  ", block);
-        std::vector<uint8_t> hash = SHA256::hash(block);
-        std::stringstream ss;
-        ss << "Block " << counter << " hash: ";
-        for (uint8_t b : hash) {
-            ss << std::hex << std::setw(2) << std::setfill('0') << static_cast<int>(b);
-        }
-        Logger::log(ss.str());
+    RLWE_LOG_TRACE("\nConverting message to polynomial using counter-based hashing");
+    RLWE_LOG_TRACE(formatMessageBytes("Input message", message));
 
-        for (size_t byte_idx = 0; coeff_idx < ring_dim_n && byte_idx < hash.size(); byte_idx++) {
-            for (int bit = 7; bit >= 0 && coeff_idx < ring_dim_n; bit--) {
-                bool bit_value = (hash[byte_idx] >> bit) & 1;
-                coeffs[coeff_idx++] = bit_value ? (modulus / 2) : 0;
-            }
-        }
-        
-        counter++;
-    }
-    
-    Logger::log("Final polynomial coefficients:");
-    std::stringstream result_ss;
-    for (size_t i = 0; i < coeffs.size(); i++) {
-        if (i > 0) result_ss << ", ";
-        result_ss << coeffs[i];
-    }
-    Logger::log(result_ss.str());
-    
-    return Polynomial(coeffs, modulus);
+    const BinaryPolynomial bits = BinaryPolynomial::fromSHA256(message, ring_dim_n, modulus);
+
+    RLWE_LOG_TRACE("Hash bits set: " + std::to_string(bits.popcount()) + " of " +
+                   std::to_string(ring_dim_n));
+    return bits.toPolynomial();
 }
\ No newline at end of file
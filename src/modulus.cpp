@@ -0,0 +1,100 @@
+#include <modulus.h>
+
+#include <map>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+
+#include <special_prime.h>
+
+namespace {
+
+unsigned bitLength(std::uint64_t x) {
+    unsigned bits = 0;
+    for (; x; x >>= 1) {
+        ++bits;
+    }
+    return bits;
+}
+
+} // namespace
+
+Modulus::Modulus(std::uint64_t q)
+    : q_(q),
+      bits_(q > 1 ? bitLength(q - 1) : 1),
+      width_(bitLength(q)),
+      barrett64_(~std::uint64_t(0) / q),
+      word_barrett_(q < (std::uint64_t(1) << 31)),
+      mu_(0),
+      montgomery_((q & 1) != 0 && q > 1 && q < (std::uint64_t(1) << 31)),
+      q_inv_neg_(0),
+      r2_(0),
+      special_(SpecialPrimeReducer::forModulus(q)) {
+    if (word_barrett_) {
+        mu_ = (std::uint64_t(1) << (2 * width_)) / q;
+    }
+    if (montgomery_) {
+        // Newton iteration for q^{-1} mod 2^32: q * q == 1 (mod 8) for odd
+        // q, and every step doubles the number of correct low bits.
+        std::uint64_t inv = q;
+        for (int i = 0; i < 4; ++i) {
+            inv = (inv * (2 - q * inv)) & 0xFFFFFFFFu;
+        }
+        q_inv_neg_ = (std::uint64_t(0) - inv) & 0xFFFFFFFFu;
+        const std::uint64_t r = reduce(~std::uint64_t(0)) + 1;  // 2^64 mod q
+        r2_ = r == q ? 0 : r;
+    }
+}
+
+const Modulus& Modulus::forValue(std::uint64_t q) {
+    thread_local const Modulus* last = nullptr;
+    if (last && last->q_ == q) {
+        return *last;
+    }
+    if (q == 0) {
+        throw std::invalid_argument("Modulus must be positive");
+    }
+
+    static std::mutex mutex;
+    static std::map<std::uint64_t, std::unique_ptr<const Modulus>> interned;
+
+    std::lock_guard<std::mutex> lock(mutex);
+    auto it = interned.find(q);
+    if (it == interned.end()) {
+        it = interned.emplace(q, std::unique_ptr<const Modulus>(new Modulus(q))).first;
+    }
+    last = it->second.get();
+    return *last;
+}
+
+std::uint64_t Modulus::mulWide(std::uint64_t a, std::uint64_t b) const {
+    // Double-and-add over the bits of b: only additions modulo q, so no
+    // 128-bit intermediate is needed. Used only for q >= 2^31.
+    std::uint64_t r = 0;
+    for (int bit = 63; bit >= 0; --bit) {
+        r = add(r, r);
+        if ((b >> bit) & 1) {
+            r = add(r, a);
+        }
+    }
+    return r;
+}
+
+std::uint64_t Modulus::pow(std::uint64_t base, std::uint64_t exp) const {
+    base = reduce(base);
+    if (montgomery_) {
+        std::uint64_t x = toMontgomery(base);
+        std::uint64_t res = toMontgomery(1);
+        for (; exp; exp >>= 1) {
+            if (exp & 1) res = montgomeryMul(res, x);
+            x = montgomeryMul(x, x);
+        }
+        return fromMontgomery(res);
+    }
+    std::uint64_t res = reduce(1);
+    for (; exp; exp >>= 1) {
+        if (exp & 1) res = mul(res, base);
+        base = mul(base, base);
+    }
+    return res;
+}
@@ -1,6 +1,46 @@
 #include <ntt.h>
 
 #include <algorithm>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <tuple>
+#include <utility>
+
+#include <poly_memory.h>
+
+namespace {
+
+using RingKey = std::pair<std::size_t, std::uint64_t>;
+
+std::mutex& registryMutex() {
+    static std::mutex mutex;
+    return mutex;
+}
+
+std::map<RingKey, NTTKernel>& preferredKernels() {
+    static std::map<RingKey, NTTKernel> kernels;
+    return kernels;
+}
+
+// Instance bound by the innermost NTT::RingScope on this thread.
+thread_local const NTT* bound_ring = nullptr;
+
+// Transform a polynomial's coefficients without a temporary copy: 32- and
+// 64-bit storage is transformed where it lives, 16-bit storage through a
+// 32-bit scratch buffer.
+template<typename Coeff>
+void transformInPlace(const NTT& ntt, Coeff* data, std::size_t n, bool inverse) {
+    if constexpr (sizeof(Coeff) >= sizeof(std::uint32_t)) {
+        inverse ? ntt.inverse(data, n) : ntt.forward(data, n);
+    } else {
+        std::pmr::vector<std::uint32_t> tmp(data, data + n, poly_memory::scratch());
+        inverse ? ntt.inverse(tmp.data(), n) : ntt.forward(tmp.data(), n);
+        std::copy(tmp.begin(), tmp.end(), data);
+    }
+}
+
+} // namespace
 
 bool NTT::isPowerOfTwo(std::size_t n) {
     return n && ((n & (n - 1)) == 0);
@@ -30,7 +70,8 @@ std::uint64_t NTT::modInverse(std::uint64_t a, std::uint64_t m) {
     return static_cast<std::uint64_t>(t);
 }
 
-void NTT::bitReverse(std::vector<std::uint64_t>& a) const {
+template<typename Word>
+void NTT::bitReverse(Word* a) const {
     std::size_t n = n_;
     std::size_t j = 0;
     for (std::size_t i = 1; i < n - 1; ++i) {
@@ -45,8 +86,9 @@ void NTT::bitReverse(std::vector<std::uint64_t>& a) const {
     }
 }
 
-void NTT::ntt(std::vector<std::uint64_t>& a, bool inverse) const {
-    const std::uint64_t q = q_;
+template<typename Word>
+void NTT::ntt(Word* a, bool inverse) const {
+    const Modulus mod = *modulus_;
 
     bitReverse(a);
 
@@ -54,17 +96,17 @@ void NTT::ntt(std::vector<std::uint64_t>& a, bool inverse) const {
     while (len <= n_) {
         std::uint64_t wlen = inverse ? omega_inv_ : omega_;
         for (std::size_t i = len; i < n_; i <<= 1) {
-            wlen = modMul(wlen, wlen, q);
+            wlen = mod.mul(wlen, wlen);
         }
 
         for (std::size_t i = 0; i < n_; i += len) {
             std::uint64_t w = 1;
             for (std::size_t j = 0; j < len / 2; ++j) {
                 std::uint64_t u = a[i + j];
-                std::uint64_t v = modMul(a[i + j + len / 2], w, q);
-                a[i + j] = modAdd(u, v, q);
-                a[i + j + len / 2] = modSub(u, v, q);
-                w = modMul(w, wlen, q);
+                std::uint64_t v = mod.mul(a[i + j + len / 2], w);
+                a[i + j] = mod.add(u, v);
+                a[i + j + len / 2] = mod.sub(u, v);
+                w = mod.mul(w, wlen);
             }
         }
         len <<= 1;
@@ -72,15 +114,146 @@ void NTT::ntt(std::vector<std::uint64_t>& a, bool inverse) const {
 
     if (inverse) {
         for (std::size_t i = 0; i < n_; ++i) {
-            a[i] = modMul(a[i], n_inv_, q);
+            a[i] = mod.mul(a[i], n_inv_);
         }
     }
 }
 
+template<typename Word>
+void NTT::nttLazy(Word* a, const ntt_tables::twiddle_t* twiddles,
+                  const std::uint32_t* twiddles_shoup) const {
+    // Harvey butterflies: inputs and outputs stay in [0, 4q) so that only
+    // one conditional subtraction is needed per butterfly.
+    const std::uint64_t q = q_;
+    const std::uint64_t two_q = 2 * q;
+
+    bitReverse(a);
+
+    for (std::size_t half = 1; half < n_; half <<= 1) {
+        const ntt_tables::twiddle_t* w = twiddles + (half - 1);
+        const std::uint32_t* w_shoup = twiddles_shoup + (half - 1);
+        for (std::size_t i = 0; i < n_; i += 2 * half) {
+            for (std::size_t j = 0; j < half; ++j) {
+                std::uint64_t x = a[i + j];
+                if (x >= two_q) x -= two_q;
+                std::uint64_t t = shoupMulLazy(a[i + j + half], w[j], w_shoup[j], q);
+                a[i + j] = x + t;
+                a[i + j + half] = x - t + two_q;
+            }
+        }
+    }
+}
+
+template<typename Word>
+void NTT::forwardLazy(Word* a) const {
+    const std::uint64_t q = q_;
+
+    for (std::size_t i = 0; i < n_; ++i) {
+        a[i] = shoupMulLazy(a[i], twist_[i], twist_shoup_[i], q);
+    }
+
+    nttLazy(a, fwd_twiddles_, fwd_twiddles_shoup_.data());
+
+    for (std::size_t i = 0; i < n_; ++i) {
+        std::uint64_t x = a[i];
+        if (x >= 2 * q) x -= 2 * q;
+        if (x >= q) x -= q;
+        a[i] = x;
+    }
+}
+
+template<typename Word>
+void NTT::inverseLazy(Word* a) const {
+    const std::uint64_t q = q_;
+
+    nttLazy(a, inv_twiddles_, inv_twiddles_shoup_.data());
+
+    // Undo the twist and scale by n^{-1} in the same pass.
+    for (std::size_t i = 0; i < n_; ++i) {
+        std::uint64_t x = shoupMulLazy(a[i], untwist_[i], untwist_shoup_[i], q);
+        if (x >= q) x -= q;
+        a[i] = x;
+    }
+}
+
+void NTT::initShoupCompanions() {
+    const Modulus& mod = *modulus_;
+    auto companions = [&mod](const ntt_tables::twiddle_t* values, std::size_t count) {
+        std::vector<std::uint32_t> out(count);
+        for (std::size_t i = 0; i < count; ++i) {
+            out[i] = static_cast<std::uint32_t>(mod.shoup(values[i]));
+        }
+        return out;
+    };
+    twist_shoup_ = companions(twist_, n_);
+    untwist_shoup_ = companions(untwist_, n_);
+    fwd_twiddles_shoup_ = companions(fwd_twiddles_, n_ - 1);
+    inv_twiddles_shoup_ = companions(inv_twiddles_, n_ - 1);
+}
+
+template<typename Word>
+void NTT::nttSpecialPrime(Word* a,
+                          const ntt_tables::twiddle_t* twiddles) const {
+    const SpecialPrimeReducer& red = *reducer_;
+    const std::uint64_t q = q_;
+
+    bitReverse(a);
+
+    for (std::size_t half = 1; half < n_; half <<= 1) {
+        const ntt_tables::twiddle_t* w = twiddles + (half - 1);
+        for (std::size_t i = 0; i < n_; i += 2 * half) {
+            for (std::size_t j = 0; j < half; ++j) {
+                std::uint64_t u = a[i + j];
+                std::uint64_t v = red.kred2(static_cast<std::uint64_t>(a[i + j + half]) * w[j]);
+                a[i + j] = modAdd(u, v, q);
+                a[i + j + half] = modSub(u, v, q);
+            }
+        }
+    }
+}
+
+template<typename Word>
+void NTT::forwardSpecialPrime(Word* a) const {
+    const SpecialPrimeReducer& red = *reducer_;
+    for (std::size_t i = 0; i < n_; ++i) {
+        a[i] = red.kred2(static_cast<std::uint64_t>(a[i]) * twist_kred_[i]);
+    }
+    nttSpecialPrime(a, fwd_twiddles_kred_.data());
+}
+
+template<typename Word>
+void NTT::inverseSpecialPrime(Word* a) const {
+    const SpecialPrimeReducer& red = *reducer_;
+    nttSpecialPrime(a, inv_twiddles_kred_.data());
+    for (std::size_t i = 0; i < n_; ++i) {
+        a[i] = red.kred2(static_cast<std::uint64_t>(a[i]) * untwist_kred_[i]);
+    }
+}
+
+void NTT::initSpecialPrimeTables() {
+    reducer_ = modulus_->special();
+    const SpecialPrimeReducer& red = *reducer_;
+    auto prescaled = [&red](const ntt_tables::twiddle_t* values, std::size_t count) {
+        std::vector<ntt_tables::twiddle_t> out(count);
+        for (std::size_t i = 0; i < count; ++i) {
+            out[i] = static_cast<ntt_tables::twiddle_t>(red.prescale(values[i]));
+        }
+        return out;
+    };
+    twist_kred_ = prescaled(twist_, n_);
+    untwist_kred_ = prescaled(untwist_, n_);
+    fwd_twiddles_kred_ = prescaled(fwd_twiddles_, n_ - 1);
+    inv_twiddles_kred_ = prescaled(inv_twiddles_, n_ - 1);
+}
+
 NTT::NTT(std::size_t n, std::uint64_t modulus_q, bool negacyclic)
-    : n_(n), q_(modulus_q), negacyclic_(negacyclic),
+    : NTT(n, modulus_q, negacyclic, preferredKernel(n, modulus_q)) {}
+
+NTT::NTT(std::size_t n, std::uint64_t modulus_q, bool negacyclic, NTTKernel kernel)
+    : n_(n), q_(modulus_q), modulus_(nullptr), negacyclic_(negacyclic), kernel_(kernel),
       omega_(0), omega_inv_(0), n_inv_(0),
-      psi_(0), psi_inv_(0), psi_powers_(nullptr), psi_powers_inv_(nullptr) {
+      psi_(0), psi_inv_(0), twist_(nullptr), untwist_(nullptr),
+      fwd_twiddles_(nullptr), inv_twiddles_(nullptr), reducer_(nullptr) {
 
     if (!isPowerOfTwo(n_)) {
         throw std::invalid_argument("NTT size n must be a power of two");
@@ -88,10 +261,17 @@ NTT::NTT(std::size_t n, std::uint64_t modulus_q, bool negacyclic)
     if (q_ < 2) {
         throw std::invalid_argument("Modulus q must be >= 2");
     }
+    modulus_ = &Modulus::forValue(q_);
+
+    if (!isKernelSupported(kernel_, n_, q_)) {
+        throw std::invalid_argument(std::string("NTT kernel '") + kernelName(kernel_) +
+                                    "' is not supported for the given (n, q)");
+    }
 
-    Logger::log("Initializing NTT with n=" + std::to_string(n_) +
-                ", q=" + std::to_string(q_) +
-                ", negacyclic=" + std::string(negacyclic_ ? "true" : "false"));
+    RLWE_LOG_DEBUG("Initializing NTT with n=" + std::to_string(n_) +
+                   ", q=" + std::to_string(q_) +
+                   ", negacyclic=" + std::string(negacyclic_ ? "true" : "false") +
+                   ", kernel=" + kernelName(kernel_));
 
     if (!negacyclic_) {
         throw std::invalid_argument("Only negacyclic NTT is supported in this implementation");
@@ -113,69 +293,295 @@ NTT::NTT(std::size_t n, std::uint64_t modulus_q, bool negacyclic)
     psi_inv_ = tbl->psi_inv;
 
     // Underlying n‑point NTT uses omega = psi^2 (order n).
-    omega_ = modMul(psi_, psi_, q_);
+    omega_ = modulus_->mul(psi_, psi_);
     omega_inv_ = modInverse(omega_, q_);
 
     n_inv_ = modInverse(static_cast<std::uint64_t>(n_), q_);
 
-    if (negacyclic_) {
-        // Keep pointers to precomputed twist tables (not used directly in the
-        // current implementation, but useful for offline verification).
-        psi_powers_ = tbl->twist;
-        psi_powers_inv_ = tbl->twist_inv;
+    // The reference kernel derives psi^i and psi^{-i} on the fly; the lazy
+    // kernel streams the compact precomputed tables.
+    twist_ = tbl->twist;
+    untwist_ = tbl->untwist;
+    fwd_twiddles_ = tbl->fwd_layers;
+    inv_twiddles_ = tbl->inv_layers;
+
+    if (kernel_ == NTTKernel::Lazy) {
+        initShoupCompanions();
+    } else if (kernel_ == NTTKernel::SpecialPrime) {
+        initSpecialPrimeTables();
     }
 
-    Logger::log("NTT initialization complete");
+    RLWE_LOG_DEBUG("NTT initialization complete");
+}
+
+const NTT& NTT::forRing(std::size_t n, std::uint64_t modulus_q) {
+    static std::map<std::tuple<std::size_t, std::uint64_t, NTTKernel>,
+                    std::unique_ptr<const NTT>> instances;
+
+    if (bound_ring && bound_ring->n_ == n && bound_ring->q_ == modulus_q) {
+        return *bound_ring;
+    }
+
+    NTTKernel kernel = preferredKernel(n, modulus_q);
+
+    std::lock_guard<std::mutex> lock(registryMutex());
+    auto key = std::make_tuple(n, modulus_q, kernel);
+    auto it = instances.find(key);
+    if (it == instances.end()) {
+        it = instances.emplace(key, std::make_unique<const NTT>(n, modulus_q, true, kernel)).first;
+    }
+    return *it->second;
+}
+
+NTT::RingScope::RingScope(const NTT& ntt) : previous_(bound_ring) {
+    bound_ring = &ntt;
+}
+
+NTT::RingScope::~RingScope() {
+    bound_ring = previous_;
+}
+
+bool NTT::isKernelSupported(NTTKernel kernel, std::size_t n, std::uint64_t modulus_q) {
+    switch (kernel) {
+        case NTTKernel::Reference:
+            return true;
+        case NTTKernel::Lazy:
+            // Lazy values live in [0, 4q) and must stay below 2^32 for the
+            // 32-bit Shoup quotient.
+            return n >= 1 && modulus_q < (static_cast<std::uint64_t>(1) << 30);
+        case NTTKernel::SpecialPrime:
+            // Prescaled twiddles must fit the compact table type.
+            return n >= 1 && modulus_q <= 0xFFFF && SpecialPrimeReducer::isSpecialForm(modulus_q);
+    }
+    return false;
+}
+
+std::vector<NTTKernel> NTT::allKernels() {
+    return {NTTKernel::Reference, NTTKernel::Lazy, NTTKernel::SpecialPrime};
+}
+
+const char* NTT::kernelName(NTTKernel kernel) {
+    switch (kernel) {
+        case NTTKernel::Reference:
+            return "reference";
+        case NTTKernel::Lazy:
+            return "lazy";
+        case NTTKernel::SpecialPrime:
+            return "kred";
+    }
+    return "unknown";
+}
+
+NTTKernel NTT::kernelFromName(const std::string& name) {
+    for (NTTKernel kernel : allKernels()) {
+        if (name == kernelName(kernel)) {
+            return kernel;
+        }
+    }
+    throw std::invalid_argument("Unknown NTT kernel: " + name);
+}
+
+void NTT::setPreferredKernel(std::size_t n, std::uint64_t modulus_q, NTTKernel kernel) {
+    if (!isKernelSupported(kernel, n, modulus_q)) {
+        throw std::invalid_argument(std::string("NTT kernel '") + kernelName(kernel) +
+                                    "' is not supported for the given (n, q)");
+    }
+    std::lock_guard<std::mutex> lock(registryMutex());
+    preferredKernels()[RingKey(n, modulus_q)] = kernel;
+}
+
+NTTKernel NTT::preferredKernel(std::size_t n, std::uint64_t modulus_q) {
+    {
+        std::lock_guard<std::mutex> lock(registryMutex());
+        auto it = preferredKernels().find(RingKey(n, modulus_q));
+        if (it != preferredKernels().end()) {
+            return it->second;
+        }
+    }
+    return isKernelSupported(NTTKernel::Lazy, n, modulus_q) ? NTTKernel::Lazy
+                                                           : NTTKernel::Reference;
+}
+
+void NTT::clearPreferredKernels() {
+    std::lock_guard<std::mutex> lock(registryMutex());
+    preferredKernels().clear();
 }
 
 void NTT::forward(std::vector<std::uint64_t>& a) const {
-    if (a.size() != n_) {
+    forward(a.data(), a.size());
+}
+
+void NTT::inverse(std::vector<std::uint64_t>& a) const {
+    inverse(a.data(), a.size());
+}
+
+void NTT::forward(std::vector<std::uint32_t>& a) const {
+    forward(a.data(), a.size());
+}
+
+void NTT::inverse(std::vector<std::uint32_t>& a) const {
+    inverse(a.data(), a.size());
+}
+
+void NTT::forward(std::uint64_t* a, std::size_t count) const {
+    if (count != n_) {
+        throw std::invalid_argument("NTT::forward: input size mismatch");
+    }
+    forwardWords(a);
+}
+
+void NTT::inverse(std::uint64_t* a, std::size_t count) const {
+    if (count != n_) {
+        throw std::invalid_argument("NTT::inverse: input size mismatch");
+    }
+    inverseWords(a);
+}
+
+void NTT::forward(std::uint32_t* a, std::size_t count) const {
+    if (count != n_) {
         throw std::invalid_argument("NTT::forward: input size mismatch");
     }
+    if (q_ > (static_cast<std::uint64_t>(1) << 32)) {
+        throw std::invalid_argument("NTT::forward: modulus too large for 32-bit words");
+    }
+    forwardWords(a);
+}
+
+void NTT::inverse(std::uint32_t* a, std::size_t count) const {
+    if (count != n_) {
+        throw std::invalid_argument("NTT::inverse: input size mismatch");
+    }
+    if (q_ > (static_cast<std::uint64_t>(1) << 32)) {
+        throw std::invalid_argument("NTT::inverse: modulus too large for 32-bit words");
+    }
+    inverseWords(a);
+}
+
+template<typename Word>
+void NTT::forwardWords(Word* a) const {
+    if (kernel_ == NTTKernel::Lazy) {
+        forwardLazy(a);
+        return;
+    }
+    if (kernel_ == NTTKernel::SpecialPrime) {
+        forwardSpecialPrime(a);
+        return;
+    }
 
     if (negacyclic_) {
         // Apply the negacyclic twist: a_i <- a_i * psi^i
+        const Modulus mod = *modulus_;
         std::uint64_t w = 1;
         for (std::size_t i = 0; i < n_; ++i) {
-            a[i] = modMul(a[i], w, q_);
-            w = modMul(w, psi_, q_);
+            a[i] = mod.mul(a[i], w);
+            w = mod.mul(w, psi_);
         }
     }
 
     ntt(a, /*inverse=*/false);
 }
 
-void NTT::inverse(std::vector<std::uint64_t>& a) const {
-    if (a.size() != n_) {
-        throw std::invalid_argument("NTT::inverse: input size mismatch");
+template<typename Word>
+void NTT::inverseWords(Word* a) const {
+    if (kernel_ == NTTKernel::Lazy) {
+        inverseLazy(a);
+        return;
+    }
+    if (kernel_ == NTTKernel::SpecialPrime) {
+        inverseSpecialPrime(a);
+        return;
     }
 
     ntt(a, /*inverse=*/true);
 
     if (negacyclic_) {
         // Undo the twist: a_i <- a_i * psi^{-i}
+        const Modulus mod = *modulus_;
         std::uint64_t w_inv = 1;
         for (std::size_t i = 0; i < n_; ++i) {
-            a[i] = modMul(a[i], w_inv, q_);
-            w_inv = modMul(w_inv, psi_inv_, q_);
+            a[i] = mod.mul(a[i], w_inv);
+            w_inv = mod.mul(w_inv, psi_inv_);
         }
     }
 }
 
-void NTT::forward(Polynomial& poly) const {
+template<typename Coeff>
+void NTT::forward(BasicPolynomial<Coeff>& poly) const {
     if (poly.degree() != n_ || poly.getModulus() != q_) {
         throw std::invalid_argument("NTT::forward(Polynomial): ring dimension or modulus mismatch");
     }
-    std::vector<std::uint64_t> tmp = poly.getCoeffs();
-    forward(tmp);
-    poly.setCoefficients(tmp);
+    transformInPlace(*this, &poly[0], n_, /*inverse=*/false);
 }
 
-void NTT::inverse(Polynomial& poly) const {
+template<typename Coeff>
+void NTT::inverse(BasicPolynomial<Coeff>& poly) const {
     if (poly.degree() != n_ || poly.getModulus() != q_) {
         throw std::invalid_argument("NTT::inverse(Polynomial): ring dimension or modulus mismatch");
     }
-    std::vector<std::uint64_t> tmp = poly.getCoeffs();
-    inverse(tmp);
-    poly.setCoefficients(tmp);
+    transformInPlace(*this, &poly[0], n_, /*inverse=*/true);
+}
+
+template void NTT::forward(BasicPolynomial<std::uint16_t>&) const;
+template void NTT::forward(BasicPolynomial<std::uint32_t>&) const;
+template void NTT::forward(BasicPolynomial<std::uint64_t>&) const;
+template void NTT::inverse(BasicPolynomial<std::uint16_t>&) const;
+template void NTT::inverse(BasicPolynomial<std::uint32_t>&) const;
+template void NTT::inverse(BasicPolynomial<std::uint64_t>&) const;
+
+template<typename Coeff>
+void NTT::forward(const BasicPolynomialView<Coeff>& in, Coeff* out) const {
+    if (in.degree() != n_ || in.getModulus() != q_) {
+        throw std::invalid_argument("NTT::forward(view): ring dimension or modulus mismatch");
+    }
+    if (in.domain() != PolyDomain::Coefficient) {
+        throw std::invalid_argument("NTT::forward(view): input is already in the NTT domain");
+    }
+    std::copy(in.begin(), in.end(), out);
+    transformInPlace(*this, out, n_, /*inverse=*/false);
+}
+
+template<typename Coeff>
+void NTT::inverse(const BasicPolynomialView<Coeff>& in, Coeff* out) const {
+    if (in.degree() != n_ || in.getModulus() != q_) {
+        throw std::invalid_argument("NTT::inverse(view): ring dimension or modulus mismatch");
+    }
+    if (in.domain() != PolyDomain::NTT) {
+        throw std::invalid_argument("NTT::inverse(view): input is not in the NTT domain");
+    }
+    std::copy(in.begin(), in.end(), out);
+    transformInPlace(*this, out, n_, /*inverse=*/true);
+}
+
+template void NTT::forward(const BasicPolynomialView<std::uint16_t>&, std::uint16_t*) const;
+template void NTT::forward(const BasicPolynomialView<std::uint32_t>&, std::uint32_t*) const;
+template void NTT::forward(const BasicPolynomialView<std::uint64_t>&, std::uint64_t*) const;
+template void NTT::inverse(const BasicPolynomialView<std::uint16_t>&, std::uint16_t*) const;
+template void NTT::inverse(const BasicPolynomialView<std::uint32_t>&, std::uint32_t*) const;
+template void NTT::inverse(const BasicPolynomialView<std::uint64_t>&, std::uint64_t*) const;
+
+void NTT::batchInvert(std::vector<std::uint64_t>& values) const {
+    if (values.empty()) {
+        return;
+    }
+
+    // prefix[i] = values[0] * ... * values[i]
+    const Modulus& mod = *modulus_;
+    std::vector<std::uint64_t> prefix(values.size());
+    std::uint64_t acc = 1;
+    for (std::size_t i = 0; i < values.size(); ++i) {
+        if (mod.reduce(values[i]) == 0) {
+            throw std::invalid_argument("NTT::batchInvert: zero entry has no inverse");
+        }
+        acc = mod.mul(acc, values[i]);
+        prefix[i] = acc;
+    }
+
+    // inv holds (values[0] * ... * values[i])^{-1} while walking backwards.
+    std::uint64_t inv = modInverse(acc, q_);
+    for (std::size_t i = values.size() - 1; i > 0; --i) {
+        std::uint64_t value_inv = mod.mul(inv, prefix[i - 1]);
+        inv = mod.mul(inv, values[i]);
+        values[i] = value_inv;
+    }
+    values[0] = inv;
 }
@@ -0,0 +1,221 @@
+#include <ntt_autotune.h>
+
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <limits>
+#include <random>
+#include <sstream>
+#include <stdexcept>
+#include <utility>
+
+namespace {
+
+constexpr const char* CACHE_MAGIC = "rlwe-ntt-autotune";
+constexpr int CACHE_VERSION = 1;
+
+// Work per timed batch, measured in butterfly-sized units, so that small
+// rings run enough iterations to be measurable.
+constexpr std::size_t BATCH_WORK = std::size_t(1) << 16;
+
+} // namespace
+
+NTTAutotuner::NTTAutotuner(std::string cache_path)
+    : cache_path_(std::move(cache_path)), repetitions_(5) {
+    if (!cache_path_.empty()) {
+        loadCache();
+    }
+}
+
+void NTTAutotuner::setRepetitions(int repetitions) {
+    if (repetitions < 1) {
+        throw std::invalid_argument("NTTAutotuner: repetitions must be positive");
+    }
+    repetitions_ = repetitions;
+}
+
+std::vector<SecurityLevel> NTTAutotuner::registeredLevels() {
+    return {SecurityLevel::TEST_TINY, SecurityLevel::TEST_SMALL, SecurityLevel::KYBER512,
+            SecurityLevel::MODERATE, SecurityLevel::HIGH};
+}
+
+std::string NTTAutotuner::hostSignature() {
+    std::string sig;
+#if defined(__x86_64__) || defined(_M_X64)
+    sig = "x86_64";
+#elif defined(__aarch64__) || defined(_M_ARM64)
+    sig = "aarch64";
+#else
+    sig = "generic";
+#endif
+
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2")) sig += "+avx2";
+    if (__builtin_cpu_supports("avx512f")) sig += "+avx512f";
+    if (__builtin_cpu_supports("avx512bw")) sig += "+avx512bw";
+#endif
+    return sig;
+}
+
+const NTTTuningResult* NTTAutotuner::findResult(std::size_t n, std::uint64_t q) const {
+    for (const NTTTuningResult& r : results_) {
+        if (r.n == n && r.q == q) {
+            return &r;
+        }
+    }
+    return nullptr;
+}
+
+double NTTAutotuner::benchmark(const NTT& ntt) const {
+    const std::size_t n = ntt.size();
+    const std::uint64_t q = ntt.modulus();
+
+    std::mt19937_64 rng(0x4E545454756E65ULL ^ n ^ (q << 20));
+    std::uniform_int_distribution<std::uint64_t> dist(0, q - 1);
+    std::vector<std::uint64_t> input(n);
+    for (auto& c : input) {
+        c = dist(rng);
+    }
+
+    // Reject kernels that do not round-trip; they must never be selected.
+    std::vector<std::uint64_t> work = input;
+    ntt.forward(work);
+    ntt.inverse(work);
+    if (work != input) {
+        return std::numeric_limits<double>::infinity();
+    }
+
+    std::size_t log_n = 0;
+    while ((std::size_t(1) << log_n) < n) {
+        ++log_n;
+    }
+    const std::size_t iterations = std::max<std::size_t>(1, BATCH_WORK / (n * std::max<std::size_t>(1, log_n)));
+
+    double best = std::numeric_limits<double>::infinity();
+    for (int rep = 0; rep < repetitions_; ++rep) {
+        auto start = std::chrono::steady_clock::now();
+        for (std::size_t it = 0; it < iterations; ++it) {
+            ntt.forward(work);
+            ntt.inverse(work);
+        }
+        auto stop = std::chrono::steady_clock::now();
+        double ns = std::chrono::duration<double, std::nano>(stop - start).count();
+        best = std::min(best, ns / static_cast<double>(iterations));
+    }
+    return best;
+}
+
+NTTTuningResult NTTAutotuner::tune(std::size_t n, std::uint64_t q) {
+    if (const NTTTuningResult* cached = findResult(n, q)) {
+        NTT::setPreferredKernel(n, q, cached->kernel);
+        RLWE_LOG_INFO("NTT autotune: using cached kernel '" + std::string(NTT::kernelName(cached->kernel)) +
+                      "' for n=" + std::to_string(n) + ", q=" + std::to_string(q));
+        return *cached;
+    }
+
+    NTTTuningResult best{n, q, NTTKernel::Reference, std::numeric_limits<double>::infinity(), false};
+    bool found = false;
+
+    for (NTTKernel kernel : NTT::allKernels()) {
+        if (!NTT::isKernelSupported(kernel, n, q)) {
+            continue;
+        }
+        try {
+            NTT ntt(n, q, /*negacyclic=*/true, kernel);
+            double ns = benchmark(ntt);
+            RLWE_LOG_INFO("NTT autotune: n=" + std::to_string(n) + ", q=" + std::to_string(q) +
+                          ", kernel=" + NTT::kernelName(kernel) + ": " + std::to_string(ns) + " ns");
+            if (ns < best.nanoseconds) {
+                best.kernel = kernel;
+                best.nanoseconds = ns;
+                found = true;
+            }
+        } catch (const std::invalid_argument&) {
+            // Kernel cannot be built for this ring (e.g. missing tables).
+        }
+    }
+
+    if (!found) {
+        throw std::invalid_argument("NTTAutotuner: no usable NTT kernel for given (n, q)");
+    }
+
+    NTT::setPreferredKernel(n, q, best.kernel);
+    results_.push_back(best);
+    return best;
+}
+
+std::vector<NTTTuningResult> NTTAutotuner::tuneAll() {
+    std::vector<NTTTuningResult> out;
+    bool measured = false;
+
+    for (SecurityLevel level : registeredLevels()) {
+        RLWEParams params = KEM::getParameterSet(level);
+        bool seen = std::any_of(out.begin(), out.end(), [&](const NTTTuningResult& r) {
+            return r.n == params.n && r.q == params.q;
+        });
+        if (seen) {
+            continue;
+        }
+        NTTTuningResult r = tune(params.n, params.q);
+        measured = measured || !r.from_cache;
+        out.push_back(r);
+    }
+
+    if (measured && !cache_path_.empty()) {
+        saveCache();
+    }
+    return out;
+}
+
+void NTTAutotuner::loadCache() {
+    std::ifstream in(cache_path_);
+    if (!in) {
+        return;
+    }
+
+    std::string magic;
+    int version = 0;
+    std::string host_key;
+    std::string host;
+    if (!(in >> magic >> version >> host_key >> host) || magic != CACHE_MAGIC ||
+        version != CACHE_VERSION || host_key != "host" || host != hostSignature()) {
+        RLWE_LOG_WARN("NTT autotune: ignoring stale or foreign cache " + cache_path_);
+        return;
+    }
+
+    std::vector<NTTTuningResult> loaded;
+    std::string line;
+    std::getline(in, line);
+    while (std::getline(in, line)) {
+        std::istringstream ls(line);
+        NTTTuningResult r{0, 0, NTTKernel::Reference, 0.0, true};
+        std::string kernel_name;
+        if (!(ls >> r.n >> r.q >> kernel_name >> r.nanoseconds)) {
+            continue;
+        }
+        try {
+            r.kernel = NTT::kernelFromName(kernel_name);
+        } catch (const std::invalid_argument&) {
+            continue;  // Written by a build with different kernels.
+        }
+        if (NTT::isKernelSupported(r.kernel, r.n, r.q)) {
+            loaded.push_back(r);
+        }
+    }
+    results_ = std::move(loaded);
+}
+
+void NTTAutotuner::saveCache() const {
+    std::ofstream out(cache_path_, std::ios::trunc);
+    if (!out) {
+        RLWE_LOG_WARN("NTT autotune: cannot write cache " + cache_path_);
+        return;
+    }
+
+    out << CACHE_MAGIC << ' ' << CACHE_VERSION << '\n';
+    out << "host " << hostSignature() << '\n';
+    for (const NTTTuningResult& r : results_) {
+        out << r.n << ' ' << r.q << ' ' << NTT::kernelName(r.kernel) << ' ' << r.nanoseconds << '\n';
+    }
+}
@@ -0,0 +1,229 @@
+#include <poly_batch.h>
+
+#include <exception>
+#include <optional>
+#include <utility>
+
+#include <ntt.h>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+namespace poly_batch {
+
+namespace {
+
+// NTT of the batch's ring, resolved once on the calling thread; null if
+// the batch is empty or the ring has no tables. Items in another ring
+// fail their own ring check.
+const NTT* batchNTT(std::size_t count, std::size_t n, std::uint64_t q) {
+    return count > 0 && NTT::hasTables(n, q) ? &NTT::forRing(n, q) : nullptr;
+}
+
+template<typename Coeff>
+const NTT* batchNTT(const BasicPolynomial<Coeff>* polys, std::size_t count) {
+    return count > 0 ? batchNTT(count, polys[0].degree(), polys[0].getModulus()) : nullptr;
+}
+
+// Run fn(i) for every i < count. Each item runs with `ntt` bound
+// (NTT::RingScope), so its transforms skip forRing()'s lock. Exceptions
+// are caught inside the parallel region (they must not escape it) and the
+// first one is rethrown once every item has run.
+template<typename Fn>
+void parallelFor(std::size_t count, const Options& options, const NTT* ntt, const Fn& fn) {
+    std::exception_ptr error;
+    auto guarded = [&](std::size_t i) {
+        try {
+            std::optional<NTT::RingScope> bound;
+            if (ntt) {
+                bound.emplace(*ntt);
+            }
+            fn(i);
+        } catch (...) {
+#ifdef _OPENMP
+#pragma omp critical(poly_batch_error)
+#endif
+            if (!error) {
+                error = std::current_exception();
+            }
+        }
+    };
+
+    const std::size_t grain = options.grain > 0 ? options.grain : 1;
+#ifdef _OPENMP
+    const int threads = options.threads > 0 ? options.threads : defaultThreads();
+    if (threads > 1 && count > grain) {
+        const long long total = static_cast<long long>(count);
+        const int chunk = static_cast<int>(grain);
+#pragma omp parallel for schedule(dynamic, chunk) num_threads(threads)
+        for (long long i = 0; i < total; ++i) {
+            guarded(static_cast<std::size_t>(i));
+        }
+    } else {
+        for (std::size_t i = 0; i < count; ++i) {
+            guarded(i);
+        }
+    }
+#else
+    (void)grain;
+    for (std::size_t i = 0; i < count; ++i) {
+        guarded(i);
+    }
+#endif
+
+    if (error) {
+        std::rethrow_exception(error);
+    }
+}
+
+// Collect fn(i) for every i in order. Polynomials have no default state,
+// so each thread fills its own optional slot and the values are moved out
+// afterwards.
+template<typename T, typename Fn>
+std::vector<T> parallelMap(std::size_t count, const Options& options, const NTT* ntt, const Fn& fn) {
+    std::vector<std::optional<T>> slots(count);
+    parallelFor(count, options, ntt, [&](std::size_t i) { slots[i].emplace(fn(i)); });
+
+    std::vector<T> results;
+    results.reserve(count);
+    for (std::optional<T>& slot : slots) {
+        results.push_back(std::move(*slot));
+    }
+    return results;
+}
+
+} // namespace
+
+int defaultThreads() {
+#ifdef _OPENMP
+    return omp_get_max_threads();
+#else
+    return 1;
+#endif
+}
+
+template<typename Coeff>
+std::vector<BasicPolynomial<Coeff>> addMany(const BasicPolynomial<Coeff>* a,
+                                            const BasicPolynomial<Coeff>* b, std::size_t count,
+                                            const Options& options) {
+    const NTT* ntt = batchNTT(a, count);
+    return parallelMap<BasicPolynomial<Coeff>>(count, options, ntt, [&](std::size_t i) {
+        BasicPolynomial<Coeff> sum(a[i]);
+        sum += b[i].valuesView();
+        return sum;
+    });
+}
+
+template<typename Coeff>
+std::vector<BasicPolynomial<Coeff>> multiplyMany(const BasicPolynomial<Coeff>* a,
+                                                 const BasicPolynomial<Coeff>* b, std::size_t count,
+                                                 const Options& options) {
+    const NTT* ntt = batchNTT(a, count);
+    return parallelMap<BasicPolynomial<Coeff>>(count, options, ntt, [&](std::size_t i) {
+        BasicPolynomial<Coeff> product(a[i]);
+        product *= b[i].valuesView();
+        return product;
+    });
+}
+
+template<typename Coeff>
+std::vector<BasicPolynomial<Coeff>> multiplyMany(const BasicPolynomial<Coeff>* polys, std::size_t count,
+                                                 const PreparedPolynomial& fixed,
+                                                 const Options& options) {
+    const NTT* ntt = batchNTT(count, fixed.degree(), fixed.getModulus());
+    return parallelMap<BasicPolynomial<Coeff>>(count, options, ntt, [&](std::size_t i) {
+        return polys[i] * fixed;
+    });
+}
+
+template<typename Coeff>
+std::vector<BasicPolynomial<Coeff>> signalMany(const BasicPolynomial<Coeff>* polys, std::size_t count,
+                                               const Options& options) {
+    const NTT* ntt = batchNTT(polys, count);
+    return parallelMap<BasicPolynomial<Coeff>>(count, options, ntt, [&](std::size_t i) {
+        return BasicPolynomial<Coeff>::polySignal(polys[i].valuesView());
+    });
+}
+
+template<typename Coeff>
+std::vector<std::vector<std::uint8_t>> toBytesMany(const BasicPolynomial<Coeff>* polys, std::size_t count,
+                                                   const Options& options) {
+    const NTT* ntt = batchNTT(polys, count);
+    return parallelMap<std::vector<std::uint8_t>>(count, options, ntt, [&](std::size_t i) {
+        return BasicPolynomial<Coeff>::toBytes(polys[i].valuesView());
+    });
+}
+
+template<typename Coeff>
+std::vector<std::uint64_t> normInfMany(const BasicPolynomial<Coeff>* polys, std::size_t count,
+                                       const Options& options) {
+    std::vector<std::uint64_t> norms(count);
+    const NTT* ntt = batchNTT(polys, count);
+    parallelFor(count, options, ntt, [&](std::size_t i) {
+        norms[i] = BasicPolynomial<Coeff>::normInf(polys[i].valuesView());
+    });
+    return norms;
+}
+
+template<typename Coeff>
+std::vector<std::uint64_t> normL2SquaredMany(const BasicPolynomial<Coeff>* polys, std::size_t count,
+                                             const Options& options) {
+    std::vector<std::uint64_t> norms(count);
+    const NTT* ntt = batchNTT(polys, count);
+    parallelFor(count, options, ntt, [&](std::size_t i) {
+        norms[i] = BasicPolynomial<Coeff>::normL2Squared(polys[i].valuesView());
+    });
+    return norms;
+}
+
+template<typename Coeff>
+std::size_t firstOutOfBound(const BasicPolynomial<Coeff>* polys, std::size_t count, std::uint64_t bound,
+                            const Options& options) {
+    // One byte per item: std::vector<bool> packs bits, so threads writing
+    // neighbouring items would race.
+    std::vector<unsigned char> ok(count);
+    const NTT* ntt = batchNTT(polys, count);
+    parallelFor(count, options, ntt, [&](std::size_t i) {
+        ok[i] = BasicPolynomial<Coeff>::isBounded(polys[i].valuesView(), bound);
+    });
+    for (std::size_t i = 0; i < count; ++i) {
+        if (!ok[i]) {
+            return i;
+        }
+    }
+    return count;
+}
+
+template std::vector<BasicPolynomial<std::uint16_t>> addMany(const BasicPolynomial<std::uint16_t>*, const BasicPolynomial<std::uint16_t>*, std::size_t, const Options&);
+template std::vector<BasicPolynomial<std::uint32_t>> addMany(const BasicPolynomial<std::uint32_t>*, const BasicPolynomial<std::uint32_t>*, std::size_t, const Options&);
+template std::vector<BasicPolynomial<std::uint64_t>> addMany(const BasicPolynomial<std::uint64_t>*, const BasicPolynomial<std::uint64_t>*, std::size_t, const Options&);
+template std::vector<BasicPolynomial<std::uint16_t>> multiplyMany(const BasicPolynomial<std::uint16_t>*, const BasicPolynomial<std::uint16_t>*, std::size_t,
+                                                    const Options&);
+template std::vector<BasicPolynomial<std::uint32_t>> multiplyMany(const BasicPolynomial<std::uint32_t>*, const BasicPolynomial<std::uint32_t>*, std::size_t,
+                                                    const Options&);
+template std::vector<BasicPolynomial<std::uint64_t>> multiplyMany(const BasicPolynomial<std::uint64_t>*, const BasicPolynomial<std::uint64_t>*, std::size_t,
+                                                    const Options&);
+template std::vector<BasicPolynomial<std::uint16_t>> multiplyMany(const BasicPolynomial<std::uint16_t>*, std::size_t, const PreparedPolynomial&,
+                                                    const Options&);
+template std::vector<BasicPolynomial<std::uint32_t>> multiplyMany(const BasicPolynomial<std::uint32_t>*, std::size_t, const PreparedPolynomial&,
+                                                    const Options&);
+template std::vector<BasicPolynomial<std::uint64_t>> multiplyMany(const BasicPolynomial<std::uint64_t>*, std::size_t, const PreparedPolynomial&,
+                                                    const Options&);
+template std::vector<BasicPolynomial<std::uint16_t>> signalMany(const BasicPolynomial<std::uint16_t>*, std::size_t, const Options&);
+template std::vector<BasicPolynomial<std::uint32_t>> signalMany(const BasicPolynomial<std::uint32_t>*, std::size_t, const Options&);
+template std::vector<BasicPolynomial<std::uint64_t>> signalMany(const BasicPolynomial<std::uint64_t>*, std::size_t, const Options&);
+template std::vector<std::vector<std::uint8_t>> toBytesMany(const BasicPolynomial<std::uint16_t>*, std::size_t, const Options&);
+template std::vector<std::vector<std::uint8_t>> toBytesMany(const BasicPolynomial<std::uint32_t>*, std::size_t, const Options&);
+template std::vector<std::vector<std::uint8_t>> toBytesMany(const BasicPolynomial<std::uint64_t>*, std::size_t, const Options&);
+
+template std::vector<std::uint64_t> normInfMany(const BasicPolynomial<std::uint16_t>*, std::size_t, const Options&);
+template std::vector<std::uint64_t> normInfMany(const BasicPolynomial<std::uint32_t>*, std::size_t, const Options&);
+template std::vector<std::uint64_t> normInfMany(const BasicPolynomial<std::uint64_t>*, std::size_t, const Options&);
+template std::vector<std::uint64_t> normL2SquaredMany(const BasicPolynomial<std::uint16_t>*, std::size_t, const Options&);
+template std::vector<std::uint64_t> normL2SquaredMany(const BasicPolynomial<std::uint32_t>*, std::size_t, const Options&);
+template std::vector<std::uint64_t> normL2SquaredMany(const BasicPolynomial<std::uint64_t>*, std::size_t, const Options&);
+template std::size_t firstOutOfBound(const BasicPolynomial<std::uint16_t>*, std::size_t, std::uint64_t, const Options&);
+template std::size_t firstOutOfBound(const BasicPolynomial<std::uint32_t>*, std::size_t, std::uint64_t, const Options&);
+template std::size_t firstOutOfBound(const BasicPolynomial<std::uint64_t>*, std::size_t, std::uint64_t, const Options&);
+} // namespace poly_batch
@@ -0,0 +1,98 @@
+#include <poly_memory.h>
+
+#include <new>
+
+PolyPool::PolyPool(std::pmr::memory_resource* upstream) : upstream_(upstream), free_{} {}
+
+PolyPool::~PolyPool() {
+    release();
+}
+
+std::size_t PolyPool::sizeClass(std::size_t bytes) {
+    std::size_t cls = 0;
+    std::size_t block = min_block_bytes;
+    while (block < bytes) {
+        block <<= 1;
+        ++cls;
+    }
+    return cls;
+}
+
+void PolyPool::release() {
+    for (std::size_t cls = 0; cls < class_count; ++cls) {
+        const std::size_t block = min_block_bytes << cls;
+        while (free_[cls]) {
+            FreeBlock* head = free_[cls];
+            free_[cls] = head->next;
+            upstream_->deallocate(head, block, alignof(std::max_align_t));
+        }
+    }
+}
+
+std::size_t PolyPool::cachedBlocks() const {
+    std::size_t count = 0;
+    for (const FreeBlock* head : free_) {
+        for (; head; head = head->next) {
+            ++count;
+        }
+    }
+    return count;
+}
+
+PolyPool& PolyPool::threadLocal() {
+    thread_local PolyPool pool;
+    return pool;
+}
+
+void* PolyPool::do_allocate(std::size_t bytes, std::size_t alignment) {
+    if (bytes > max_block_bytes || alignment > alignof(std::max_align_t)) {
+        return upstream_->allocate(bytes, alignment);
+    }
+    const std::size_t cls = sizeClass(bytes);
+    if (FreeBlock* head = free_[cls]) {
+        free_[cls] = head->next;
+        return head;
+    }
+    return upstream_->allocate(min_block_bytes << cls, alignof(std::max_align_t));
+}
+
+void PolyPool::do_deallocate(void* p, std::size_t bytes, std::size_t alignment) {
+    if (bytes > max_block_bytes || alignment > alignof(std::max_align_t)) {
+        upstream_->deallocate(p, bytes, alignment);
+        return;
+    }
+    const std::size_t cls = sizeClass(bytes);
+    free_[cls] = ::new (p) FreeBlock{free_[cls]};
+}
+
+bool PolyPool::do_is_equal(const std::pmr::memory_resource& other) const noexcept {
+    return this == &other;
+}
+
+namespace poly_memory {
+
+namespace {
+
+thread_local std::pmr::memory_resource* current_scratch = nullptr;
+
+} // namespace
+
+std::pmr::memory_resource* scratch() {
+    return current_scratch ? current_scratch : &PolyPool::threadLocal();
+}
+
+std::pmr::memory_resource* setScratch(std::pmr::memory_resource* resource) {
+    std::pmr::memory_resource* previous = scratch();
+    current_scratch = resource;
+    return previous;
+}
+
+RequestScope::RequestScope(std::size_t initial_bytes)
+    : arena_(initial_bytes, &PolyPool::threadLocal()),
+      previous_(setScratch(&arena_)) {}
+
+RequestScope::~RequestScope() {
+    setScratch(previous_);
+}
+
+} // namespace poly_memory
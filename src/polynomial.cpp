@@ -1,197 +1,705 @@
 #include <polynomial.h>
+#include <algorithm>
+#include <cmath>
+#include <limits>
 #include <stdexcept>
+#include <elementwise.h>
+#include <fft.h>
 #include <ntt.h>
-
-Polynomial Polynomial::polySignal() const {
-    Polynomial result(ring_dim, modulus);
-    uint64_t half_mod = modulus / 2;
-    
-    for (size_t i = 0; i < ring_dim; i++) {
-        uint64_t coeff = coeffs[i];
-        uint64_t dist_to_zero = std::min(coeff, modulus - coeff);
-        uint64_t dist_to_half = std::min(
-            (coeff >= half_mod) ? coeff - half_mod : half_mod - coeff,
-            (coeff >= half_mod) ? modulus - coeff + half_mod : modulus - half_mod + coeff
-        );
-        
-        result[i] = (dist_to_zero <= dist_to_half) ? 0 : half_mod;
-    }
-    
-    Logger::log("Rounded polynomial coefficients to binary signal");
-    return result;
+#include <poly_memory.h>
+#include <polynomial_accumulator.h>
+#include <prepared_polynomial.h>
+
+namespace {
+
+// Word type used for NTT work vectors: narrow coefficients are transformed
+// in 32-bit words, halving the working set of the 64-bit path.
+template<typename Coeff>
+using NTTWord = std::conditional_t<(sizeof(Coeff) <= sizeof(uint32_t)), uint32_t, uint64_t>;
+
+// Transform n stored values in place; 16-bit storage goes through a 32-bit
+// scratch buffer since the NTT works on 32- and 64-bit words.
+template<typename Coeff>
+void transformValues(const NTT& ntt, Coeff* data, size_t n, bool inverse) {
+    if constexpr (std::is_same<NTTWord<Coeff>, Coeff>::value) {
+        inverse ? ntt.inverse(data, n) : ntt.forward(data, n);
+    } else {
+        std::pmr::vector<NTTWord<Coeff>> tmp(data, data + n, poly_memory::scratch());
+        inverse ? ntt.inverse(tmp.data(), n) : ntt.forward(tmp.data(), n);
+        std::copy(tmp.begin(), tmp.end(), data);
+    }
 }
 
-Polynomial Polynomial::operator+(const Polynomial& other) const {
-    if (ring_dim != other.ring_dim || modulus != other.modulus) {
-        throw std::invalid_argument("Polynomials must be in the same ring");
+// Coefficient-domain values of a view: its own storage, or an inverse
+// transform of NTT-domain values in `scratch`.
+template<typename Coeff>
+const Coeff* coefficientValues(const BasicPolynomialView<Coeff>& view, std::pmr::vector<Coeff>& scratch) {
+    if (view.domain() != PolyDomain::NTT) {
+        return view.data();
     }
+    scratch.assign(view.begin(), view.end());
+    transformValues(NTT::forRing(view.degree(), view.getModulus()), scratch.data(), view.degree(), true);
+    return scratch.data();
+}
 
-    Logger::log("Adding polynomials:\n  " + toString() + "\n  " + other.toString());
+// Packed encoding (see BasicPolynomial::toBytes): 4-byte dimension and
+// 8-byte modulus, both little-endian, then the coefficient bit stream.
+constexpr size_t kPackedHeaderBytes = 4 + 8;
 
-    Polynomial result(ring_dim, modulus);
-    for (size_t i = 0; i < ring_dim; i++) {
-        result[i] = (coeffs[i] + other.coeffs[i]) % modulus;
+void storeLE(uint8_t* out, uint64_t value, size_t count) {
+    for (size_t i = 0; i < count; ++i) {
+        out[i] = static_cast<uint8_t>(value >> (8 * i));
     }
+}
 
-    Logger::log("Addition result:\n  " + result.toString());
-    return result;
+uint64_t loadLE(const uint8_t* in, size_t count) {
+    uint64_t value = 0;
+    for (size_t i = 0; i < count; ++i) {
+        value |= static_cast<uint64_t>(in[i]) << (8 * i);
+    }
+    return value;
 }
 
-Polynomial Polynomial::operator-(const Polynomial& other) const {
-    if (ring_dim != other.ring_dim || modulus != other.modulus) {
-        throw std::invalid_argument("Polynomials must be in the same ring");
+// Pack n values of `bits` bits each into a little-endian bit stream. Bits
+// are gathered in a 64-bit accumulator and written a word at a time.
+template<typename Coeff>
+void packBits(const Coeff* values, size_t n, unsigned bits, uint8_t* out) {
+    uint64_t acc = 0;
+    unsigned filled = 0;
+    for (size_t i = 0; i < n; ++i) {
+        const uint64_t v = values[i];
+        acc |= v << filled;
+        filled += bits;
+        if (filled >= 64) {
+            storeLE(out, acc, 8);
+            out += 8;
+            filled -= 64;
+            // Carry the bits of v that did not fit.
+            acc = filled ? v >> (bits - filled) : 0;
+        }
     }
+    storeLE(out, acc, (filled + 7) / 8);
+}
+
+// Inverse of packBits. Returns false if a value is not below q or the
+// padding bits are not zero; `size` must already match n and bits.
+template<typename Coeff>
+bool unpackBits(const uint8_t* in, size_t size, size_t n, unsigned bits, uint64_t q, Coeff* out) {
+    const uint64_t mask = bits == 64 ? ~uint64_t(0) : (uint64_t(1) << bits) - 1;
+    uint64_t acc = 0;
+    unsigned avail = 0;
+    size_t pos = 0;
+    for (size_t i = 0; i < n; ++i) {
+        uint64_t v;
+        if (avail >= bits) {
+            v = acc & mask;
+            acc >>= bits;
+            avail -= bits;
+        } else {
+            const size_t take = std::min<size_t>(8, size - pos);
+            const uint64_t word = loadLE(in + pos, take);
+            pos += take;
+            const unsigned used = bits - avail;
+            v = (acc | (word << avail)) & mask;
+            acc = used == 64 ? 0 : word >> used;
+            avail = static_cast<unsigned>(8 * take) - used;
+        }
+        if (v >= q) {
+            return false;
+        }
+        out[i] = static_cast<Coeff>(v);
+    }
+    return acc == 0;
+}
+
+} // namespace
 
-    Logger::log("Subtracting polynomials:\n  " + toString() + "\n  " + other.toString());
+template<typename Coeff>
+template<typename Word, typename Alloc>
+void BasicPolynomial<Coeff>::assignReduced(const std::vector<Word, Alloc>& values) {
+    std::copy(values.begin(), values.end(), coeffs.begin());
+    value_domain = PolyDomain::Coefficient;
+}
 
-    Polynomial result(ring_dim, modulus);
-    for (size_t i = 0; i < ring_dim; i++) {
-        result[i] = mod(static_cast<int64_t>(coeffs[i]) - 
-                       static_cast<int64_t>(other.coeffs[i]), modulus);
+template<typename Coeff>
+BasicPolynomial<Coeff>& BasicPolynomial<Coeff>::toNTT() {
+    if (value_domain != PolyDomain::NTT) {
+        transformValues(NTT::forRing(ring_dim, modulus), coeffs.data(), ring_dim, false);
+        value_domain = PolyDomain::NTT;
     }
+    return *this;
+}
 
-    Logger::log("Subtraction result:\n  " + result.toString());
-    return result;
+template<typename Coeff>
+void BasicPolynomial<Coeff>::convertToCoefficients() const {
+    transformValues(NTT::forRing(ring_dim, modulus), coeffs.data(), ring_dim, true);
+    value_domain = PolyDomain::Coefficient;
 }
 
-Polynomial Polynomial::operator-() const {
-    Logger::log("Negating polynomial:\n  " + toString());
+template<typename Coeff>
+const Coeff* BasicPolynomial<Coeff>::alignDomain(const BasicPolynomialView<Coeff>& other,
+                                                 std::pmr::vector<Coeff>& scratch) {
+    if (value_domain == other.domain()) {
+        return other.data();
+    }
+    if (value_domain == PolyDomain::NTT) {
+        convertToCoefficients();
+        return other.data();
+    }
+    scratch.assign(other.begin(), other.end());
+    transformValues(NTT::forRing(ring_dim, modulus), scratch.data(), ring_dim, true);
+    return scratch.data();
+}
+
+template<typename Coeff>
+BasicPolynomial<Coeff> BasicPolynomial<Coeff>::polySignal() const {
+    return polySignal(view());
+}
 
-    Polynomial result(ring_dim, modulus);
-    for (size_t i = 0; i < ring_dim; i++) {
-        result[i] = (coeffs[i] == 0) ? 0 : modulus - coeffs[i];
+template<typename Coeff>
+BasicPolynomial<Coeff> BasicPolynomial<Coeff>::polySignal(const BasicPolynomialView<Coeff>& view) {
+    const size_t n = view.degree();
+    const uint64_t q = view.getModulus();
+    BasicPolynomial result(n, q);
+
+    // Each coefficient goes to whichever of 0 and q/2 is cyclically closer.
+    if (view.domain() == PolyDomain::NTT) {
+        std::copy(view.begin(), view.end(), result.coeffs.begin());
+        transformValues(NTT::forRing(n, q), result.coeffs.data(), n, true);
+        Elementwise::signal(result.coeffs.data(), result.coeffs.data(), n, q);
+    } else {
+        Elementwise::signal(view.data(), result.coeffs.data(), n, q);
     }
 
-    Logger::log("Negation result:\n  " + result.toString());
+    RLWE_LOG_DEBUG("Rounded polynomial coefficients to binary signal");
     return result;
 }
 
-Polynomial Polynomial::operator*(const Polynomial& other) const {
-    if (ring_dim != other.ring_dim || modulus != other.modulus) {
-        throw std::invalid_argument("Polynomials must be in the same ring");
-    }
+template<typename Coeff>
+uint64_t BasicPolynomial<Coeff>::normInf() const {
+    return normInf(view());
+}
 
-    Logger::log("Multiplying polynomials (NTT-accelerated where available):\n  " +
-                toString() + "\n  " + other.toString());
+template<typename Coeff>
+uint64_t BasicPolynomial<Coeff>::normInf(const BasicPolynomialView<Coeff>& view) {
+    std::pmr::vector<Coeff> scratch(poly_memory::scratch());
+    return Elementwise::normInf(coefficientValues(view, scratch), view.degree(), view.getModulus());
+}
 
-    // Try NTT-based multiplication first. If precomputed tables are not
-    // available for this (n, q) pair, fall back to a simple schoolbook
-    // multiplication in Z_q[x]/(x^n + 1).
-    try {
-        NTT ntt(ring_dim, modulus, /*negacyclic=*/true);
+template<typename Coeff>
+uint64_t BasicPolynomial<Coeff>::normL2Squared() const {
+    return normL2Squared(view());
+}
+
+template<typename Coeff>
+uint64_t BasicPolynomial<Coeff>::normL2Squared(const BasicPolynomialView<Coeff>& view) {
+    std::pmr::vector<Coeff> scratch(poly_memory::scratch());
+    return Elementwise::normL2Squared(coefficientValues(view, scratch), view.degree(), view.getModulus());
+}
+
+template<typename Coeff>
+double BasicPolynomial<Coeff>::normL2() const {
+    return std::sqrt(static_cast<double>(normL2Squared()));
+}
+
+template<typename Coeff>
+bool BasicPolynomial<Coeff>::isBounded(uint64_t bound) const {
+    return isBounded(view(), bound);
+}
+
+template<typename Coeff>
+bool BasicPolynomial<Coeff>::isBounded(const BasicPolynomialView<Coeff>& view, uint64_t bound) {
+    std::pmr::vector<Coeff> scratch(poly_memory::scratch());
+    return Elementwise::withinBound(coefficientValues(view, scratch), view.degree(), view.getModulus(), bound);
+}
 
-        std::vector<std::uint64_t> a_vec = coeffs;
-        std::vector<std::uint64_t> b_vec = other.coeffs;
+template<typename Coeff>
+BasicPolynomial<Coeff>& BasicPolynomial<Coeff>::operator+=(const BasicPolynomial& other) {
+    RLWE_LOG_TRACE("Adding polynomials:\n  " + toString() + "\n  " + other.toString());
+    return *this += other.valuesView();
+}
+
+template<typename Coeff>
+BasicPolynomial<Coeff>& BasicPolynomial<Coeff>::operator+=(const BasicPolynomialView<Coeff>& other) {
+    requireSameRing(other);
+
+    std::pmr::vector<Coeff> scratch(poly_memory::scratch());
+    const Coeff* rhs = alignDomain(other, scratch);
+    Elementwise::add(coeffs.data(), rhs, ring_dim, modulus);
+
+    RLWE_LOG_TRACE("Addition result:\n  " + toString());
+    return *this;
+}
+
+template<typename Coeff>
+BasicPolynomial<Coeff>& BasicPolynomial<Coeff>::operator-=(const BasicPolynomial& other) {
+    RLWE_LOG_TRACE("Subtracting polynomials:\n  " + toString() + "\n  " + other.toString());
+    return *this -= other.valuesView();
+}
+
+template<typename Coeff>
+BasicPolynomial<Coeff>& BasicPolynomial<Coeff>::operator-=(const BasicPolynomialView<Coeff>& other) {
+    requireSameRing(other);
+
+    std::pmr::vector<Coeff> scratch(poly_memory::scratch());
+    const Coeff* rhs = alignDomain(other, scratch);
+    Elementwise::sub(coeffs.data(), rhs, ring_dim, modulus);
+
+    RLWE_LOG_TRACE("Subtraction result:\n  " + toString());
+    return *this;
+}
+
+template<typename Coeff>
+void BasicPolynomial<Coeff>::subtractFrom(const BasicPolynomialView<Coeff>& lhs) {
+    requireSameRing(lhs);
+
+    RLWE_LOG_TRACE("Subtracting from viewed values:\n  " + toString());
+
+    std::pmr::vector<Coeff> scratch(poly_memory::scratch());
+    const Coeff* minuend = alignDomain(lhs, scratch);
+    Elementwise::subFrom(coeffs.data(), minuend, ring_dim, modulus);
+
+    RLWE_LOG_TRACE("Subtraction result:\n  " + toString());
+}
+
+template<typename Coeff>
+BasicPolynomial<Coeff>& BasicPolynomial<Coeff>::negate() {
+    RLWE_LOG_TRACE("Negating polynomial:\n  " + toString());
 
-        ntt.forward(a_vec);
-        ntt.forward(b_vec);
+    Elementwise::negate(coeffs.data(), ring_dim, modulus);
 
-        for (std::size_t i = 0; i < ring_dim; ++i) {
-            a_vec[i] = (a_vec[i] * b_vec[i]) % modulus;
+    RLWE_LOG_TRACE("Negation result:\n  " + toString());
+    return *this;
+}
+
+template<typename Coeff>
+BasicPolynomial<Coeff>& BasicPolynomial<Coeff>::operator*=(const BasicPolynomial& other) {
+    RLWE_LOG_TRACE("Multiplying polynomials (NTT-accelerated where available):\n  " +
+                   toString() + "\n  " + other.toString());
+    return *this *= other.valuesView();
+}
+
+template<typename Coeff>
+BasicPolynomial<Coeff>& BasicPolynomial<Coeff>::operator*=(const BasicPolynomialView<Coeff>& other) {
+    requireSameRing(other);
+
+    // Use the NTT when precomputed tables exist for this (n, q) pair.
+    // Otherwise fall back to a floating-point FFT and, if that cannot be
+    // exact, to schoolbook multiplication in Z_q[x]/(x^n + 1). Deciding
+    // up front keeps moduli that are not NTT-friendly (q != 1 mod 2n, such
+    // as 3329 for n = 256) away from the NTT constructor's checks.
+    if (NTT::hasTables(ring_dim, modulus)) {
+        const NTT& ntt = NTT::forRing(ring_dim, modulus);
+
+        // Evaluations of the other operand: its own storage if it is
+        // already in the NTT domain, otherwise a transformed copy (taken
+        // before *this is touched, so that p *= p works).
+        std::pmr::vector<Coeff> b_vec(poly_memory::scratch());
+        const Coeff* b = other.data();
+        if (other.domain() != PolyDomain::NTT) {
+            b_vec.assign(other.begin(), other.end());
+            transformValues(ntt, b_vec.data(), ring_dim, false);
+            b = b_vec.data();
         }
 
-        ntt.inverse(a_vec);
+        if (value_domain != PolyDomain::NTT) {
+            transformValues(ntt, coeffs.data(), ring_dim, false);
+            value_domain = PolyDomain::NTT;
+        }
+        Elementwise::mulPointwise(coeffs.data(), b, ring_dim, modulus);
 
-        Polynomial result(ring_dim, modulus);
-        result.setCoefficients(a_vec);
+        // The product stays in the NTT domain until it is observed.
+        RLWE_LOG_TRACE("NTT-based multiplication result:\n  " + toString());
+        return *this;
+    }
 
-        Logger::log("NTT-based multiplication result:\n  " + result.toString());
-        return result;
-    } catch (const std::invalid_argument& e) {
-        // Detect the specific case where NTT tables are missing and perform a
-        // straightforward schoolbook multiplication instead. We intentionally
-        // do not rethrow here so that small test rings (e.g., n=4, q=17)
-        // continue to work without dedicated NTT tables.
-        std::string msg = e.what();
-        if (msg != "NTT: no precomputed tables for given (n, q)") {
-            throw;  // Some other precondition failed; propagate the error.
+    if (other.domain() != PolyDomain::Coefficient) {
+        throw std::invalid_argument("NTT-domain operand in a ring without NTT tables");
+    }
+
+    // Without NTT tables, a double-precision FFT still gives an exact
+    // O(n log n) product as long as the coefficients fit the mantissa.
+    if (FFTMultiplier::isSupported(ring_dim, modulus)) {
+        std::vector<std::uint64_t> a_wide(coeffs.begin(), coeffs.end());
+        std::vector<std::uint64_t> b_wide(other.begin(), other.end());
+        std::vector<std::uint64_t> fft_prod;
+        if (FFTMultiplier::forRing(ring_dim, modulus).tryMultiply(a_wide, b_wide, fft_prod)) {
+            assignReduced(fft_prod);
+            RLWE_LOG_TRACE("FFT-based multiplication result:\n  " + toString());
+            return *this;
         }
+        RLWE_LOG_DEBUG("FFT rounding check failed; using exact schoolbook multiplication.");
+    }
 
-        Logger::log("NTT tables not available for this (n, q); falling back to "
-                    "schoolbook polynomial multiplication.");
+    RLWE_LOG_DEBUG("NTT tables not available for this (n, q); falling back to "
+                   "schoolbook polynomial multiplication.");
 
-        // Schoolbook convolution in Z_q[x]/(x^n + 1).
-        // We first compute the ordinary product c(x) = a(x) * b(x) of degree
-        // up to 2n-2, then reduce modulo x^n + 1 by folding the upper terms
-        // back with a sign flip: x^n == -1.
+    // Schoolbook convolution in Z_q[x]/(x^n + 1).
+    // We first compute the ordinary product c(x) = a(x) * b(x) of degree
+    // up to 2n-2, then reduce modulo x^n + 1 by folding the upper terms
+    // back with a sign flip: x^n == -1.
 
-        std::vector<std::uint64_t> prod(2 * ring_dim - 1, 0);
+    const Modulus mod = *modulus_info;
+    std::vector<std::uint64_t> prod(2 * ring_dim - 1, 0);
 
-        for (std::size_t i = 0; i < ring_dim; ++i) {
-            for (std::size_t j = 0; j < ring_dim; ++j) {
-                std::size_t k = i + j;
-                prod[k] = (prod[k] + (coeffs[i] * other.coeffs[j]) % modulus) % modulus;
-            }
+    for (std::size_t i = 0; i < ring_dim; ++i) {
+        for (std::size_t j = 0; j < ring_dim; ++j) {
+            std::size_t k = i + j;
+            prod[k] = mod.add(prod[k], mod.mul(coeffs[i], other[j]));
         }
+    }
 
-        std::vector<std::uint64_t> reduced(ring_dim, 0);
+    // Fold higher-degree terms using x^n == -1; lower terms (degree < n)
+    // are already reduced.
+    for (std::size_t k = ring_dim; k < prod.size(); ++k) {
+        std::size_t idx = k - ring_dim;
+        // prod[idx] -= prod[k] (mod q)
+        uint64_t val = prod[k];
+        prod[idx] = (prod[idx] >= val) ? prod[idx] - val
+                                       : prod[idx] + modulus - val;
+    }
+    prod.resize(ring_dim);
+    assignReduced(prod);
 
-        // Lower terms (degree < n) copy directly.
-        for (std::size_t k = 0; k < ring_dim; ++k) {
-            reduced[k] = prod[k] % modulus;
+    RLWE_LOG_TRACE("Schoolbook multiplication result:\n  " + toString());
+    return *this;
+}
+
+template<typename Coeff>
+BasicPolynomial<Coeff>& BasicPolynomial<Coeff>::operator*=(const PreparedPolynomial& other) {
+    if (ring_dim != other.degree() || modulus != other.getModulus()) {
+        throw std::invalid_argument("Polynomials must be in the same ring");
+    }
+
+    // Stored values narrowed to Coeff, for the paths that need a view.
+    auto narrowed = [&] {
+        return std::pmr::vector<Coeff>(other.values().begin(), other.values().end(),
+                                       poly_memory::scratch());
+    };
+
+    if (other.domain() != PolyDomain::NTT) {
+        const std::pmr::vector<Coeff> b = narrowed();
+        return *this *= BasicPolynomialView<Coeff>(b.data(), ring_dim, modulus);
+    }
+
+    if (value_domain != PolyDomain::NTT) {
+        transformValues(NTT::forRing(ring_dim, modulus), coeffs.data(), ring_dim, false);
+        value_domain = PolyDomain::NTT;
+    }
+    if (other.hasShoup()) {
+        Elementwise::mulPointwiseShoup(coeffs.data(), other.values().data(),
+                                       other.shoupCompanions().data(), ring_dim, modulus);
+    } else if constexpr (std::is_same<Coeff, uint64_t>::value) {
+        Elementwise::mulPointwise(coeffs.data(), other.values().data(), ring_dim, modulus);
+    } else {
+        const std::pmr::vector<Coeff> b = narrowed();
+        Elementwise::mulPointwise(coeffs.data(), b.data(), ring_dim, modulus);
+    }
+
+    RLWE_LOG_TRACE("Prepared-operand multiplication result:\n  " + toString());
+    return *this;
+}
+
+template<typename Coeff>
+BasicPolynomial<Coeff>& BasicPolynomial<Coeff>::operator*=(uint64_t scalar) {
+    RLWE_LOG_TRACE("Multiplying polynomial by scalar " + std::to_string(scalar) + ":\n  " + toString());
+
+    // K-RED with a pre-scaled scalar when q is special (see Elementwise::scale).
+    Elementwise::scale(coeffs.data(), ring_dim, scalar, modulus);
+
+    RLWE_LOG_TRACE("Scalar multiplication result:\n  " + toString());
+    return *this;
+}
+
+template<typename Coeff>
+BasicPolynomial<Coeff> BasicPolynomial<Coeff>::inverse() const {
+    return batchInverse({*this}).front();
+}
+
+template<typename Coeff>
+std::vector<BasicPolynomial<Coeff>> BasicPolynomial<Coeff>::batchInverse(
+    const std::vector<BasicPolynomial>& polys) {
+    if (polys.empty()) {
+        return {};
+    }
+
+    const size_t n = polys.front().ring_dim;
+    const uint64_t q = polys.front().modulus;
+    for (const BasicPolynomial& p : polys) {
+        if (p.ring_dim != n || p.modulus != q) {
+            throw std::invalid_argument("Polynomials must be in the same ring");
         }
+    }
+
+    RLWE_LOG_DEBUG("Batch-inverting " + std::to_string(polys.size()) +
+                   " polynomials in the NTT domain");
 
-        // Fold higher-degree terms using x^n == -1.
-        for (std::size_t k = ring_dim; k < prod.size(); ++k) {
-            std::size_t idx = k - ring_dim;
-            // reduced[idx] -= prod[k] (mod q)
-            uint64_t val = prod[k] % modulus;
-            int64_t tmp = static_cast<int64_t>(reduced[idx]) - static_cast<int64_t>(val);
-            reduced[idx] = mod(tmp, modulus);
+    const NTT& ntt = NTT::forRing(n, q);
+
+    // Lay all evaluations out back to back so a single batch inversion
+    // covers every coefficient of every polynomial. Inputs already in the
+    // NTT domain are copied as they are.
+    std::vector<std::uint64_t> evals(polys.size() * n);
+    std::pmr::vector<NTTWord<Coeff>> tmp(n, poly_memory::scratch());
+    for (size_t k = 0; k < polys.size(); ++k) {
+        tmp.assign(polys[k].coeffs.begin(), polys[k].coeffs.end());
+        if (polys[k].value_domain != PolyDomain::NTT) {
+            ntt.forward(tmp.data(), n);
         }
+        std::copy(tmp.begin(), tmp.end(), evals.begin() + k * n);
+    }
 
-        Polynomial result(ring_dim, modulus);
-        result.setCoefficients(reduced);
+    try {
+        ntt.batchInvert(evals);
+    } catch (const std::invalid_argument&) {
+        throw std::invalid_argument("Polynomial is not invertible in Z_q[x]/(x^n + 1)");
+    }
 
-        Logger::log("Schoolbook multiplication result:\n  " + result.toString());
-        return result;
+    // The inverses are left in the NTT domain; they are converted only if
+    // their coefficients are observed.
+    std::vector<BasicPolynomial> result;
+    result.reserve(polys.size());
+    for (size_t k = 0; k < polys.size(); ++k) {
+        result.emplace_back(n, q);
+        BasicPolynomial& inv = result.back();
+        std::copy(evals.begin() + k * n, evals.begin() + (k + 1) * n, inv.coeffs.begin());
+        inv.value_domain = PolyDomain::NTT;
     }
+    return result;
 }
 
-Polynomial Polynomial::operator*(uint64_t scalar) const {
-    Logger::log("Multiplying polynomial by scalar " + std::to_string(scalar) + ":\n  " + toString());
+template<typename Coeff>
+BasicPolynomial<Coeff> BasicPolynomial<Coeff>::sum(const BasicPolynomial* polys, size_t count) {
+    if (count == 0) {
+        throw std::invalid_argument("Cannot sum an empty set of polynomials");
+    }
 
-    Polynomial result(ring_dim, modulus);
-    for (size_t i = 0; i < ring_dim; i++) {
-        result[i] = (coeffs[i] * scalar) % modulus;
+    const BasicPolynomial& first = polys[0];
+    RLWE_LOG_DEBUG("Summing " + std::to_string(count) + " polynomials with deferred reduction");
+
+    if (!PolynomialAccumulator::supportsModulus(first.modulus)) {
+        BasicPolynomial result(first);
+        for (size_t k = 1; k < count; ++k) {
+            result += polys[k];
+        }
+        return result;
     }
 
-    Logger::log("Scalar multiplication result:\n  " + result.toString());
-    return result;
+    PolynomialAccumulator acc(first.ring_dim, first.modulus);
+    for (size_t k = 0; k < count; ++k) {
+        acc.add(polys[k].valuesView());
+    }
+    return acc.result<Coeff>();
 }
 
-void Polynomial::setCoefficients(const std::vector<uint64_t>& new_coeffs) {
+template<typename Coeff>
+void BasicPolynomial<Coeff>::setCoefficients(const std::vector<uint64_t>& new_coeffs) {
     if (new_coeffs.size() != ring_dim) {
         throw std::invalid_argument("New coefficient vector size must match polynomial ring dimension");
     }
-    coeffs = new_coeffs;
-    for (auto& c : coeffs) {
-        c = mod(c, modulus);
+    for (size_t i = 0; i < ring_dim; ++i) {
+        coeffs[i] = static_cast<Coeff>(modulus_info->reduce(new_coeffs[i]));
+    }
+    value_domain = PolyDomain::Coefficient;
+    RLWE_LOG_TRACE("Updated polynomial coefficients to: " + Logger::vectorToString(coeffs));
+}
+
+template<typename Coeff>
+void BasicPolynomial<Coeff>::setCoefficients(std::vector<uint64_t>&& new_coeffs) {
+    if (new_coeffs.size() != ring_dim) {
+        throw std::invalid_argument("New coefficient vector size must match polynomial ring dimension");
     }
-    Logger::log("Updated polynomial coefficients to: " + Logger::vectorToString(coeffs));
+    takeCoefficients(std::move(new_coeffs));
+    RLWE_LOG_TRACE("Updated polynomial coefficients to: " + Logger::vectorToString(coeffs));
 }
 
-std::string Polynomial::toString() const {
+template<typename Coeff>
+void BasicPolynomial<Coeff>::takeCoefficients(std::vector<uint64_t>&& values) {
+    const Modulus& mod = *modulus_info;
+    for (auto& c : values) {
+        c = mod.reduce(c);
+    }
+    if constexpr (std::is_same<Coeff, uint64_t>::value) {
+        coeffs = std::move(values);
+    } else {
+        coeffs.assign(values.begin(), values.end());
+    }
+    value_domain = PolyDomain::Coefficient;
+}
+
+template<typename Coeff>
+std::string BasicPolynomial<Coeff>::toString() const {
     std::stringstream ss;
-    ss << "Polynomial(dim=" << ring_dim << ", q=" << modulus << "): ";
+    ss << "Polynomial(dim=" << ring_dim << ", q=" << modulus
+       << (value_domain == PolyDomain::NTT ? ", NTT" : "") << "): ";
     ss << Logger::vectorToString(coeffs);
     return ss.str();
 }
 
-std::vector<uint8_t> Polynomial::toBytes() const {
-    std::vector<uint8_t> bytes;
-    bytes.reserve(sizeof(size_t) + sizeof(uint64_t) + coeffs.size() * sizeof(uint64_t));
+template<typename Coeff>
+unsigned BasicPolynomial<Coeff>::coefficientBits(uint64_t q) {
+    unsigned bits = 1;
+    while (bits < 64 && ((q - 1) >> bits) != 0) {
+        ++bits;
+    }
+    return bits;
+}
 
-    const uint8_t* dim_bytes = reinterpret_cast<const uint8_t*>(&ring_dim);
-    bytes.insert(bytes.end(), dim_bytes, dim_bytes + sizeof(size_t));
+template<typename Coeff>
+size_t BasicPolynomial<Coeff>::packedSize(size_t n, uint64_t q) {
+    return kPackedHeaderBytes + (n * coefficientBits(q) + 7) / 8;
+}
 
-    const uint8_t* mod_bytes = reinterpret_cast<const uint8_t*>(&modulus);
-    bytes.insert(bytes.end(), mod_bytes, mod_bytes + sizeof(uint64_t));
+template<typename Coeff>
+std::vector<uint8_t> BasicPolynomial<Coeff>::toBytes() const {
+    return toBytes(view());
+}
 
-    for (const uint64_t& coeff : coeffs) {
-        const uint8_t* coeff_bytes = reinterpret_cast<const uint8_t*>(&coeff);
-        bytes.insert(bytes.end(), coeff_bytes, coeff_bytes + sizeof(uint64_t));
+template<typename Coeff>
+std::vector<uint8_t> BasicPolynomial<Coeff>::toBytes(const BasicPolynomialView<Coeff>& view) {
+    const size_t n = view.degree();
+    const uint64_t q = view.getModulus();
+    if (n > std::numeric_limits<uint32_t>::max()) {
+        throw std::invalid_argument("Ring dimension too large to serialize");
     }
 
+    std::pmr::vector<Coeff> scratch(poly_memory::scratch());
+    const Coeff* values = coefficientValues(view, scratch);
+
+    std::vector<uint8_t> bytes(packedSize(n, q));
+    storeLE(bytes.data(), n, 4);
+    storeLE(bytes.data() + 4, q, 8);
+    packBits(values, n, coefficientBits(q), bytes.data() + kPackedHeaderBytes);
     return bytes;
 }
+
+template<typename Coeff>
+void BasicPolynomial<Coeff>::writeBytes(const BasicPolynomialView<Coeff>& view, const ByteSink& sink) {
+    const size_t n = view.degree();
+    const uint64_t q = view.getModulus();
+    if (n > std::numeric_limits<uint32_t>::max()) {
+        throw std::invalid_argument("Ring dimension too large to serialize");
+    }
+
+    std::pmr::vector<Coeff> scratch(poly_memory::scratch());
+    const Coeff* values = coefficientValues(view, scratch);
+
+    uint8_t header[kPackedHeaderBytes];
+    storeLE(header, n, 4);
+    storeLE(header + 4, q, 8);
+    sink(header, kPackedHeaderBytes);
+
+    // Every 8 coefficients pack into exactly `bits` bytes, so chunks of a
+    // multiple of 8 end on a byte boundary and concatenate to the same
+    // stream as packing all n at once.
+    constexpr size_t kChunkCoeffs = 512;
+    uint8_t chunk[kChunkCoeffs / 8 * 64];
+    const unsigned bits = coefficientBits(q);
+    for (size_t start = 0; start < n; start += kChunkCoeffs) {
+        const size_t count = std::min(kChunkCoeffs, n - start);
+        packBits(values + start, count, bits, chunk);
+        sink(chunk, (count * bits + 7) / 8);
+    }
+}
+
+template<typename Coeff>
+BasicPolynomial<Coeff> BasicPolynomial<Coeff>::fromBytes(const uint8_t* data, size_t size) {
+    if (size < kPackedHeaderBytes) {
+        throw std::invalid_argument("Encoded polynomial is too short");
+    }
+    const size_t n = static_cast<size_t>(loadLE(data, 4));
+    const uint64_t q = loadLE(data + 4, 8);
+    if (n == 0 || q == 0 || size != packedSize(n, q)) {
+        throw std::invalid_argument("Encoded polynomial has an invalid header or size");
+    }
+
+    BasicPolynomial result(n, q);
+    if (!unpackBits(data + kPackedHeaderBytes, size - kPackedHeaderBytes, n,
+                    coefficientBits(q), q, result.coeffs.data())) {
+        throw std::invalid_argument("Encoded polynomial is not canonical");
+    }
+    return result;
+}
+
+template<typename Coeff>
+bool BasicPolynomial<Coeff>::supportsCompression(uint64_t q, unsigned d) {
+    const unsigned bits = coefficientBits(q);
+    return d >= 1 && d < bits && bits + 2 * d <= 62;
+}
+
+template<typename Coeff>
+BasicPolynomial<Coeff>& BasicPolynomial<Coeff>::compress(unsigned d) {
+    if (!supportsCompression(modulus, d)) {
+        throw std::invalid_argument("Unsupported compression width for this modulus");
+    }
+    ensureCoefficients();
+    Elementwise::compress(coeffs.data(), ring_dim, d, modulus);
+    return *this;
+}
+
+template<typename Coeff>
+BasicPolynomial<Coeff>& BasicPolynomial<Coeff>::decompress(unsigned d) {
+    if (!supportsCompression(modulus, d)) {
+        throw std::invalid_argument("Unsupported compression width for this modulus");
+    }
+    ensureCoefficients();
+    const uint64_t bound = uint64_t(1) << d;
+    if (std::any_of(coeffs.begin(), coeffs.end(), [bound](Coeff c) { return c >= bound; })) {
+        throw std::invalid_argument("Compressed coefficient out of range");
+    }
+    Elementwise::decompress(coeffs.data(), ring_dim, d, modulus);
+    return *this;
+}
+
+template<typename Coeff>
+size_t BasicPolynomial<Coeff>::compressedSize(size_t n, unsigned d) {
+    return kPackedHeaderBytes + 1 + (n * d + 7) / 8;
+}
+
+template<typename Coeff>
+std::vector<uint8_t> BasicPolynomial<Coeff>::toCompressedBytes(unsigned d) const {
+    if (!supportsCompression(modulus, d)) {
+        throw std::invalid_argument("Unsupported compression width for this modulus");
+    }
+    if (ring_dim > std::numeric_limits<uint32_t>::max()) {
+        throw std::invalid_argument("Ring dimension too large to serialize");
+    }
+    ensureCoefficients();
+
+    std::pmr::vector<Coeff> scratch(coeffs.begin(), coeffs.end(), poly_memory::scratch());
+    Elementwise::compress(scratch.data(), ring_dim, d, modulus);
+
+    std::vector<uint8_t> bytes(compressedSize(ring_dim, d));
+    storeLE(bytes.data(), ring_dim, 4);
+    storeLE(bytes.data() + 4, modulus, 8);
+    bytes[kPackedHeaderBytes] = static_cast<uint8_t>(d);
+    packBits(scratch.data(), ring_dim, d, bytes.data() + kPackedHeaderBytes + 1);
+    return bytes;
+}
+
+template<typename Coeff>
+BasicPolynomial<Coeff> BasicPolynomial<Coeff>::fromCompressedBytes(const uint8_t* data, size_t size) {
+    if (size < kPackedHeaderBytes + 1) {
+        throw std::invalid_argument("Encoded polynomial is too short");
+    }
+    const size_t n = static_cast<size_t>(loadLE(data, 4));
+    const uint64_t q = loadLE(data + 4, 8);
+    const unsigned d = data[kPackedHeaderBytes];
+    if (n == 0 || q == 0 || !supportsCompression(q, d) || size != compressedSize(n, d)) {
+        throw std::invalid_argument("Encoded polynomial has an invalid header or size");
+    }
+
+    BasicPolynomial result(n, q);
+    // Every d-bit value is a valid Compress_d output, so only the padding
+    // can be non-canonical.
+    if (!unpackBits(data + kPackedHeaderBytes + 1, size - kPackedHeaderBytes - 1, n, d,
+                    uint64_t(1) << d, result.coeffs.data())) {
+        throw std::invalid_argument("Encoded polynomial is not canonical");
+    }
+    Elementwise::decompress(result.coeffs.data(), n, d, q);
+    return result;
+}
+
+template class BasicPolynomial<uint16_t>;
+template class BasicPolynomial<uint32_t>;
+template class BasicPolynomial<uint64_t>;
@@ -0,0 +1,91 @@
+#include <polynomial_accumulator.h>
+
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+
+#include <elementwise.h>
+#include <ntt.h>
+#include <poly_memory.h>
+
+PolynomialAccumulator::PolynomialAccumulator(std::size_t n, std::uint64_t q)
+    : ring_dim(n), modulus(q), sums(n, 0) {
+    if (!supportsModulus(q)) {
+        throw std::invalid_argument("Accumulator modulus must lie in [1, 2^63]");
+    }
+}
+
+template<typename Coeff>
+const Coeff* PolynomialAccumulator::prepare(const BasicPolynomialView<Coeff>& term,
+                                            std::uint64_t headroom,
+                                            std::pmr::vector<Coeff>& scratch) {
+    if (term.degree() != ring_dim || term.getModulus() != modulus) {
+        throw std::invalid_argument("Polynomials must be in the same ring");
+    }
+    if (term_count == 0) {
+        value_domain = term.domain();
+    }
+
+    const Coeff* values = term.data();
+    if (term.domain() != value_domain) {
+        scratch.resize(ring_dim);
+        const NTT& ntt = NTT::forRing(ring_dim, modulus);
+        if (value_domain == PolyDomain::NTT) {
+            ntt.forward(term, scratch.data());
+        } else {
+            ntt.inverse(term, scratch.data());
+        }
+        values = scratch.data();
+    }
+
+    // Fold only when the next term could wrap a word; afterwards every
+    // entry is below q, and q - 1 + headroom <= 2^64 - 1 by supportsModulus().
+    if (bound > std::numeric_limits<std::uint64_t>::max() - headroom) {
+        Elementwise::reduceWide(sums.data(), sums.data(), ring_dim, modulus);
+        bound = modulus - 1;
+    }
+    bound += headroom;
+    ++term_count;
+    return values;
+}
+
+template<typename Coeff>
+PolynomialAccumulator& PolynomialAccumulator::add(const BasicPolynomialView<Coeff>& term) {
+    std::pmr::vector<Coeff> scratch(poly_memory::scratch());
+    const Coeff* values = prepare(term, modulus - 1, scratch);
+    Elementwise::accumulate(sums.data(), values, ring_dim);
+    return *this;
+}
+
+template<typename Coeff>
+PolynomialAccumulator& PolynomialAccumulator::subtract(const BasicPolynomialView<Coeff>& term) {
+    std::pmr::vector<Coeff> scratch(poly_memory::scratch());
+    const Coeff* values = prepare(term, modulus, scratch);
+    Elementwise::accumulateNegated(sums.data(), values, ring_dim, modulus);
+    return *this;
+}
+
+template<typename Coeff>
+BasicPolynomial<Coeff> PolynomialAccumulator::result() const {
+    BasicPolynomial<Coeff> reduced(ring_dim, modulus);
+    Elementwise::reduceWide(sums.data(), reduced.coeffs.data(), ring_dim, modulus);
+    reduced.value_domain = value_domain;
+    return reduced;
+}
+
+void PolynomialAccumulator::reset() {
+    std::fill(sums.begin(), sums.end(), 0);
+    bound = 0;
+    term_count = 0;
+    value_domain = PolyDomain::Coefficient;
+}
+
+template PolynomialAccumulator& PolynomialAccumulator::add(const BasicPolynomialView<std::uint16_t>&);
+template PolynomialAccumulator& PolynomialAccumulator::add(const BasicPolynomialView<std::uint32_t>&);
+template PolynomialAccumulator& PolynomialAccumulator::add(const BasicPolynomialView<std::uint64_t>&);
+template PolynomialAccumulator& PolynomialAccumulator::subtract(const BasicPolynomialView<std::uint16_t>&);
+template PolynomialAccumulator& PolynomialAccumulator::subtract(const BasicPolynomialView<std::uint32_t>&);
+template PolynomialAccumulator& PolynomialAccumulator::subtract(const BasicPolynomialView<std::uint64_t>&);
+template BasicPolynomial<std::uint16_t> PolynomialAccumulator::result() const;
+template BasicPolynomial<std::uint32_t> PolynomialAccumulator::result() const;
+template BasicPolynomial<std::uint64_t> PolynomialAccumulator::result() const;
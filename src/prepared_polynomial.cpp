@@ -0,0 +1,28 @@
+#include <prepared_polynomial.h>
+
+#include <ntt.h>
+
+template<typename Coeff>
+PreparedPolynomial::PreparedPolynomial(const BasicPolynomial<Coeff>& poly, bool with_shoup)
+    : ring_dim(poly.degree()),
+      modulus(poly.getModulus()),
+      value_domain(NTT::hasTables(ring_dim, modulus) ? PolyDomain::NTT : PolyDomain::Coefficient),
+      evals(poly.values().begin(), poly.values().end()) {
+    // A polynomial can only be in the NTT domain if the ring has tables,
+    // so a mismatch always means a forward transform.
+    if (poly.domain() != value_domain) {
+        NTT::forRing(ring_dim, modulus).forward(evals.data(), ring_dim);
+    }
+
+    if (with_shoup && value_domain == PolyDomain::NTT && modulus <= (std::uint64_t(1) << 32)) {
+        const Modulus& mod = poly.getModulusInfo();
+        companions.resize(ring_dim);
+        for (std::size_t i = 0; i < ring_dim; ++i) {
+            companions[i] = mod.shoup(evals[i]);
+        }
+    }
+}
+
+template PreparedPolynomial::PreparedPolynomial(const BasicPolynomial<std::uint16_t>&, bool);
+template PreparedPolynomial::PreparedPolynomial(const BasicPolynomial<std::uint32_t>&, bool);
+template PreparedPolynomial::PreparedPolynomial(const BasicPolynomial<std::uint64_t>&, bool);
@@ -5,10 +5,7 @@
 #include <openssl/sha.h>
 #include <stdexcept>
 
-std::vector<uint8_t> SHA256::hash(const std::vector<uint8_t>& data) {
-    std::unique_ptr<EVP_MD_CTX, decltype(&EVP_MD_CTX_free)> 
-        mdctx(EVP_MD_CTX_new(), EVP_MD_CTX_free);
-    
+SHA256::Context::Context() : mdctx(EVP_MD_CTX_new(), EVP_MD_CTX_free) {
     if (!mdctx) {
         throw std::runtime_error("Failed to create message digest context");
     }
@@ -16,11 +13,15 @@ std::vector<uint8_t> SHA256::hash(const std::vector<uint8_t>& data) {
     if (EVP_DigestInit_ex(mdctx.get(), EVP_sha256(), nullptr) != 1) {
         throw std::runtime_error("Failed to initialize digest");
     }
-    
-    if (EVP_DigestUpdate(mdctx.get(), data.data(), data.size()) != 1) {
+}
+
+void SHA256::Context::update(const uint8_t* data, size_t size) {
+    if (EVP_DigestUpdate(mdctx.get(), data, size) != 1) {
         throw std::runtime_error("Failed to update digest");
     }
-    
+}
+
+std::vector<uint8_t> SHA256::Context::finish() {
     unsigned char digest[EVP_MAX_MD_SIZE];
     unsigned int digest_len = 0;
     
@@ -31,12 +32,20 @@ std::vector<uint8_t> SHA256::hash(const std::vector<uint8_t>& data) {
     return digestToVector(digest);
 }
 
+std::vector<uint8_t> SHA256::hash(const std::vector<uint8_t>& data) {
+    Context context;
+    context.update(data.data(), data.size());
+    return context.finish();
+}
+
 std::vector<uint8_t> SHA256::hash(const std::string& data) {
-    return hash(std::vector<uint8_t>(data.begin(), data.end()));
+    Context context;
+    context.update(reinterpret_cast<const uint8_t*>(data.data()), data.size());
+    return context.finish();
 }
 
 std::vector<uint8_t> SHA256::polyToHash(const Polynomial& poly) {
-    return hash(poly.toBytes());
+    return polyToHash(poly.valuesView());
 }
 
 std::vector<uint8_t> SHA256::digestToVector(const unsigned char* digest) {
@@ -0,0 +1,178 @@
+#include <small_polynomial.h>
+
+#include <memory_resource>
+#include <stdexcept>
+#include <string>
+
+#include <ntt.h>
+#include <poly_memory.h>
+
+namespace {
+
+unsigned log2Floor(std::size_t n) {
+    unsigned bits = 0;
+    for (; n > 1; n >>= 1) {
+        ++bits;
+    }
+    return bits;
+}
+
+} // namespace
+
+template<typename SmallInt>
+BasicSmallPolynomial<SmallInt>::BasicSmallPolynomial(std::size_t n, std::uint64_t q)
+    : ring_dim(n), modulus(q), modulus_info(&Modulus::forValue(q)), coeffs(n, 0) {}
+
+template<typename SmallInt>
+BasicSmallPolynomial<SmallInt>::BasicSmallPolynomial(const std::vector<std::int64_t>& values,
+                                                     std::uint64_t q)
+    : BasicSmallPolynomial(values.size(), q) {
+    for (std::size_t i = 0; i < ring_dim; ++i) {
+        requireFits(values[i]);
+        coeffs[i] = static_cast<SmallInt>(values[i]);
+    }
+}
+
+template<typename SmallInt>
+template<typename Coeff>
+BasicSmallPolynomial<SmallInt> BasicSmallPolynomial<SmallInt>::fromPolynomial(
+    const BasicPolynomial<Coeff>& poly) {
+    const std::uint64_t q = poly.getModulus();
+    BasicSmallPolynomial result(poly.degree(), q);
+    const std::vector<Coeff>& c = poly.getCoeffs();
+    for (std::size_t i = 0; i < result.ring_dim; ++i) {
+        const std::uint64_t x = c[i];
+        const std::int64_t centered =
+            x > q / 2 ? -static_cast<std::int64_t>(q - x) : static_cast<std::int64_t>(x);
+        result.requireFits(centered);
+        result.coeffs[i] = static_cast<SmallInt>(centered);
+    }
+    return result;
+}
+
+template<typename SmallInt>
+void BasicSmallPolynomial<SmallInt>::requireFits(std::int64_t value) const {
+    if (!fits(value, modulus)) {
+        throw std::invalid_argument("Coefficient " + std::to_string(value) +
+                                    " does not fit the small polynomial type");
+    }
+}
+
+template<typename SmallInt>
+void BasicSmallPolynomial<SmallInt>::set(std::size_t idx, std::int64_t value) {
+    requireFits(value);
+    coeffs[idx] = static_cast<SmallInt>(value);
+}
+
+template<typename SmallInt>
+std::size_t BasicSmallPolynomial<SmallInt>::weight() const {
+    std::size_t count = 0;
+    for (SmallInt c : coeffs) {
+        count += c != 0;
+    }
+    return count;
+}
+
+template<typename SmallInt>
+std::uint64_t BasicSmallPolynomial<SmallInt>::absoluteSum() const {
+    std::uint64_t sum = 0;
+    for (SmallInt c : coeffs) {
+        sum += static_cast<std::uint64_t>(c < 0 ? -static_cast<std::int64_t>(c) : c);
+    }
+    return sum;
+}
+
+template<typename SmallInt>
+template<typename Coeff>
+void BasicSmallPolynomial<SmallInt>::addTo(BasicPolynomial<Coeff>& target) const {
+    if (target.degree() != ring_dim || target.getModulus() != modulus) {
+        throw std::invalid_argument("Polynomials must be in the same ring");
+    }
+    std::pmr::vector<Coeff> lifted(ring_dim, poly_memory::scratch());
+    for (std::size_t i = 0; i < ring_dim; ++i) {
+        const std::int64_t c = coeffs[i];
+        lifted[i] = static_cast<Coeff>(static_cast<std::uint64_t>(c) + (c < 0 ? modulus : 0));
+    }
+    target += BasicPolynomialView<Coeff>(lifted.data(), ring_dim, modulus);
+}
+
+template<typename SmallInt>
+template<typename Coeff>
+BasicPolynomial<Coeff> BasicSmallPolynomial<SmallInt>::toPolynomial() const {
+    BasicPolynomial<Coeff> result(ring_dim, modulus);
+    addTo(result);
+    return result;
+}
+
+template<typename SmallInt>
+bool BasicSmallPolynomial<SmallInt>::usesDirectProduct() const {
+    // Every unreduced sum is bounded by absoluteSum() * (q - 1).
+    const std::uint64_t limit = static_cast<std::uint64_t>(std::numeric_limits<std::int64_t>::max());
+    const std::uint64_t magnitude = absoluteSum();
+    if (magnitude != 0 && modulus - 1 > limit / magnitude) {
+        return false;
+    }
+    return !NTT::hasTables(ring_dim, modulus) || weight() <= 2 * log2Floor(ring_dim);
+}
+
+template<typename SmallInt>
+template<typename Coeff>
+BasicPolynomial<Coeff> BasicSmallPolynomial<SmallInt>::multiply(const BasicPolynomial<Coeff>& large) const {
+    if (large.degree() != ring_dim || large.getModulus() != modulus) {
+        throw std::invalid_argument("Polynomials must be in the same ring");
+    }
+    if (!usesDirectProduct()) {
+        return toPolynomial<Coeff>() * large;
+    }
+
+    // x^j * b wraps negacyclically: the first n - j terms shift up by j,
+    // the last j come back at the bottom with their sign flipped.
+    const Coeff* b = large.getCoeffs().data();
+    std::pmr::vector<std::int64_t> acc(ring_dim, 0, poly_memory::scratch());
+    for (std::size_t j = 0; j < ring_dim; ++j) {
+        const std::int64_t s = coeffs[j];
+        if (s == 0) {
+            continue;
+        }
+        const std::size_t split = ring_dim - j;
+        for (std::size_t i = 0; i < split; ++i) {
+            acc[i + j] += s * static_cast<std::int64_t>(b[i]);
+        }
+        for (std::size_t i = split; i < ring_dim; ++i) {
+            acc[i - split] -= s * static_cast<std::int64_t>(b[i]);
+        }
+    }
+
+    std::vector<std::uint64_t> reduced(ring_dim);
+    for (std::size_t k = 0; k < ring_dim; ++k) {
+        reduced[k] = modulus_info->reduceSigned(acc[k]);
+    }
+    return BasicPolynomial<Coeff>(std::move(reduced), modulus);
+}
+
+template class BasicSmallPolynomial<std::int8_t>;
+template class BasicSmallPolynomial<std::int16_t>;
+template BasicSmallPolynomial<std::int8_t> BasicSmallPolynomial<std::int8_t>::fromPolynomial(const BasicPolynomial<std::uint16_t>&);
+template void BasicSmallPolynomial<std::int8_t>::addTo(BasicPolynomial<std::uint16_t>&) const;
+template BasicPolynomial<std::uint16_t> BasicSmallPolynomial<std::int8_t>::toPolynomial() const;
+template BasicPolynomial<std::uint16_t> BasicSmallPolynomial<std::int8_t>::multiply(const BasicPolynomial<std::uint16_t>&) const;
+template BasicSmallPolynomial<std::int8_t> BasicSmallPolynomial<std::int8_t>::fromPolynomial(const BasicPolynomial<std::uint32_t>&);
+template void BasicSmallPolynomial<std::int8_t>::addTo(BasicPolynomial<std::uint32_t>&) const;
+template BasicPolynomial<std::uint32_t> BasicSmallPolynomial<std::int8_t>::toPolynomial() const;
+template BasicPolynomial<std::uint32_t> BasicSmallPolynomial<std::int8_t>::multiply(const BasicPolynomial<std::uint32_t>&) const;
+template BasicSmallPolynomial<std::int8_t> BasicSmallPolynomial<std::int8_t>::fromPolynomial(const BasicPolynomial<std::uint64_t>&);
+template void BasicSmallPolynomial<std::int8_t>::addTo(BasicPolynomial<std::uint64_t>&) const;
+template BasicPolynomial<std::uint64_t> BasicSmallPolynomial<std::int8_t>::toPolynomial() const;
+template BasicPolynomial<std::uint64_t> BasicSmallPolynomial<std::int8_t>::multiply(const BasicPolynomial<std::uint64_t>&) const;
+template BasicSmallPolynomial<std::int16_t> BasicSmallPolynomial<std::int16_t>::fromPolynomial(const BasicPolynomial<std::uint16_t>&);
+template void BasicSmallPolynomial<std::int16_t>::addTo(BasicPolynomial<std::uint16_t>&) const;
+template BasicPolynomial<std::uint16_t> BasicSmallPolynomial<std::int16_t>::toPolynomial() const;
+template BasicPolynomial<std::uint16_t> BasicSmallPolynomial<std::int16_t>::multiply(const BasicPolynomial<std::uint16_t>&) const;
+template BasicSmallPolynomial<std::int16_t> BasicSmallPolynomial<std::int16_t>::fromPolynomial(const BasicPolynomial<std::uint32_t>&);
+template void BasicSmallPolynomial<std::int16_t>::addTo(BasicPolynomial<std::uint32_t>&) const;
+template BasicPolynomial<std::uint32_t> BasicSmallPolynomial<std::int16_t>::toPolynomial() const;
+template BasicPolynomial<std::uint32_t> BasicSmallPolynomial<std::int16_t>::multiply(const BasicPolynomial<std::uint32_t>&) const;
+template BasicSmallPolynomial<std::int16_t> BasicSmallPolynomial<std::int16_t>::fromPolynomial(const BasicPolynomial<std::uint64_t>&);
+template void BasicSmallPolynomial<std::int16_t>::addTo(BasicPolynomial<std::uint64_t>&) const;
+template BasicPolynomial<std::uint64_t> BasicSmallPolynomial<std::int16_t>::toPolynomial() const;
+template BasicPolynomial<std::uint64_t> BasicSmallPolynomial<std::int16_t>::multiply(const BasicPolynomial<std::uint64_t>&) const;
@@ -0,0 +1,89 @@
+#include <special_prime.h>
+
+#include <map>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <utility>
+
+#include <modulus.h>
+
+namespace {
+
+// Split q - 1 = c * 2^k with c odd. Returns k = 0 for even q.
+void splitModulus(std::uint64_t q, std::uint64_t& c, unsigned& k) {
+    c = q - 1;
+    k = 0;
+    while (c != 0 && (c & 1) == 0) {
+        c >>= 1;
+        ++k;
+    }
+}
+
+std::int64_t floorShift(std::int64_t x, unsigned k) {
+    return x >> k;  // arithmetic shift == floor division by 2^k
+}
+
+} // namespace
+
+bool SpecialPrimeReducer::isSpecialForm(std::uint64_t q) {
+    if (q < 3 || q >= (static_cast<std::uint64_t>(1) << 31)) {
+        return false;
+    }
+
+    std::uint64_t c;
+    unsigned k;
+    splitModulus(q, c, k);
+    if (k == 0) {
+        return false;
+    }
+
+    // Track the range of both K-RED steps for inputs in [0, (q-1)^2].
+    const std::int64_t sq = static_cast<std::int64_t>(q);
+    const std::int64_t sc = static_cast<std::int64_t>(c);
+    const std::int64_t mask = (static_cast<std::int64_t>(1) << k) - 1;
+    const std::int64_t x_max = (sq - 1) * (sq - 1);
+
+    const std::int64_t r1_min = -floorShift(x_max, k);
+    const std::int64_t r1_max = sc * mask;
+
+    const std::int64_t r2_min = -floorShift(r1_max, k);
+    const std::int64_t r2_max = sc * mask - floorShift(r1_min, k);
+
+    return r2_min > -sq && r2_max < 2 * sq;
+}
+
+SpecialPrimeReducer::SpecialPrimeReducer(std::uint64_t q)
+    : q_(q), c_(0), k_(0), mask_(0), c_inv2_(0), c_inv4_(0) {
+    if (!isSpecialForm(q)) {
+        throw std::invalid_argument("SpecialPrimeReducer: modulus is not of the form c * 2^k + 1");
+    }
+    splitModulus(q, c_, k_);
+    mask_ = (static_cast<std::int64_t>(1) << k_) - 1;
+
+    // c * 2^k = q - 1 = -1 (mod q), hence c^{-1} = -2^k.
+    std::uint64_t c_inv = q - (static_cast<std::uint64_t>(1) << k_);
+    c_inv2_ = (c_inv * c_inv) % q;
+    c_inv4_ = (c_inv2_ * c_inv2_) % q;
+}
+
+std::uint64_t SpecialPrimeReducer::prescale(std::uint64_t w) const {
+    const Modulus& mod = Modulus::forValue(q_);
+    return mod.mul(mod.reduce(w), c_inv2_);
+}
+
+const SpecialPrimeReducer* SpecialPrimeReducer::forModulus(std::uint64_t q) {
+    static std::mutex mutex;
+    static std::map<std::uint64_t, std::unique_ptr<const SpecialPrimeReducer>> reducers;
+
+    std::lock_guard<std::mutex> lock(mutex);
+    auto it = reducers.find(q);
+    if (it == reducers.end()) {
+        std::unique_ptr<const SpecialPrimeReducer> reducer;
+        if (isSpecialForm(q)) {
+            reducer = std::make_unique<const SpecialPrimeReducer>(q);
+        }
+        it = reducers.emplace(q, std::move(reducer)).first;
+    }
+    return it->second.get();
+}
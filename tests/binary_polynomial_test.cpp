@@ -0,0 +1,97 @@
+#include <gtest/gtest.h>
+
+#include <binary_polynomial.h>
+#include <kem.h>
+#include <polynomial.h>
+#include <sha256.h>
+
+#include <random>
+#include <vector>
+
+TEST(BinaryPolynomialTest, MatchesCoefficientEncodings) {
+    const uint64_t q = 7681;
+    const std::vector<uint8_t> message = {0xA5, 0x0F, 0x80};
+
+    // Message bits MSB-first, one bit per coefficient, the rest zero.
+    const BinaryPolynomial msg = BinaryPolynomial::fromBytes(message.data(), message.size(), 70, q, 1);
+    std::vector<uint64_t> expected(70, 0);
+    for (size_t i = 0; i < 8 * message.size(); ++i) {
+        expected[i] = (message[i / 8] >> (7 - i % 8)) & 1;
+    }
+    EXPECT_EQ(msg.toPolynomial().getCoeffs(), expected);
+    EXPECT_EQ(msg.popcount(), 9u);
+
+    // Counter-mode SHA-256 expansion, compared against explicit hashing.
+    const std::vector<uint8_t> text = {'h', 'i'};
+    const size_t n = 600;
+    const BinaryPolynomial hashed = BinaryPolynomial::fromSHA256(text, n, q);
+    std::vector<uint64_t> reference;
+    for (uint8_t counter = 0; reference.size() < n; ++counter) {
+        const std::vector<uint8_t> digest = SHA256::hash(std::vector<uint8_t>{counter, 0, 0, 0, 'h', 'i'});
+        for (size_t i = 0; i < 8 * digest.size() && reference.size() < n; ++i) {
+            reference.push_back(((digest[i / 8] >> (7 - i % 8)) & 1) ? q / 2 : 0);
+        }
+    }
+    EXPECT_EQ(hashed.toPolynomial().getCoeffs(), reference);
+    EXPECT_EQ(hashed.words().back() >> (n % 64), 0u);
+
+    // Signals of every width and domain agree with polySignal().
+    std::mt19937_64 rng(0x62697473ULL);
+    std::uniform_int_distribution<uint64_t> dist(0, q - 1);
+    std::vector<uint64_t> c(256);
+    for (auto& v : c) {
+        v = dist(rng);
+    }
+    const Polynomial p(c, q);
+    const BinaryPolynomial signal = BinaryPolynomial::signalOf(p);
+    EXPECT_EQ(signal.toPolynomial().getCoeffs(), p.polySignal().getCoeffs());
+    EXPECT_EQ(BinaryPolynomial::signalOf(Polynomial16(p)), signal);
+    Polynomial ntt = p;
+    ntt.toNTT();
+    EXPECT_EQ(BinaryPolynomial::signalOf(ntt.valuesView()), signal);
+}
+
+TEST(BinaryPolynomialTest, ConditionalAddAndComparison) {
+    const uint64_t q = 7681;
+    const size_t n = 256;
+    const BinaryPolynomial a = BinaryPolynomial::fromSHA256({'a'}, n, q);
+    const BinaryPolynomial b = BinaryPolynomial::fromSHA256({'b'}, n, q);
+
+    std::vector<uint64_t> base(n);
+    for (size_t i = 0; i < n; ++i) {
+        base[i] = (i * 97) % q;
+    }
+    Polynomial target(base, q);
+    a.addTo(target);
+    EXPECT_EQ(target.getCoeffs(), (Polynomial(base, q) + a.toPolynomial()).getCoeffs());
+
+    Polynomial16 narrow(Polynomial(base, q));
+    a.addTo(narrow);
+    EXPECT_EQ(Polynomial(narrow).getCoeffs(), target.getCoeffs());
+
+    size_t differing = 0;
+    for (size_t i = 0; i < n; ++i) {
+        differing += a.test(i) != b.test(i);
+    }
+    EXPECT_EQ(a.distance(b), differing);
+    EXPECT_EQ(a.distance(a), 0u);
+    EXPECT_TRUE(a == BinaryPolynomial::fromSHA256({'a'}, n, q));
+    EXPECT_TRUE(a != b);
+
+    BinaryPolynomial flipped = a;
+    flipped.set(17, !a.test(17));
+    EXPECT_EQ(a.distance(flipped), 1u);
+
+    EXPECT_THROW(a.distance(BinaryPolynomial(n, q, 1)), std::invalid_argument);
+    Polynomial other(n, 12289);
+    EXPECT_THROW(a.addTo(other), std::invalid_argument);
+    EXPECT_THROW(BinaryPolynomial(n, q, q), std::invalid_argument);
+}
+
+TEST(BinaryPolynomialTest, KEMHashUsesBinaryExpansion) {
+    KEM kem(SecurityLevel::KYBER512);
+    const std::vector<uint8_t> message = {1, 2, 3};
+    const RLWEParams params = kem.getParameters();
+    EXPECT_EQ(kem.hashToPolynomial(message).getCoeffs(),
+              BinaryPolynomial::fromSHA256(message, params.n, params.q).toPolynomial().getCoeffs());
+}
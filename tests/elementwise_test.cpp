@@ -0,0 +1,202 @@
+#include <gtest/gtest.h>
+#include <elementwise.h>
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+namespace {
+
+// Straightforward reference for every kernel, in 64-bit arithmetic.
+struct Reference {
+    uint64_t q;
+
+    uint64_t add(uint64_t a, uint64_t b) const { return a >= q - b ? a - (q - b) : a + b; }
+    uint64_t sub(uint64_t a, uint64_t b) const { return a >= b ? a - b : a + (q - b); }
+    uint64_t neg(uint64_t a) const { return a == 0 ? 0 : q - a; }
+    uint64_t mul(uint64_t a, uint64_t b) const { return (a * b) % q; }
+    uint64_t signal(uint64_t c) const {
+        const uint64_t half = q / 2;
+        const uint64_t to_zero = std::min(c, q - c);
+        const uint64_t to_half = c >= half ? std::min(c - half, q - c + half)
+                                           : std::min(half - c, q - half + c);
+        return to_zero <= to_half ? 0 : half;
+    }
+};
+
+template<typename Word>
+void checkKernels(uint64_t q, bool products) {
+    SCOPED_TRACE("q=" + std::to_string(q) + " word bits=" + std::to_string(8 * sizeof(Word)));
+    std::mt19937_64 rng(q);
+    std::uniform_int_distribution<uint64_t> dist(0, q - 1);
+
+    // Odd length exercises the vector remainder loops; include the edges.
+    const size_t n = 67;
+    std::vector<Word> a(n), b(n);
+    for (size_t i = 0; i < n; ++i) {
+        a[i] = static_cast<Word>(dist(rng));
+        b[i] = static_cast<Word>(dist(rng));
+    }
+    a[0] = 0, b[0] = 0;
+    a[1] = static_cast<Word>(q - 1), b[1] = static_cast<Word>(q - 1);
+    a[2] = 0, b[2] = static_cast<Word>(q - 1);
+    a[3] = static_cast<Word>(q / 2), b[3] = static_cast<Word>(q / 2 + 1);
+
+    const Reference ref{q};
+    const uint64_t scalar = dist(rng) + 3 * q;
+
+    for (ElementwiseKernel kernel : Elementwise::allKernels()) {
+        if (!Elementwise::isKernelSupported(kernel)) {
+            continue;
+        }
+        SCOPED_TRACE(Elementwise::kernelName(kernel));
+        Elementwise::setPreferredKernel(kernel);
+
+        std::vector<Word> sum = a, diff = a, rdiff = a, neg = a, sig(n);
+        Elementwise::add(sum.data(), b.data(), n, q);
+        Elementwise::sub(diff.data(), b.data(), n, q);
+        Elementwise::subFrom(rdiff.data(), b.data(), n, q);
+        Elementwise::negate(neg.data(), n, q);
+        Elementwise::signal(a.data(), sig.data(), n, q);
+
+        std::vector<Word> scaled = a, prod = a;
+        if (products) {
+            Elementwise::scale(scaled.data(), n, scalar, q);
+            Elementwise::mulPointwise(prod.data(), b.data(), n, q);
+        }
+
+        for (size_t i = 0; i < n; ++i) {
+            ASSERT_EQ(sum[i], ref.add(a[i], b[i])) << "add at " << i;
+            ASSERT_EQ(diff[i], ref.sub(a[i], b[i])) << "sub at " << i;
+            ASSERT_EQ(rdiff[i], ref.sub(b[i], a[i])) << "subFrom at " << i;
+            ASSERT_EQ(neg[i], ref.neg(a[i])) << "negate at " << i;
+            ASSERT_EQ(sig[i], ref.signal(a[i])) << "signal at " << i;
+            if (products) {
+                ASSERT_EQ(scaled[i], ref.mul(a[i], scalar % q)) << "scale at " << i;
+                ASSERT_EQ(prod[i], ref.mul(a[i], b[i])) << "mulPointwise at " << i;
+            }
+        }
+    }
+    Elementwise::clearPreferredKernel();
+}
+
+} // namespace
+
+TEST(ElementwiseTest, KernelsMatchReferenceForEveryWidth) {
+    // Special primes (K-RED), generic moduli, and moduli that do not fit
+    // the storage word (q = 2^16 with 16-bit words).
+    for (uint64_t q : {17ULL, 7681ULL, 12289ULL, 18433ULL, 65281ULL, 65536ULL}) {
+        checkKernels<uint16_t>(q, true);
+        checkKernels<uint32_t>(q, true);
+        checkKernels<uint64_t>(q, true);
+    }
+    checkKernels<uint32_t>(4294967291ULL, true);
+    checkKernels<uint64_t>(4294967291ULL, true);
+    // Products of 64-bit residues overflow; only the additive kernels apply.
+    checkKernels<uint64_t>((1ULL << 62) + 135, false);
+    checkKernels<uint64_t>(18446744073709551557ULL, false);
+}
+
+TEST(ElementwiseTest, CompressionMatchesReference) {
+    for (uint64_t q : {17ULL, 3329ULL, 7681ULL, 12289ULL, 65536ULL, 4294967291ULL}) {
+        std::vector<uint64_t> a(q < 4096 ? q : 4099);
+        std::mt19937_64 rng(q);
+        std::uniform_int_distribution<uint64_t> dist(0, q - 1);
+        for (size_t i = 0; i < a.size(); ++i) {
+            a[i] = q < 4096 ? i : dist(rng);
+        }
+        a.back() = q - 1;
+
+        unsigned bits = 1;
+        while (((q - 1) >> bits) != 0) {
+            ++bits;
+        }
+        for (unsigned d = 1; d < bits && bits + 2 * d <= 62; ++d) {
+            SCOPED_TRACE("q=" + std::to_string(q) + " d=" + std::to_string(d));
+            const uint64_t mask = (uint64_t(1) << d) - 1;
+            for (ElementwiseKernel kernel : Elementwise::allKernels()) {
+                if (!Elementwise::isKernelSupported(kernel)) {
+                    continue;
+                }
+                SCOPED_TRACE(Elementwise::kernelName(kernel));
+                Elementwise::setPreferredKernel(kernel);
+
+                std::vector<uint64_t> c = a;
+                Elementwise::compress(c.data(), c.size(), d, q);
+                std::vector<uint64_t> r = c;
+                Elementwise::decompress(r.data(), r.size(), d, q);
+                for (size_t i = 0; i < a.size(); ++i) {
+                    // Reference in long division; q * 2^d fits for these sizes.
+                    ASSERT_EQ(c[i], (((a[i] << d) + q / 2) / q) & mask) << "compress at " << i;
+                    ASSERT_EQ(r[i], (q * c[i] + (uint64_t(1) << (d - 1))) >> d)
+                        << "decompress at " << i;
+                }
+            }
+        }
+    }
+    Elementwise::clearPreferredKernel();
+}
+
+TEST(ElementwiseTest, CenteredNormsMatchReference) {
+    for (uint64_t q : {17ULL, 7681ULL, 65521ULL, 4294967291ULL}) {
+        std::vector<uint64_t> a(1031);
+        std::mt19937_64 rng(q);
+        std::uniform_int_distribution<uint64_t> dist(0, q - 1);
+        for (auto& v : a) {
+            v = dist(rng);
+        }
+        // For the 32-bit modulus the squared norm saturates.
+        uint64_t inf = 0, l2 = 0;
+        for (uint64_t c : a) {
+            const uint64_t d = std::min(c, q - c);
+            inf = std::max(inf, d);
+            l2 = l2 > ~uint64_t(0) - d * d ? ~uint64_t(0) : l2 + d * d;
+        }
+
+        SCOPED_TRACE("q=" + std::to_string(q));
+        for (ElementwiseKernel kernel : Elementwise::allKernels()) {
+            if (!Elementwise::isKernelSupported(kernel)) {
+                continue;
+            }
+            SCOPED_TRACE(Elementwise::kernelName(kernel));
+            Elementwise::setPreferredKernel(kernel);
+
+            EXPECT_EQ(Elementwise::normInf(a.data(), a.size(), q), inf);
+            EXPECT_EQ(Elementwise::normL2Squared(a.data(), a.size(), q), l2);
+            EXPECT_TRUE(Elementwise::withinBound(a.data(), a.size(), q, inf));
+            EXPECT_FALSE(Elementwise::withinBound(a.data(), a.size(), q, inf - 1));
+            if (q < 65536) {
+                const std::vector<uint16_t> narrow(a.begin(), a.end());
+                EXPECT_EQ(Elementwise::normInf(narrow.data(), narrow.size(), q), inf);
+                EXPECT_EQ(Elementwise::normL2Squared(narrow.data(), narrow.size(), q), l2);
+            }
+
+            // An unreduced value is rejected even though q + 1 looks centered-small.
+            std::vector<uint64_t> bad = a;
+            bad[517] = q + 1;
+            EXPECT_FALSE(Elementwise::withinBound(bad.data(), bad.size(), q, q));
+        }
+    }
+
+    // Centered magnitudes near 2^63 overflow the squared norm.
+    const uint64_t big = 18446744073709551557ULL;
+    const std::vector<uint64_t> wide = {big / 2, 1};
+    EXPECT_EQ(Elementwise::normInf(wide.data(), wide.size(), big), big / 2);
+    EXPECT_EQ(Elementwise::normL2Squared(wide.data(), wide.size(), big), ~uint64_t(0));
+    Elementwise::clearPreferredKernel();
+}
+
+TEST(ElementwiseTest, KernelSelection) {
+    EXPECT_TRUE(Elementwise::isKernelSupported(ElementwiseKernel::Scalar));
+    for (ElementwiseKernel kernel : Elementwise::allKernels()) {
+        EXPECT_EQ(Elementwise::kernelFromName(Elementwise::kernelName(kernel)), kernel);
+    }
+    EXPECT_THROW(Elementwise::kernelFromName("sse9"), std::invalid_argument);
+
+    const ElementwiseKernel widest = Elementwise::preferredKernel();
+    EXPECT_TRUE(Elementwise::isKernelSupported(widest));
+    Elementwise::setPreferredKernel(ElementwiseKernel::Scalar);
+    EXPECT_EQ(Elementwise::preferredKernel(), ElementwiseKernel::Scalar);
+    Elementwise::clearPreferredKernel();
+    EXPECT_EQ(Elementwise::preferredKernel(), widest);
+}
@@ -0,0 +1,104 @@
+#include <gtest/gtest.h>
+
+#include <fft.h>
+#include <ntt.h>
+#include <polynomial.h>
+
+#include <random>
+#include <vector>
+
+namespace {
+
+std::vector<std::uint64_t> schoolbook(const std::vector<std::uint64_t>& a,
+                                      const std::vector<std::uint64_t>& b, std::uint64_t q) {
+    const std::size_t n = a.size();
+    std::vector<std::uint64_t> res(n, 0);
+    for (std::size_t i = 0; i < n; ++i) {
+        for (std::size_t j = 0; j < n; ++j) {
+            std::uint64_t prod = (a[i] * b[j]) % q;
+            std::size_t k = i + j;
+            if (k < n) {
+                res[k] = (res[k] + prod) % q;
+            } else {
+                res[k - n] = (res[k - n] + q - prod) % q;
+            }
+        }
+    }
+    return res;
+}
+
+} // namespace
+
+TEST(FFTTest, SupportFollowsPrecisionBudget) {
+    EXPECT_TRUE(FFTMultiplier::isSupported(1024, (1u << 20) - 3));
+    EXPECT_TRUE(FFTMultiplier::isSupported(4, 17));
+    EXPECT_FALSE(FFTMultiplier::isSupported(1024, 1u << 21));
+    EXPECT_FALSE(FFTMultiplier::isSupported(1, 17));
+    EXPECT_FALSE(FFTMultiplier::isSupported(12, 17));
+    EXPECT_THROW(FFTMultiplier(1024, 1u << 21), std::invalid_argument);
+}
+
+TEST(FFTTest, MatchesSchoolbookForArbitraryModuli) {
+    std::mt19937_64 rng(0xFF7FF7ULL);
+
+    const std::pair<std::size_t, std::uint64_t> rings[] = {
+        {2, 17}, {4, 17}, {64, 3329}, {256, 3329}, {256, 65536}, {512, 1000003}, {1024, (1u << 20) - 3}};
+
+    for (const auto& [n, q] : rings) {
+        FFTMultiplier fft(n, q);
+        std::uniform_int_distribution<std::uint64_t> dist(0, q - 1);
+        for (int t = 0; t < 3; ++t) {
+            std::vector<std::uint64_t> a(n), b(n);
+            for (std::size_t i = 0; i < n; ++i) {
+                a[i] = dist(rng);
+                b[i] = dist(rng);
+            }
+            std::vector<std::uint64_t> got;
+            ASSERT_TRUE(fft.tryMultiply(a, b, got)) << "n=" << n << " q=" << q;
+            EXPECT_EQ(got, schoolbook(a, b, q)) << "n=" << n << " q=" << q;
+        }
+
+        // Worst case magnitudes: every centered coefficient at -(q-1)/2.
+        std::vector<std::uint64_t> extreme(n, q / 2 + 1);
+        std::vector<std::uint64_t> got;
+        ASSERT_TRUE(fft.tryMultiply(extreme, extreme, got));
+        EXPECT_EQ(got, schoolbook(extreme, extreme, q));
+    }
+}
+
+TEST(FFTTest, PolynomialUsesFFTWithoutNTTTables) {
+    // q = 3329 has no NTT tables for n = 64, so operator* takes the FFT path.
+    const std::size_t n = 64;
+    const std::uint64_t q = 3329;
+    std::mt19937_64 rng(42);
+    std::uniform_int_distribution<std::uint64_t> dist(0, q - 1);
+
+    std::vector<std::uint64_t> a(n), b(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        a[i] = dist(rng);
+        b[i] = dist(rng);
+    }
+
+    Polynomial prod = Polynomial(a, q) * Polynomial(b, q);
+    EXPECT_EQ(prod.getCoeffs(), schoolbook(a, b, q));
+}
+
+TEST(FFTTest, PolynomialFallsBackForNonNTTFriendlyModuli) {
+    // Neither ring satisfies q = 1 (mod 2n), so the NTT cannot be built
+    // for them at all; operator* must still pick FFT or schoolbook.
+    const std::pair<std::size_t, std::uint64_t> rings[] = {{256, 3329}, {4, 7}};
+    std::mt19937_64 rng(7);
+
+    for (const auto& [n, q] : rings) {
+        ASSERT_FALSE(NTT::hasTables(n, q));
+        std::uniform_int_distribution<std::uint64_t> dist(0, q - 1);
+        std::vector<std::uint64_t> a(n), b(n);
+        for (std::size_t i = 0; i < n; ++i) {
+            a[i] = dist(rng);
+            b[i] = dist(rng);
+        }
+
+        Polynomial prod = Polynomial(a, q) * Polynomial(b, q);
+        EXPECT_EQ(prod.getCoeffs(), schoolbook(a, b, q)) << "n=" << n << " q=" << q;
+    }
+}
@@ -0,0 +1,73 @@
+#include <gtest/gtest.h>
+
+#include <fixed_polynomial.h>
+#include <polynomial.h>
+
+#include <array>
+#include <random>
+#include <type_traits>
+
+namespace {
+
+template<typename Fixed>
+std::array<std::uint64_t, Fixed::ring_dimension> randomCoefficients(std::mt19937_64& rng) {
+    std::uniform_int_distribution<std::uint64_t> dist(0, Fixed::modulus - 1);
+    std::array<std::uint64_t, Fixed::ring_dimension> coeffs;
+    for (auto& c : coeffs) {
+        c = dist(rng);
+    }
+    return coeffs;
+}
+
+template<typename Fixed>
+void expectMatchesRuntime(std::uint64_t seed) {
+    std::mt19937_64 rng(seed);
+    Fixed a(randomCoefficients<Fixed>(rng));
+    Fixed b(randomCoefficients<Fixed>(rng));
+    Polynomial ra(a.view());
+    Polynomial rb(b.view());
+    const std::uint64_t scalar = rng();
+
+    EXPECT_EQ(Polynomial((a + b).view()).getCoeffs(), (ra + rb).getCoeffs());
+    EXPECT_EQ(Polynomial((a - b).view()).getCoeffs(), (ra - rb).getCoeffs());
+    EXPECT_EQ(Polynomial((-a).view()).getCoeffs(), (-ra).getCoeffs());
+    EXPECT_EQ(Polynomial((a * scalar).view()).getCoeffs(), (ra * scalar).getCoeffs());
+    EXPECT_EQ(Polynomial((a * b).view()).getCoeffs(), (ra * rb).getCoeffs());
+}
+
+} // namespace
+
+TEST(FixedPolynomialTest, StorageIsCompactAndInline) {
+    static_assert(std::is_same<Kyber512Polynomial::coeff_type, std::uint16_t>::value,
+                  "q = 7681 fits 16 bits");
+    static_assert(sizeof(Kyber512Polynomial) == 256 * sizeof(std::uint16_t),
+                  "no heap pointer or size fields");
+    static_assert(std::is_trivially_copyable<HighPolynomial>::value, "plain array storage");
+    static_assert(Kyber512Polynomial::has_ntt, "KYBER512 ring has NTT tables");
+    static_assert(!FixedPolynomial<4, 17>::has_ntt, "no tables for (4, 17)");
+    SUCCEED();
+}
+
+TEST(FixedPolynomialTest, MatchesRuntimePolynomial) {
+    expectMatchesRuntime<TestTinyPolynomial>(1);
+    expectMatchesRuntime<Kyber512Polynomial>(2);
+    expectMatchesRuntime<ModeratePolynomial>(3);
+    expectMatchesRuntime<HighPolynomial>(4);
+    expectMatchesRuntime<FixedPolynomial<4, 17>>(5);
+    // q = 3329 is not 1 mod 512, so the runtime fallback must avoid the NTT.
+    expectMatchesRuntime<FixedPolynomial<256, 3329>>(6);
+}
+
+TEST(FixedPolynomialTest, ViewsInteroperateWithRuntimeTypes) {
+    Polynomial runtime({1, 2, 3, 16, 20}, 17);  // 20 reduces to 3
+    EXPECT_THROW((FixedPolynomial<4, 17>(runtime)), std::invalid_argument);
+
+    Polynomial ring4({1, 2, 3, 20}, 17);
+    FixedPolynomial<4, 17> fixed(ring4);
+    EXPECT_EQ(fixed[3], 3u);
+
+    Polynomial16 narrow(fixed.view());
+    EXPECT_EQ(Polynomial(narrow.view()).getCoeffs(), ring4.getCoeffs());
+    EXPECT_TRUE((FixedPolynomial<4, 17>(narrow) == fixed));
+    EXPECT_THROW((FixedPolynomial<4, 19>(ring4.view())), std::invalid_argument);
+}
@@ -0,0 +1,85 @@
+#include <gtest/gtest.h>
+
+#include <logging.h>
+
+#include <sstream>
+#include <string>
+
+namespace {
+
+// Restores the global logger configuration after each test.
+class LoggingTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        saved_enabled_ = Logger::enable_logging;
+        saved_level_ = Logger::min_level;
+        saved_out_ = Logger::out;
+        Logger::setOutputStream(sink_);
+    }
+
+    void TearDown() override {
+        Logger::enable_logging = saved_enabled_;
+        Logger::min_level = saved_level_;
+        Logger::out = saved_out_;
+    }
+
+    std::ostringstream sink_;
+
+private:
+    bool saved_enabled_ = false;
+    LogLevel saved_level_ = LogLevel::Trace;
+    std::ostream* saved_out_ = nullptr;
+};
+
+} // namespace
+
+TEST_F(LoggingTest, DisabledLoggingDoesNotEvaluateMessage) {
+    Logger::enable_logging = false;
+    int evaluations = 0;
+    auto message = [&] {
+        ++evaluations;
+        return std::string("expensive");
+    };
+
+    RLWE_LOG_TRACE(message());
+    RLWE_LOG_WARN(message());
+    Logger::logLazy(LogLevel::Warn, message);
+
+    EXPECT_EQ(evaluations, 0);
+    EXPECT_TRUE(sink_.str().empty());
+}
+
+TEST_F(LoggingTest, RuntimeThresholdFiltersLevels) {
+    Logger::enable_logging = true;
+    Logger::min_level = LogLevel::Info;
+    int evaluations = 0;
+
+    RLWE_LOG_TRACE([&] { ++evaluations; return std::string("trace"); }());
+    RLWE_LOG_DEBUG([&] { ++evaluations; return std::string("debug"); }());
+    EXPECT_EQ(evaluations, 0);
+
+    EXPECT_FALSE(Logger::enabled(LogLevel::Debug));
+    EXPECT_TRUE(Logger::enabled(LogLevel::Warn));
+
+    Logger::log(LogLevel::Debug, "dropped");
+    Logger::log("legacy");
+    Logger::logLazy(LogLevel::Warn, [] { return "lazy"; });
+    EXPECT_EQ(sink_.str(), "legacy\nlazy\n");
+}
+
+TEST_F(LoggingTest, MacrosWriteWhenCompiledIn) {
+    Logger::enable_logging = true;
+    Logger::min_level = LogLevel::Trace;
+
+    RLWE_LOG_TRACE("t=" + std::to_string(1));
+    RLWE_LOG_WARN("w");
+
+    std::string expected;
+#if RLWE_LOG_COMPILE_LEVEL <= RLWE_LOG_LEVEL_TRACE
+    expected += "t=1\n";
+#endif
+#if RLWE_LOG_COMPILE_LEVEL <= RLWE_LOG_LEVEL_WARN
+    expected += "w\n";
+#endif
+    EXPECT_EQ(sink_.str(), expected);
+}
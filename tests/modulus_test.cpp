@@ -0,0 +1,89 @@
+#include <gtest/gtest.h>
+
+#include <modulus.h>
+#include <polynomial.h>
+#include <special_prime.h>
+
+#include <random>
+#include <vector>
+
+namespace {
+
+// Reference product modulo q without a 128-bit type: shift-and-add.
+uint64_t mulModReference(uint64_t a, uint64_t b, uint64_t q) {
+    uint64_t r = 0;
+    a %= q;
+    for (; b; b >>= 1) {
+        if (b & 1) r = (r >= q - a) ? r - (q - a) : r + a;
+        a = (a >= q - a) ? a - (q - a) : a + a;
+    }
+    return r;
+}
+
+} // namespace
+
+TEST(ModulusTest, ReductionsMatchDivision) {
+    const std::vector<uint64_t> moduli = {
+        1, 2, 3, 17, 7681, 12289, 18433, 65536, 65537, (1ULL << 31) - 1, 1ULL << 31,
+        4294967291ULL, 1ULL << 32, (1ULL << 62) + 135, 18446744073709551557ULL};
+    std::mt19937_64 rng(0x6d6f6475ULL);
+
+    for (uint64_t q : moduli) {
+        SCOPED_TRACE("q=" + std::to_string(q));
+        const Modulus& mod = Modulus::forValue(q);
+        EXPECT_EQ(mod.value(), q);
+        EXPECT_EQ(mod.bits(), Polynomial::coefficientBits(q));
+        EXPECT_EQ(mod.isSpecialForm(), SpecialPrimeReducer::isSpecialForm(q));
+
+        std::vector<uint64_t> xs = {0, 1, q - 1, q, ~0ULL, ~0ULL - 1, q * 2, q * (q - 1)};
+        for (int i = 0; i < 2000; ++i) {
+            xs.push_back(rng() >> (rng() % 64));
+        }
+        for (uint64_t x : xs) {
+            ASSERT_EQ(mod.reduce(x), x % q) << "x=" << x;
+            if (q <= static_cast<uint64_t>(INT64_MAX)) {
+                const int64_t sx = static_cast<int64_t>(x);
+                const int64_t r = sx % static_cast<int64_t>(q);
+                ASSERT_EQ(mod.reduceSigned(sx), static_cast<uint64_t>(r < 0 ? r + static_cast<int64_t>(q) : r))
+                    << "signed x=" << sx;
+            }
+
+            const uint64_t a = x % q;
+            const uint64_t b = rng() % q;
+            ASSERT_EQ(mod.mul(a, b), mulModReference(a, b, q)) << "a=" << a << " b=" << b;
+            ASSERT_EQ(mod.sub(mod.add(a, b), b), a);
+            if (q <= (1ULL << 32)) {
+                ASSERT_EQ(mod.mulShoup(a, b, mod.shoup(b)), (a * b) % q);
+            }
+            if (mod.hasMontgomery()) {
+                ASSERT_EQ(mod.fromMontgomery(mod.toMontgomery(a)), a);
+                ASSERT_EQ(mod.fromMontgomery(mod.montgomeryMul(mod.toMontgomery(a), mod.toMontgomery(b))),
+                          (a * b) % q);
+            }
+        }
+
+        uint64_t naive = 1 % q;
+        const uint64_t base = rng();
+        for (uint64_t e = 0; e < 40; ++e) {
+            ASSERT_EQ(mod.pow(base, e), naive) << "e=" << e;
+            naive = mulModReference(naive, base % q, q);
+        }
+    }
+}
+
+TEST(ModulusTest, InstancesAreInternedAndShared) {
+    const Modulus& a = Modulus::forValue(7681);
+    EXPECT_EQ(&a, &Modulus::forValue(7681));
+    EXPECT_NE(&a, &Modulus::forValue(12289));
+    EXPECT_EQ(&a, &Modulus::forValue(7681));
+    EXPECT_TRUE(a.hasWordBarrett());
+    EXPECT_TRUE(a.hasMontgomery());
+    EXPECT_NE(a.special(), nullptr);
+    EXPECT_FALSE(Modulus::forValue(65536).hasMontgomery());
+    EXPECT_TRUE(Modulus::forValue(65536).isPowerOfTwo());
+    EXPECT_THROW(Modulus::forValue(0), std::invalid_argument);
+
+    const Polynomial p(4, 7681);
+    EXPECT_EQ(&p.getModulusInfo(), &a);
+    EXPECT_EQ(&Polynomial16(p).getModulusInfo(), &a);
+}
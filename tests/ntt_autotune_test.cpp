@@ -0,0 +1,75 @@
+#include <gtest/gtest.h>
+
+#include <ntt_autotune.h>
+
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <string>
+
+namespace {
+
+std::string tempCachePath(const char* name) {
+    return (std::filesystem::temp_directory_path() / name).string();
+}
+
+} // namespace
+
+TEST(NTTAutotuneTest, TunesEveryRegisteredLevel) {
+    NTTAutotuner tuner;
+    tuner.setRepetitions(1);
+
+    auto results = tuner.tuneAll();
+    EXPECT_EQ(results.size(), NTTAutotuner::registeredLevels().size());
+
+    for (const auto& r : results) {
+        EXPECT_FALSE(r.from_cache);
+        EXPECT_TRUE(NTT::isKernelSupported(r.kernel, r.n, r.q));
+        EXPECT_EQ(NTT::preferredKernel(r.n, r.q), r.kernel);
+    }
+
+    NTT::clearPreferredKernels();
+}
+
+TEST(NTTAutotuneTest, PersistsSelectionAcrossInstances) {
+    const std::string path = tempCachePath("rlwe_ntt_autotune_test.cache");
+    std::remove(path.c_str());
+
+    std::vector<NTTTuningResult> first;
+    {
+        NTTAutotuner tuner(path);
+        tuner.setRepetitions(1);
+        first = tuner.tuneAll();
+    }
+    NTT::clearPreferredKernels();
+
+    NTTAutotuner reloaded(path);
+    auto second = reloaded.tuneAll();
+    ASSERT_EQ(second.size(), first.size());
+    for (std::size_t i = 0; i < first.size(); ++i) {
+        EXPECT_TRUE(second[i].from_cache);
+        EXPECT_EQ(second[i].kernel, first[i].kernel);
+        EXPECT_EQ(NTT::preferredKernel(second[i].n, second[i].q), first[i].kernel);
+    }
+
+    NTT::clearPreferredKernels();
+    std::remove(path.c_str());
+}
+
+TEST(NTTAutotuneTest, IgnoresCacheFromAnotherHost) {
+    const std::string path = tempCachePath("rlwe_ntt_autotune_foreign.cache");
+    {
+        std::ofstream out(path, std::ios::trunc);
+        out << "rlwe-ntt-autotune 1\n";
+        out << "host some-other-host\n";
+        out << "256 7681 reference 1\n";
+    }
+
+    NTTAutotuner tuner(path);
+    tuner.setRepetitions(1);
+    NTTTuningResult r = tuner.tune(256, 7681);
+    EXPECT_FALSE(r.from_cache);
+
+    NTT::clearPreferredKernels();
+    std::remove(path.c_str());
+}
@@ -3,6 +3,7 @@
 #include <kem.h>
 #include <ntt.h>
 
+#include <algorithm>
 #include <random>
 
 namespace {
@@ -86,3 +87,131 @@ TEST(NTTTest, RoundtripAllSecurityLevels) {
     check_ntt_roundtrip_for_params(
         KEM::getParameterSet(SecurityLevel::HIGH), 0xDEADBEEFULL);
 }
+
+TEST(NTTTest, AllKernelsProduceIdenticalTransforms) {
+    const SecurityLevel levels[] = {SecurityLevel::TEST_TINY, SecurityLevel::TEST_SMALL,
+                                    SecurityLevel::KYBER512, SecurityLevel::MODERATE,
+                                    SecurityLevel::HIGH};
+
+    for (SecurityLevel level : levels) {
+        const RLWEParams params = KEM::getParameterSet(level);
+        std::mt19937_64 rng(params.n * 31 + params.q);
+        std::uniform_int_distribution<std::uint64_t> dist(0, params.q - 1);
+
+        std::vector<std::uint64_t> input(params.n);
+        for (auto& c : input) {
+            c = dist(rng);
+        }
+
+        NTT reference(params.n, params.q, /*negacyclic=*/true, NTTKernel::Reference);
+        std::vector<std::uint64_t> expected = input;
+        reference.forward(expected);
+
+        for (NTTKernel kernel : NTT::allKernels()) {
+            if (!NTT::isKernelSupported(kernel, params.n, params.q)) {
+                continue;
+            }
+            NTT ntt(params.n, params.q, /*negacyclic=*/true, kernel);
+            std::vector<std::uint64_t> got = input;
+            ntt.forward(got);
+            EXPECT_EQ(got, expected) << "kernel=" << NTT::kernelName(kernel)
+                                     << ", n=" << params.n;
+            ntt.inverse(got);
+            EXPECT_EQ(got, input) << "kernel=" << NTT::kernelName(kernel)
+                                  << ", n=" << params.n;
+        }
+    }
+}
+
+TEST(NTTTest, PreferredKernelRegistry) {
+    const RLWEParams params = KEM::getParameterSet(SecurityLevel::KYBER512);
+
+    NTT::setPreferredKernel(params.n, params.q, NTTKernel::Reference);
+    EXPECT_EQ(NTT::preferredKernel(params.n, params.q), NTTKernel::Reference);
+    EXPECT_EQ(NTT(params.n, params.q).kernel(), NTTKernel::Reference);
+    EXPECT_EQ(NTT::forRing(params.n, params.q).kernel(), NTTKernel::Reference);
+
+    NTT::clearPreferredKernels();
+    EXPECT_EQ(NTT::preferredKernel(params.n, params.q), NTTKernel::Lazy);
+
+    for (NTTKernel kernel : NTT::allKernels()) {
+        EXPECT_EQ(NTT::kernelFromName(NTT::kernelName(kernel)), kernel);
+    }
+    EXPECT_THROW(NTT::kernelFromName("bogus"), std::invalid_argument);
+}
+
+TEST(NTTTest, RingScopeBindsAnInstanceOnThisThread) {
+    const RLWEParams params = KEM::getParameterSet(SecurityLevel::KYBER512);
+    const NTT& shared = NTT::forRing(params.n, params.q);
+    const NTT reference(params.n, params.q, true, NTTKernel::Reference);
+    {
+        NTT::RingScope outer(reference);
+        EXPECT_EQ(&NTT::forRing(params.n, params.q), &reference);
+        EXPECT_EQ(&NTT::forRing(512, 12289), &NTT::forRing(512, 12289));
+        EXPECT_NE(NTT::forRing(512, 12289).size(), params.n);
+        {
+            NTT::RingScope inner(shared);
+            EXPECT_EQ(&NTT::forRing(params.n, params.q), &shared);
+        }
+        EXPECT_EQ(&NTT::forRing(params.n, params.q), &reference);
+    }
+    EXPECT_EQ(&NTT::forRing(params.n, params.q), &shared);
+}
+
+TEST(NTTTest, CompactTablesAreConsistent) {
+    const SecurityLevel levels[] = {SecurityLevel::TEST_TINY, SecurityLevel::TEST_SMALL,
+                                    SecurityLevel::KYBER512, SecurityLevel::MODERATE,
+                                    SecurityLevel::HIGH};
+
+    for (SecurityLevel level : levels) {
+        const RLWEParams params = KEM::getParameterSet(level);
+        const ntt_tables::PsiTables* tbl = ntt_tables::getPsiTables(params.n, params.q);
+        ASSERT_NE(tbl, nullptr);
+        const std::uint64_t q = params.q;
+
+        // twist[i] * untwist[i] == n^{-1}, so all products agree with i = 0.
+        const std::uint64_t n_inv = tbl->untwist[0];
+        EXPECT_EQ(tbl->twist[0], 1u);
+        EXPECT_EQ((n_inv * params.n) % q, 1u);
+        EXPECT_EQ(tbl->twist[1], tbl->psi);
+        for (std::size_t i = 0; i < params.n; ++i) {
+            EXPECT_EQ((std::uint64_t(tbl->twist[i]) * tbl->untwist[i]) % q, n_inv);
+        }
+
+        // Each layer starts at 1 and forward/inverse entries are inverses.
+        for (std::size_t h = 1; h < params.n; h <<= 1) {
+            EXPECT_EQ(tbl->fwd_layers[h - 1], 1u);
+            for (std::size_t j = 0; j < h; ++j) {
+                EXPECT_EQ((std::uint64_t(tbl->fwd_layers[h - 1 + j]) * tbl->inv_layers[h - 1 + j]) % q, 1u);
+            }
+        }
+    }
+}
+
+TEST(NTTTest, WordOverloadsAgreeForEveryKernel) {
+    const std::size_t n = 256;
+    const std::uint64_t q = 7681;
+    std::mt19937_64 rng(0x776F7264ULL);
+    std::uniform_int_distribution<std::uint64_t> dist(0, q - 1);
+
+    std::vector<std::uint64_t> wide(n);
+    for (auto& c : wide) {
+        c = dist(rng);
+    }
+
+    for (NTTKernel kernel : NTT::allKernels()) {
+        if (!NTT::isKernelSupported(kernel, n, q)) {
+            continue;
+        }
+        NTT ntt(n, q, true, kernel);
+
+        std::vector<std::uint64_t> a = wide;
+        std::vector<std::uint32_t> b(wide.begin(), wide.end());
+        ntt.forward(a);
+        ntt.forward(b);
+        EXPECT_TRUE(std::equal(a.begin(), a.end(), b.begin())) << NTT::kernelName(kernel);
+
+        ntt.inverse(b);
+        EXPECT_TRUE(std::equal(wide.begin(), wide.end(), b.begin())) << NTT::kernelName(kernel);
+    }
+}
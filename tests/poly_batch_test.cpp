@@ -0,0 +1,107 @@
+#include <gtest/gtest.h>
+
+#include <poly_batch.h>
+#include <polynomial.h>
+#include <prepared_polynomial.h>
+#include "test_util.h"
+
+#include <random>
+#include <vector>
+
+namespace {
+
+std::vector<Polynomial> randomPolynomials(std::mt19937_64& rng, size_t count, size_t n, uint64_t q) {
+    std::vector<Polynomial> polys;
+    for (size_t k = 0; k < count; ++k) {
+        polys.push_back(randomPolynomial(rng, n, q));
+    }
+    return polys;
+}
+
+} // namespace
+
+TEST(PolyBatchTest, MatchesSerialOperations) {
+    std::mt19937_64 rng(0x62617463ULL);
+    const size_t n = 256;
+    const uint64_t q = 7681;
+    const std::vector<Polynomial> a = randomPolynomials(rng, 37, n, q);
+    std::vector<Polynomial> b = randomPolynomials(rng, 37, n, q);
+    b[5].toNTT();  // mixed domains are handled per item
+
+    const PreparedPolynomial fixed(a[0]);
+    EXPECT_GE(poly_batch::defaultThreads(), 1);
+
+    for (const poly_batch::Options options : {poly_batch::Options{1, 1}, poly_batch::Options{4, 1},
+                                              poly_batch::Options{0, 8}, poly_batch::Options{3, 100}}) {
+        SCOPED_TRACE("threads=" + std::to_string(options.threads) + " grain=" + std::to_string(options.grain));
+
+        const auto sums = poly_batch::addMany(a, b, options);
+        const auto products = poly_batch::multiplyMany(a, b, options);
+        const auto scaled = poly_batch::multiplyMany(b, fixed, options);
+        const auto signals = poly_batch::signalMany(a, options);
+        const auto bytes = poly_batch::toBytesMany(b, options);
+        ASSERT_EQ(sums.size(), a.size());
+        ASSERT_EQ(bytes.size(), b.size());
+
+        for (size_t i = 0; i < a.size(); ++i) {
+            EXPECT_EQ(sums[i].getCoeffs(), (a[i] + b[i]).getCoeffs());
+            EXPECT_EQ(products[i].getCoeffs(), (a[i] * b[i]).getCoeffs());
+            EXPECT_EQ(scaled[i].getCoeffs(), (b[i] * a[0]).getCoeffs());
+            EXPECT_EQ(signals[i].getCoeffs(), a[i].polySignal().getCoeffs());
+            EXPECT_EQ(bytes[i], Polynomial::toBytes(b[i].valuesView()));
+        }
+    }
+
+    // Inputs are read without converting them.
+    EXPECT_EQ(b[5].domain(), PolyDomain::NTT);
+
+    const std::vector<Polynomial16> narrow = {Polynomial16(a[1]), Polynomial16(a[2])};
+    const auto narrow_sums = poly_batch::addMany(narrow, narrow, {2, 1});
+    EXPECT_EQ(Polynomial(narrow_sums[1]).getCoeffs(), (a[2] + a[2]).getCoeffs());
+
+    EXPECT_TRUE(poly_batch::signalMany(std::vector<Polynomial>{}).empty());
+}
+
+TEST(PolyBatchTest, NormsAndBoundsScreening) {
+    std::mt19937_64 rng(0x6e6f726dULL);
+    const uint64_t q = 7681;
+    std::vector<Polynomial> batch;
+    for (int k = 0; k < 23; ++k) {
+        std::vector<uint64_t> c(256);
+        for (auto& v : c) {
+            v = (rng() % 11 + q - 5) % q;
+        }
+        batch.emplace_back(c, q);
+    }
+    batch[4] = batch[4] * batch[5];
+
+    for (const poly_batch::Options& options : {poly_batch::Options{1, 1}, poly_batch::Options{3, 2}}) {
+        const auto inf = poly_batch::normInfMany(batch, options);
+        const auto l2 = poly_batch::normL2SquaredMany(batch, options);
+        ASSERT_EQ(inf.size(), batch.size());
+        for (size_t i = 0; i < batch.size(); ++i) {
+            EXPECT_EQ(inf[i], Polynomial::normInf(batch[i].valuesView()));
+            EXPECT_EQ(l2[i], Polynomial::normL2Squared(batch[i].valuesView()));
+        }
+
+        std::vector<Polynomial> screened = batch;
+        screened[4] = Polynomial(256, q);
+        EXPECT_EQ(poly_batch::firstOutOfBound(screened, 5, options), screened.size());
+        screened[17].setCoefficients(std::vector<uint64_t>(256, 6));
+        screened[19].setCoefficients(std::vector<uint64_t>(256, q - 7));
+        EXPECT_EQ(poly_batch::firstOutOfBound(screened, 5, options), 17u);
+    }
+    EXPECT_EQ(batch[4].domain(), PolyDomain::NTT);
+}
+
+TEST(PolyBatchTest, PropagatesErrorsFromWorkers) {
+    std::mt19937_64 rng(0x6572726fULL);
+    std::vector<Polynomial> a = randomPolynomials(rng, 16, 32, 7681);
+    std::vector<Polynomial> b = randomPolynomials(rng, 16, 32, 7681);
+    b[11] = Polynomial(32, 12289);
+
+    EXPECT_THROW(poly_batch::addMany(a, b, {4, 1}), std::invalid_argument);
+    EXPECT_THROW(poly_batch::multiplyMany(a, b, {4, 2}), std::invalid_argument);
+    b.pop_back();
+    EXPECT_THROW(poly_batch::addMany(a, b), std::invalid_argument);
+}
@@ -0,0 +1,70 @@
+#include <gtest/gtest.h>
+#include <poly_expr.h>
+#include "test_util.h"
+
+#include <random>
+#include <utility>
+#include <vector>
+
+using poly_expr::lazy;
+
+class PolyExprTest : public ::testing::Test {
+protected:
+    std::mt19937_64 rng{0x6c617a79ULL};
+};
+
+TEST_F(PolyExprTest, MatchesEagerEvaluation) {
+    // NTT ring, ring without tables (schoolbook fallback), narrow storage.
+    const std::vector<std::pair<size_t, uint64_t>> rings = {{256, 7681}, {4, 17}, {16, 65281}};
+
+    for (const auto& ring : rings) {
+        const Polynomial a = randomPolynomial(rng, ring.first, ring.second);
+        const Polynomial b = randomPolynomial(rng, ring.first, ring.second);
+        const Polynomial s = randomPolynomial(rng, ring.first, ring.second);
+        const Polynomial r = randomPolynomial(rng, ring.first, ring.second);
+        const Polynomial e = randomPolynomial(rng, ring.first, ring.second);
+        const Polynomial m = randomPolynomial(rng, ring.first, ring.second);
+
+        Polynomial key = lazy(a) * s + e;
+        EXPECT_EQ(key.getCoeffs(), (a * s + e).getCoeffs());
+
+        Polynomial cipher = lazy(b) * r + e + m;
+        EXPECT_EQ(cipher.getCoeffs(), (b * r + e + m).getCoeffs());
+
+        Polynomial mixed = a * lazy(s) - b * r - e + 3 * lazy(m);
+        EXPECT_EQ(mixed.getCoeffs(), (a * s - b * r - e + m * 3).getCoeffs());
+
+        Polynomial nested = (lazy(a) + b) * (lazy(s) - r) * e - -lazy(m);
+        EXPECT_EQ(nested.getCoeffs(), ((a + b) * (s - r) * e + m).getCoeffs());
+
+        Polynomial16 a16(a), s16(s), e16(e);
+        Polynomial16 narrow = lazy(a16) * s16 + e16;
+        EXPECT_EQ(Polynomial(narrow).getCoeffs(), key.getCoeffs());
+    }
+}
+
+TEST_F(PolyExprTest, EvaluateIntoReusesStorageAndAllowsAliasing) {
+    const Polynomial a = randomPolynomial(rng, 256, 7681);
+    const Polynomial s = randomPolynomial(rng, 256, 7681);
+    Polynomial e = randomPolynomial(rng, 256, 7681);
+    const Polynomial expected = a * s + e;
+
+    const uint64_t* storage = e.getCoeffs().data();
+    poly_expr::evaluateInto(lazy(a) * s + e, e);
+    EXPECT_EQ(e.getCoeffs().data(), storage);
+    EXPECT_EQ(e.getCoeffs(), expected.getCoeffs());
+
+    Polynomial fresh(4, 17);  // different ring: replaced by the result
+    poly_expr::evaluateInto(lazy(a) - s, fresh);
+    EXPECT_EQ(fresh.getCoeffs(), (a - s).getCoeffs());
+}
+
+TEST_F(PolyExprTest, RequiresSameRing) {
+    Polynomial f({1, 2, 3, 4}, 17);
+    Polynomial different_dim({1, 2}, 17);
+    Polynomial different_mod({1, 2, 3, 4}, 19);
+
+    EXPECT_THROW(poly_expr::evaluate(lazy(f) + different_dim), std::invalid_argument);
+    EXPECT_THROW(poly_expr::evaluate(lazy(f) * different_mod), std::invalid_argument);
+    EXPECT_THROW(poly_expr::evaluate(lazy(f) * f + different_mod), std::invalid_argument);
+}
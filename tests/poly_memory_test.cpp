@@ -0,0 +1,114 @@
+#include <gtest/gtest.h>
+#include <poly_memory.h>
+#include <polynomial.h>
+#include <ntt.h>
+#include "test_util.h"
+
+#include <memory_resource>
+#include <random>
+#include <vector>
+
+namespace {
+
+// Forwards to new/delete and counts allocations.
+class CountingResource : public std::pmr::memory_resource {
+public:
+    std::size_t allocations = 0;
+    std::size_t outstanding = 0;
+
+private:
+    void* do_allocate(std::size_t bytes, std::size_t alignment) override {
+        ++allocations;
+        ++outstanding;
+        return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+    }
+
+    void do_deallocate(void* p, std::size_t bytes, std::size_t alignment) override {
+        --outstanding;
+        std::pmr::new_delete_resource()->deallocate(p, bytes, alignment);
+    }
+
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override {
+        return this == &other;
+    }
+};
+
+} // namespace
+
+TEST(PolyMemoryTest, PoolReusesBlocksPerSizeClass) {
+    CountingResource upstream;
+    {
+        PolyPool pool(&upstream);
+
+        void* a = pool.allocate(256 * sizeof(uint32_t));
+        pool.deallocate(a, 256 * sizeof(uint32_t));
+        EXPECT_EQ(pool.cachedBlocks(), 1u);
+
+        // Same size class: served from the free list.
+        void* b = pool.allocate(1000);
+        EXPECT_EQ(b, a);
+        EXPECT_EQ(upstream.allocations, 1u);
+
+        // Different size class: new upstream block.
+        void* c = pool.allocate(1024 * sizeof(uint64_t));
+        EXPECT_NE(c, a);
+        EXPECT_EQ(upstream.allocations, 2u);
+
+        // Oversized requests bypass the pool.
+        void* big = pool.allocate(PolyPool::max_block_bytes + 1);
+        pool.deallocate(big, PolyPool::max_block_bytes + 1);
+        EXPECT_EQ(upstream.outstanding, 2u);
+
+        pool.deallocate(b, 1000);
+        pool.deallocate(c, 1024 * sizeof(uint64_t));
+        EXPECT_EQ(pool.cachedBlocks(), 2u);
+
+        pool.release();
+        EXPECT_EQ(pool.cachedBlocks(), 0u);
+        EXPECT_EQ(upstream.outstanding, 0u);
+    }
+}
+
+TEST(PolyMemoryTest, ArithmeticDrawsScratchFromPluggableResource) {
+    std::mt19937_64 rng(0x706f6f6cULL);
+    const Polynomial a = randomPolynomial(rng, 256, 7681);
+    const Polynomial b = randomPolynomial(rng, 256, 7681);
+    const Polynomial expected = a * b;
+
+    CountingResource counting;
+    std::pmr::memory_resource* previous = poly_memory::setScratch(&counting);
+    EXPECT_EQ(poly_memory::scratch(), &counting);
+
+    Polynomial product = a * b;
+    Polynomial16 narrow = Polynomial16(a) * Polynomial16(b);
+    EXPECT_GT(counting.allocations, 0u);
+    EXPECT_EQ(counting.outstanding, 0u);
+
+    poly_memory::setScratch(previous);
+    EXPECT_EQ(product.getCoeffs(), expected.getCoeffs());
+    EXPECT_EQ(Polynomial(narrow).getCoeffs(), expected.getCoeffs());
+}
+
+TEST(PolyMemoryTest, RequestScopeInstallsAndRestoresArena) {
+    std::mt19937_64 rng(0x61726e61ULL);
+    const Polynomial a = randomPolynomial(rng, 512, 12289);
+    const Polynomial b = randomPolynomial(rng, 512, 12289);
+    const Polynomial expected = a * b;
+
+    std::pmr::memory_resource* outside = poly_memory::scratch();
+    for (int request = 0; request < 3; ++request) {
+        poly_memory::RequestScope scope;
+        EXPECT_NE(poly_memory::scratch(), outside);
+
+        Polynomial product = a * b;
+        EXPECT_EQ(product.getCoeffs(), expected.getCoeffs());
+        Polynomial roundtrip = a;
+        NTT::forRing(512, 12289).forward(roundtrip);
+        NTT::forRing(512, 12289).inverse(roundtrip);
+        EXPECT_EQ(roundtrip.getCoeffs(), a.getCoeffs());
+    }
+    EXPECT_EQ(poly_memory::scratch(), outside);
+
+    // The arena's chunks went back to this thread's pool for reuse.
+    EXPECT_GT(PolyPool::threadLocal().cachedBlocks(), 0u);
+}
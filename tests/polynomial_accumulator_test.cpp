@@ -0,0 +1,103 @@
+#include <gtest/gtest.h>
+
+#include <polynomial.h>
+#include <polynomial_accumulator.h>
+#include "test_util.h"
+
+#include <random>
+#include <vector>
+
+TEST(PolynomialAccumulatorTest, MatchesChainedArithmetic) {
+    const size_t n = 256;
+    const uint64_t q = 7681;
+    std::mt19937_64 rng(0x61636375ULL);
+
+    std::vector<Polynomial> terms;
+    for (int k = 0; k < 40; ++k) {
+        terms.push_back(randomPolynomial(rng, n, q));
+    }
+
+    Polynomial expected = terms[0];
+    PolynomialAccumulator acc(n, q);
+    acc += terms[0];
+    for (size_t k = 1; k < terms.size(); ++k) {
+        if (k % 3 == 0) {
+            expected -= terms[k];
+            acc -= Polynomial16(terms[k]);
+        } else {
+            expected += terms[k];
+            acc += terms[k].view();
+        }
+    }
+    EXPECT_EQ(acc.terms(), terms.size());
+    EXPECT_EQ(acc.result().getCoeffs(), expected.getCoeffs());
+    EXPECT_EQ(Polynomial(acc.result<uint16_t>()).getCoeffs(), expected.getCoeffs());
+
+    Polynomial chained = terms[0];
+    for (size_t k = 1; k < terms.size(); ++k) {
+        chained = chained + terms[k];
+    }
+    EXPECT_EQ(Polynomial::sum(terms).getCoeffs(), chained.getCoeffs());
+    EXPECT_EQ(Polynomial::sum(terms.data(), 1).getCoeffs(), terms[0].getCoeffs());
+
+    acc.reset();
+    EXPECT_EQ(acc.terms(), 0u);
+    EXPECT_EQ(acc.result().getCoeffs(), std::vector<uint64_t>(n, 0));
+}
+
+TEST(PolynomialAccumulatorTest, KeepsTheDomainOfTheFirstTerm) {
+    const size_t n = 256;
+    const uint64_t q = 7681;
+    std::mt19937_64 rng(0x646f6d61ULL);
+
+    const Polynomial a = randomPolynomial(rng, n, q);
+    const Polynomial s = randomPolynomial(rng, n, q);
+    const Polynomial b = randomPolynomial(rng, n, q);
+    const Polynomial e = randomPolynomial(rng, n, q);
+
+    // a*s and b*s stay in the NTT domain; e is converted forward.
+    const std::vector<Polynomial> terms = {a * s, b * s, e};
+    ASSERT_EQ(terms[0].domain(), PolyDomain::NTT);
+    const Polynomial total = Polynomial::sum(terms);
+    EXPECT_EQ(total.domain(), PolyDomain::NTT);
+    EXPECT_EQ(total.getCoeffs(), (a * s + b * s + e).getCoeffs());
+
+    PolynomialAccumulator acc(n, q);
+    acc.add(e).add(terms[0]).subtract(terms[1]);
+    EXPECT_EQ(acc.domain(), PolyDomain::Coefficient);
+    EXPECT_EQ(acc.result().getCoeffs(), (e + a * s - b * s).getCoeffs());
+}
+
+TEST(PolynomialAccumulatorTest, FoldsBeforeOverflowAndRejectsBadInput) {
+    // With q = 2^63 - 25 every second term forces a fold.
+    const size_t n = 16;
+    const uint64_t q = (uint64_t(1) << 63) - 25;
+    std::mt19937_64 rng(0x666f6c64ULL);
+
+    PolynomialAccumulator acc(n, q);
+    Polynomial expected(n, q);
+    for (int k = 0; k < 9; ++k) {
+        const Polynomial t = randomPolynomial(rng, n, q);
+        if (k % 4 == 3) {
+            acc.subtract(t);
+            expected -= t;
+        } else {
+            acc.add(t);
+            expected += t;
+        }
+    }
+    EXPECT_EQ(acc.result().getCoeffs(), expected.getCoeffs());
+
+    // Moduli above 2^63 cannot defer, but sum() still works.
+    const uint64_t wide = 18446744073709551557ULL;
+    EXPECT_FALSE(PolynomialAccumulator::supportsModulus(wide));
+    EXPECT_THROW(PolynomialAccumulator(n, wide), std::invalid_argument);
+    const std::vector<Polynomial> wide_terms = {randomPolynomial(rng, n, wide),
+                                                randomPolynomial(rng, n, wide)};
+    EXPECT_EQ(Polynomial::sum(wide_terms).getCoeffs(), (wide_terms[0] + wide_terms[1]).getCoeffs());
+
+    EXPECT_THROW(Polynomial::sum(std::vector<Polynomial>{}), std::invalid_argument);
+    EXPECT_THROW(Polynomial::sum({Polynomial(n, 7681), Polynomial(n, 12289)}), std::invalid_argument);
+    PolynomialAccumulator small(n, 7681);
+    EXPECT_THROW(small.add(Polynomial(2 * n, 7681)), std::invalid_argument);
+}
@@ -1,6 +1,7 @@
 #include <gtest/gtest.h>
 
 #include <kem.h>
+#include <ntt.h>
 #include <polynomial.h>
 
 #include <random>
@@ -97,3 +98,39 @@ TEST(PolynomialNTTMultiplyTest, AllSecurityLevelsMatchSchoolbook) {
         check_ntt_multiply_matches_schoolbook(params, seed);
     }
 }
+
+TEST(PolynomialNTTMultiplyTest, BatchInverseYieldsIdentity) {
+    const RLWEParams params = KEM::getParameterSet(SecurityLevel::KYBER512);
+    const std::size_t n = params.n;
+    const std::uint64_t q = params.q;
+
+    std::mt19937_64 rng(0x5152535455565758ULL);
+    std::uniform_int_distribution<std::uint64_t> dist(0, q - 1);
+
+    std::vector<std::uint64_t> one_coeffs(n, 0);
+    one_coeffs[0] = 1;
+
+    // Build invertible polynomials by inverting random NTT-domain values
+    // that are all nonzero, so every input has an inverse.
+    NTT ntt(n, q, /*negacyclic=*/true);
+    std::vector<Polynomial> polys;
+    for (int t = 0; t < 4; ++t) {
+        std::vector<std::uint64_t> evals(n);
+        for (std::size_t i = 0; i < n; ++i) {
+            evals[i] = 1 + dist(rng) % (q - 1);
+        }
+        ntt.inverse(evals);
+        polys.emplace_back(evals, q);
+    }
+
+    std::vector<Polynomial> inverses = Polynomial::batchInverse(polys);
+    ASSERT_EQ(inverses.size(), polys.size());
+    for (std::size_t k = 0; k < polys.size(); ++k) {
+        Polynomial prod = polys[k] * inverses[k];
+        EXPECT_EQ(prod.getCoeffs(), one_coeffs) << "Polynomial " << k;
+        EXPECT_EQ(polys[k].inverse().getCoeffs(), inverses[k].getCoeffs());
+    }
+
+    polys.emplace_back(n, q);  // zero polynomial is never invertible
+    EXPECT_THROW(Polynomial::batchInverse(polys), std::invalid_argument);
+}
@@ -1,5 +1,35 @@
 #include <gtest/gtest.h>
 #include <polynomial.h>
+#include <ntt.h>
+
+#include <cmath>
+#include <random>
+#include <type_traits>
+#include <utility>
+
+namespace {
+
+// Negacyclic schoolbook product in Z_q[x]/(x^n + 1), independent of the
+// NTT, FFT and lazy-domain paths under test.
+std::vector<uint64_t> schoolbook(const std::vector<uint64_t>& a, const std::vector<uint64_t>& b,
+                                 uint64_t q) {
+    const size_t n = a.size();
+    std::vector<uint64_t> res(n, 0);
+    for (size_t i = 0; i < n; ++i) {
+        for (size_t j = 0; j < n; ++j) {
+            const uint64_t prod = (a[i] * b[j]) % q;
+            const size_t k = i + j;
+            if (k < n) {
+                res[k] = (res[k] + prod) % q;
+            } else {
+                res[k - n] = (res[k - n] + q - prod) % q;
+            }
+        }
+    }
+    return res;
+}
+
+} // namespace
 
 class PolynomialTest : public ::testing::Test {
 protected:
@@ -14,7 +44,8 @@ TEST_F(PolynomialTest, ToBytes) {
     
     auto bytes = p.toBytes();
     
-    size_t expected_size = sizeof(size_t) + sizeof(uint64_t) + 4 * sizeof(uint64_t);
+    // 4-byte dimension, 8-byte modulus, four 5-bit coefficients in 3 bytes.
+    size_t expected_size = 4 + 8 + 3;
     EXPECT_EQ(bytes.size(), expected_size);
     
     Polynomial p2(4, 17);
@@ -138,6 +169,25 @@ TEST_F(PolynomialTest, SetCoefficientsModReductionAndSizeCheck) {
     EXPECT_THROW(p.setCoefficients(wrong_size), std::invalid_argument);
 }
 
+TEST_F(PolynomialTest, CoefficientOverloadsReduceAlike) {
+    // Inputs at or above 2^63 are plain unsigned values, not negatives:
+    // uint64_t(-1) mod 7681 is 7680 on every path.
+    const uint64_t big_q = 7681;
+    const std::vector<uint64_t> values = {UINT64_MAX, uint64_t(1) << 63, 7682, 5};
+    const std::vector<uint64_t> expected = {UINT64_MAX % big_q, (uint64_t(1) << 63) % big_q, 1, 5};
+
+    Polynomial copied(4, big_q);
+    copied.setCoefficients(values);
+    Polynomial moved(4, big_q);
+    moved.setCoefficients(std::vector<uint64_t>(values));
+
+    EXPECT_EQ(copied.getCoeffs(), expected);
+    EXPECT_EQ(moved.getCoeffs(), expected);
+    EXPECT_EQ(Polynomial(values, big_q).getCoeffs(), expected);
+    EXPECT_EQ(Polynomial(std::vector<uint64_t>(values), big_q).getCoeffs(), expected);
+    EXPECT_EQ(Polynomial16(values, big_q)[0], UINT64_MAX % big_q);
+}
+
 TEST_F(PolynomialTest, RingDimensionAndModulusAccessors) {
     Polynomial p({1, 2, 3, 4}, q);
 
@@ -158,3 +208,390 @@ TEST_F(PolynomialTest, OperationsRequireSameRingAndModulus) {
     EXPECT_THROW(f - different_mod, std::invalid_argument);
     EXPECT_THROW(f * different_mod, std::invalid_argument);
 }
+
+TEST_F(PolynomialTest, CoefficientTypeFollowsModulus) {
+    static_assert(std::is_same<coeff_type_for_t<7681>, uint16_t>::value, "q < 2^16 uses 16 bits");
+    static_assert(std::is_same<coeff_type_for_t<65536>, uint16_t>::value, "q - 1 fits 16 bits");
+    static_assert(std::is_same<coeff_type_for_t<65537>, uint32_t>::value, "q > 2^16 uses 32 bits");
+    static_assert(std::is_same<coeff_type_for_t<(1ULL << 40)>, uint64_t>::value, "large q uses 64 bits");
+    static_assert(std::is_same<PolynomialFor<12289>, Polynomial16>::value, "alias picks Polynomial16");
+
+    EXPECT_TRUE(Polynomial16::supportsModulus(65536));
+    EXPECT_FALSE(Polynomial16::supportsModulus(65537));
+    EXPECT_THROW(Polynomial16(4, 65537), std::invalid_argument);
+    EXPECT_NO_THROW(Polynomial32(4, 65537));
+}
+
+TEST_F(PolynomialTest, NarrowCoefficientsMatchWideArithmetic) {
+    // (n, q) pairs covering the schoolbook, FFT and NTT multiplication paths.
+    const std::vector<std::pair<size_t, uint64_t>> rings = {{4, 17}, {16, 65281}, {256, 7681}};
+    std::mt19937_64 rng(0x77696474ULL);
+
+    for (const auto& ring : rings) {
+        std::uniform_int_distribution<uint64_t> dist(0, ring.second - 1);
+        std::vector<uint64_t> a(ring.first), b(ring.first);
+        for (size_t i = 0; i < ring.first; ++i) {
+            a[i] = dist(rng);
+            b[i] = dist(rng);
+        }
+
+        Polynomial fa(a, ring.second), fb(b, ring.second);
+        Polynomial16 ha(a, ring.second), hb(b, ring.second);
+        Polynomial32 wa(a, ring.second), wb(b, ring.second);
+
+        const uint64_t scalar = dist(rng);
+        const std::vector<Polynomial> expected = {fa + fb, fa - fb, -fa, fa * fb, fa * scalar};
+        const std::vector<Polynomial16> narrow = {ha + hb, ha - hb, -ha, ha * hb, ha * scalar};
+        const std::vector<Polynomial32> medium = {wa + wb, wa - wb, -wa, wa * wb, wa * scalar};
+
+        for (size_t k = 0; k < expected.size(); ++k) {
+            EXPECT_EQ(Polynomial(narrow[k]).getCoeffs(), expected[k].getCoeffs()) << "op " << k;
+            EXPECT_EQ(Polynomial(medium[k]).getCoeffs(), expected[k].getCoeffs()) << "op " << k;
+            EXPECT_EQ(narrow[k].toBytes(), expected[k].toBytes()) << "op " << k;
+        }
+    }
+}
+
+TEST_F(PolynomialTest, CompoundOperatorsMatchBinaryOperators) {
+    Polynomial f({3, 5, 7, 9}, q);
+    Polynomial g({16, 1, 0, 12}, q);
+
+    Polynomial sum = f;
+    sum += g;
+    EXPECT_EQ(sum.getCoeffs(), (f + g).getCoeffs());
+
+    Polynomial diff = f;
+    diff -= g;
+    EXPECT_EQ(diff.getCoeffs(), (f - g).getCoeffs());
+    EXPECT_EQ((g - Polynomial(f)).getCoeffs(), (g - f).getCoeffs());
+
+    Polynomial prod = f;
+    prod *= g;
+    EXPECT_EQ(prod.getCoeffs(), (f * g).getCoeffs());
+
+    Polynomial square = f;
+    square *= square;
+    EXPECT_EQ(square.getCoeffs(), (f * f).getCoeffs());
+
+    Polynomial scaled = f;
+    scaled *= 20;
+    EXPECT_EQ(scaled.getCoeffs(), (f * 3).getCoeffs());
+
+    Polynomial neg = f;
+    neg.negate();
+    EXPECT_EQ(neg.getCoeffs(), (-f).getCoeffs());
+
+    Polynomial wrong({1, 2}, q);
+    EXPECT_THROW(sum += wrong, std::invalid_argument);
+    EXPECT_THROW(diff -= wrong, std::invalid_argument);
+    EXPECT_THROW(prod *= wrong, std::invalid_argument);
+}
+
+TEST_F(PolynomialTest, RvalueOperandsReuseStorage) {
+    Polynomial f({3, 5, 7, 9}, q);
+    Polynomial g({16, 1, 0, 12}, q);
+    const Polynomial expected = f * g + g - f;
+
+    Polynomial lhs = f;
+    const uint64_t* lhs_storage = lhs.getCoeffs().data();
+    Polynomial result = std::move(lhs) * g + g - f;
+    EXPECT_EQ(result.getCoeffs().data(), lhs_storage);
+    EXPECT_EQ(result.getCoeffs(), expected.getCoeffs());
+
+    Polynomial rhs = g;
+    const uint64_t* rhs_storage = rhs.getCoeffs().data();
+    Polynomial reversed = f - std::move(rhs);
+    EXPECT_EQ(reversed.getCoeffs().data(), rhs_storage);
+    EXPECT_EQ(reversed.getCoeffs(), (f - g).getCoeffs());
+
+    std::vector<uint64_t> values = {1, 18, 35, 52};
+    const uint64_t* value_storage = values.data();
+    Polynomial adopted(4, q);
+    adopted.setCoefficients(std::move(values));
+    EXPECT_EQ(adopted.getCoeffs().data(), value_storage);
+    EXPECT_EQ(adopted.getCoeffs(), std::vector<uint64_t>({1, 1, 1, 1}));
+}
+
+TEST_F(PolynomialTest, ProductsStayInNTTDomainUntilObserved) {
+    std::mt19937_64 rng(0x646f6d61ULL);
+    std::uniform_int_distribution<uint64_t> dist(0, 7680);
+    auto random = [&] {
+        std::vector<uint64_t> c(256);
+        for (auto& v : c) {
+            v = dist(rng);
+        }
+        return Polynomial(c, 7681);
+    };
+    const Polynomial a = random(), s = random(), b = random(), r = random(), e = random();
+
+    // Reference values computed entirely in the coefficient domain.
+    const std::vector<uint64_t> as = schoolbook(a.getCoeffs(), s.getCoeffs(), 7681);
+    const std::vector<uint64_t> br = schoolbook(b.getCoeffs(), r.getCoeffs(), 7681);
+    const std::vector<uint64_t> ev = e.getCoeffs();
+
+    Polynomial chain = a * s;
+    EXPECT_EQ(chain.domain(), PolyDomain::NTT);
+    chain += b * r;
+    EXPECT_EQ(chain.domain(), PolyDomain::NTT);
+    chain *= chain;
+    EXPECT_EQ(chain.domain(), PolyDomain::NTT);
+
+    std::vector<uint64_t> sum(256);
+    for (size_t i = 0; i < 256; ++i) {
+        sum[i] = (as[i] + br[i]) % 7681;
+    }
+    EXPECT_EQ(chain.getCoeffs(), schoolbook(sum, sum, 7681));
+    EXPECT_EQ(chain.domain(), PolyDomain::Coefficient);
+
+    // Mixed domains settle in coefficient form, whichever side is in NTT form.
+    Polynomial left = a * s;
+    left += e;
+    EXPECT_EQ(left.domain(), PolyDomain::Coefficient);
+    Polynomial right = e - a * s;
+    EXPECT_EQ(right.domain(), PolyDomain::Coefficient);
+    for (size_t i = 0; i < 256; ++i) {
+        EXPECT_EQ(left[i], (as[i] + ev[i]) % 7681);
+        EXPECT_EQ(right[i], (ev[i] + 7681 - as[i]) % 7681);
+    }
+
+    // Observers convert; explicit conversions round-trip.
+    Polynomial observed = a * s;
+    EXPECT_EQ(observed.toBytes(), Polynomial(as, 7681).toBytes());
+    EXPECT_EQ(observed.domain(), PolyDomain::Coefficient);
+    Polynomial explicit_ntt = a;
+    explicit_ntt.toNTT();
+    EXPECT_EQ(explicit_ntt.domain(), PolyDomain::NTT);
+    EXPECT_NE(explicit_ntt.values(), a.getCoeffs());
+    EXPECT_EQ(explicit_ntt.toCoefficients().values(), a.getCoeffs());
+
+    // Rings without NTT tables never leave the coefficient domain.
+    Polynomial small({1, 2, 3, 4}, q);
+    EXPECT_EQ((small * small).domain(), PolyDomain::Coefficient);
+    EXPECT_THROW(small.toNTT(), std::invalid_argument);
+}
+
+TEST_F(PolynomialTest, PackedEncodingIsCanonicalAndRoundTrips) {
+    // Fixed bytes: little-endian header, then 5-bit fields LSB first.
+    const std::vector<uint8_t> expected = {4, 0, 0, 0, 17, 0, 0, 0, 0, 0, 0, 0, 0x41, 0x0C, 0x02};
+    EXPECT_EQ(Polynomial({1, 2, 3, 4}, q).toBytes(), expected);
+    EXPECT_EQ(Polynomial16({1, 2, 3, 4}, q).toBytes(), expected);
+
+    EXPECT_EQ(Polynomial::coefficientBits(7681), 13u);
+    EXPECT_EQ(Polynomial::coefficientBits(65536), 16u);
+    EXPECT_EQ(Polynomial::coefficientBits(65537), 17u);
+    EXPECT_EQ(Polynomial::packedSize(256, 7681), 12u + 416u);
+
+    std::mt19937_64 rng(0x7061636bULL);
+    const std::vector<std::pair<size_t, uint64_t>> rings = {
+        {256, 7681}, {512, 12289}, {1024, 18433}, {5, 3}, {7, 65536},
+        {9, 4294967291ULL}, {6, 18446744073709551557ULL}};
+    for (const auto& ring : rings) {
+        std::uniform_int_distribution<uint64_t> dist(0, ring.second - 1);
+        std::vector<uint64_t> c(ring.first);
+        for (auto& v : c) {
+            v = dist(rng);
+        }
+        c[0] = ring.second - 1;
+        const Polynomial p(c, ring.second);
+        const std::vector<uint8_t> bytes = p.toBytes();
+        EXPECT_EQ(bytes.size(), Polynomial::packedSize(ring.first, ring.second));
+        EXPECT_EQ(Polynomial::fromBytes(bytes).getCoeffs(), p.getCoeffs()) << "q=" << ring.second;
+        if (Polynomial32::supportsModulus(ring.second)) {
+            EXPECT_EQ(Polynomial(Polynomial32::fromBytes(bytes)).getCoeffs(), p.getCoeffs());
+        }
+    }
+
+    // NTT-domain values are converted before encoding.
+    std::vector<uint64_t> c(256, 5);
+    Polynomial ntt_form(c, 7681);
+    ntt_form.toNTT();
+    EXPECT_EQ(ntt_form.toBytes(), Polynomial(c, 7681).toBytes());
+}
+
+TEST_F(PolynomialTest, FromBytesRejectsMalformedInput) {
+    const std::vector<uint8_t> good = Polynomial({1, 2, 3, 4}, q).toBytes();
+    EXPECT_NO_THROW(Polynomial::fromBytes(good));
+
+    std::vector<uint8_t> truncated(good.begin(), good.end() - 1);
+    EXPECT_THROW(Polynomial::fromBytes(truncated), std::invalid_argument);
+    EXPECT_THROW(Polynomial::fromBytes(good.data(), 5), std::invalid_argument);
+
+    std::vector<uint8_t> out_of_range = good;
+    out_of_range[12] |= 0x1F;  // coefficient 0 = 31 >= 17
+    EXPECT_THROW(Polynomial::fromBytes(out_of_range), std::invalid_argument);
+
+    std::vector<uint8_t> padding = good;
+    padding.back() |= 0x80;  // bit beyond the last coefficient
+    EXPECT_THROW(Polynomial::fromBytes(padding), std::invalid_argument);
+
+    std::vector<uint8_t> zero_modulus = good;
+    zero_modulus[4] = 0;
+    EXPECT_THROW(Polynomial::fromBytes(zero_modulus), std::invalid_argument);
+
+    std::vector<uint8_t> wide = Polynomial({1, 2}, 65537).toBytes();
+    EXPECT_THROW(Polynomial16::fromBytes(wide), std::invalid_argument);
+}
+
+TEST_F(PolynomialTest, CompressionBoundsErrorAndRoundTrips) {
+    const uint64_t kq = 7681;
+    const size_t n = 256;
+    std::vector<uint64_t> values(n);
+    for (size_t i = 0; i < n; ++i) {
+        values[i] = (i * 2654435761ULL) % kq;
+    }
+    const Polynomial original(values, kq);
+
+    for (unsigned d : {1u, 4u, 10u, 12u}) {
+        SCOPED_TRACE("d=" + std::to_string(d));
+        Polynomial p = original;
+        p.compress(d);
+        for (size_t i = 0; i < n; ++i) {
+            ASSERT_LT(static_cast<uint64_t>(p[i]), uint64_t(1) << d);
+        }
+
+        // Compress(Decompress(y)) == y.
+        Polynomial compressed = p;
+        Polynomial again = p;
+        again.decompress(d).compress(d);
+        EXPECT_EQ(again.getCoeffs(), compressed.getCoeffs());
+
+        // Decompress(Compress(x)) is within ceil(q / 2^(d+1)) of x.
+        p.decompress(d);
+        const uint64_t bound = (kq + (uint64_t(1) << (d + 1)) - 1) >> (d + 1);
+        for (size_t i = 0; i < n; ++i) {
+            const uint64_t diff = (p[i] + kq - values[i]) % kq;
+            EXPECT_LE(std::min(diff, kq - diff), bound) << "coefficient " << i;
+        }
+
+        const std::vector<uint8_t> wire = original.toCompressedBytes(d);
+        EXPECT_EQ(wire.size(), 4 + 8 + 1 + (n * d + 7) / 8);
+        EXPECT_EQ(wire.size(), Polynomial::compressedSize(n, d));
+        EXPECT_EQ(Polynomial::fromCompressedBytes(wire).getCoeffs(), p.getCoeffs());
+    }
+
+    Polynomial p = original;
+    EXPECT_THROW(p.compress(0), std::invalid_argument);
+    EXPECT_THROW(p.compress(13), std::invalid_argument);
+    Polynomial big({1, 2, 3, 4}, kq);
+    EXPECT_THROW(big.decompress(2), std::invalid_argument);
+}
+
+TEST_F(PolynomialTest, FromCompressedBytesRejectsMalformedInput) {
+    const std::vector<uint8_t> good = Polynomial({1, 5, 9, 13}, q).toCompressedBytes(3);
+    ASSERT_EQ(good.size(), 12 + 1 + 2u);
+    EXPECT_NO_THROW(Polynomial::fromCompressedBytes(good));
+
+    std::vector<uint8_t> truncated(good.begin(), good.end() - 1);
+    EXPECT_THROW(Polynomial::fromCompressedBytes(truncated), std::invalid_argument);
+    EXPECT_THROW(Polynomial::fromCompressedBytes(good.data(), 12), std::invalid_argument);
+
+    std::vector<uint8_t> bad_width = good;
+    bad_width[12] = 5;  // 17 has 5-bit coefficients; d must be smaller
+    EXPECT_THROW(Polynomial::fromCompressedBytes(bad_width), std::invalid_argument);
+
+    std::vector<uint8_t> padding = good;
+    padding.back() |= 0x80;
+    EXPECT_THROW(Polynomial::fromCompressedBytes(padding), std::invalid_argument);
+}
+
+TEST_F(PolynomialTest, ViewsOverExternalBuffersMatchPolynomials) {
+    const size_t kn = 256;
+    const uint64_t kq = 7681;
+    std::mt19937_64 rng(0x76696577ULL);
+    std::uniform_int_distribution<uint64_t> dist(0, kq - 1);
+
+    // A "request batch": two polynomials back to back in one flat array.
+    std::vector<uint64_t> batch(2 * kn);
+    for (auto& v : batch) {
+        v = dist(rng);
+    }
+    const std::vector<uint64_t> untouched = batch;
+    const PolynomialView x(batch.data(), kn, kq);
+    const PolynomialView y(batch.data() + kn, kn, kq);
+    const Polynomial px(x), py(y);
+
+    Polynomial sum = px;
+    sum += y;
+    EXPECT_EQ(sum.getCoeffs(), (px + py).getCoeffs());
+    Polynomial diff = px;
+    diff -= y;
+    EXPECT_EQ(diff.getCoeffs(), (px - py).getCoeffs());
+    Polynomial prod = px;
+    prod *= y;
+    EXPECT_EQ(prod.getCoeffs(), (px * py).getCoeffs());
+    EXPECT_EQ(Polynomial::polySignal(x).getCoeffs(), px.polySignal().getCoeffs());
+    EXPECT_EQ(Polynomial::toBytes(x), px.toBytes());
+
+    // NTT-domain buffers are recognised through the view's domain.
+    const NTT& ntt = NTT::forRing(kn, kq);
+    std::vector<uint64_t> evals(kn);
+    ntt.forward(y, evals.data());
+    const PolynomialView y_ntt(evals.data(), kn, kq, PolyDomain::NTT);
+    Polynomial prod_ntt = px;
+    prod_ntt *= y_ntt;
+    EXPECT_EQ(prod_ntt.getCoeffs(), prod.getCoeffs());
+    Polynomial sum_ntt = px;
+    sum_ntt += y_ntt;
+    EXPECT_EQ(sum_ntt.getCoeffs(), sum.getCoeffs());
+    EXPECT_EQ(Polynomial::polySignal(y_ntt).getCoeffs(), py.polySignal().getCoeffs());
+    EXPECT_EQ(Polynomial::toBytes(y_ntt), py.toBytes());
+    EXPECT_EQ(Polynomial(y_ntt).domain(), PolyDomain::NTT);
+    EXPECT_EQ(Polynomial(y_ntt).getCoeffs(), py.getCoeffs());
+
+    std::vector<uint64_t> back(kn);
+    ntt.inverse(y_ntt, back.data());
+    EXPECT_EQ(back, py.getCoeffs());
+    EXPECT_THROW(ntt.forward(y_ntt, back.data()), std::invalid_argument);
+    EXPECT_THROW(ntt.inverse(y, back.data()), std::invalid_argument);
+
+    // A polynomial's own values can be viewed without converting them.
+    Polynomial lazy = px * py;
+    EXPECT_EQ(lazy.valuesView().domain(), PolyDomain::NTT);
+    EXPECT_EQ(Polynomial::toBytes(lazy.valuesView()), prod.toBytes());
+    EXPECT_EQ(lazy.domain(), PolyDomain::NTT);
+
+    EXPECT_EQ(batch, untouched);
+    Polynomial other_ring(kn, 12289);
+    EXPECT_THROW(other_ring += x, std::invalid_argument);
+
+    // Without NTT tables an NTT-domain view cannot be multiplied.
+    const std::vector<uint64_t> small = {1, 2, 3, 4};
+    Polynomial tiny({1, 1, 0, 0}, q);
+    EXPECT_THROW(tiny *= PolynomialView(small.data(), 4, q, PolyDomain::NTT), std::invalid_argument);
+    tiny *= PolynomialView(small.data(), 4, q);
+    EXPECT_EQ(tiny.getCoeffs(), (Polynomial({1, 1, 0, 0}, q) * Polynomial(small, q)).getCoeffs());
+}
+
+TEST_F(PolynomialTest, CenteredNormsAndBoundsChecks) {
+    // Centered values 3, -5, 8, 0, -1 modulo 17.
+    const Polynomial p({3, 12, 8, 0, 16, 0, 0, 0}, q);
+    EXPECT_EQ(p.normInf(), 8u);
+    EXPECT_EQ(p.normL2Squared(), 9u + 25u + 64u + 1u);
+    EXPECT_DOUBLE_EQ(p.normL2(), std::sqrt(99.0));
+    EXPECT_TRUE(p.isBounded(8));
+    EXPECT_FALSE(p.isBounded(7));
+    EXPECT_EQ(Polynomial(8, q).normInf(), 0u);
+
+    // NTT-domain values are measured in coefficient form.
+    const size_t kn = 256;
+    const uint64_t kq = 7681;
+    std::mt19937_64 rng(0x6e6f726dULL);
+    std::vector<uint64_t> small(kn);
+    for (auto& v : small) {
+        v = (rng() % 9 + kq - 4) % kq;
+    }
+    const Polynomial s(small, kq);
+    std::vector<uint64_t> one(kn, 0);
+    one[0] = 1;
+    const Polynomial lazy = s * Polynomial(one, kq);
+    ASSERT_EQ(lazy.valuesView().domain(), PolyDomain::NTT);
+    EXPECT_EQ(Polynomial::normInf(lazy.valuesView()), s.normInf());
+    EXPECT_EQ(Polynomial::normL2Squared(lazy.valuesView()), s.normL2Squared());
+    EXPECT_TRUE(Polynomial::isBounded(lazy.valuesView(), 4));
+    EXPECT_EQ(Polynomial16(s).normInf(), s.normInf());
+    EXPECT_EQ(lazy.valuesView().domain(), PolyDomain::NTT);
+
+    // Untrusted buffers with unreduced values fail the bounds check.
+    small[7] = kq + 2;
+    EXPECT_FALSE(Polynomial::isBounded(PolynomialView(small.data(), kn, kq), kq));
+}
@@ -0,0 +1,80 @@
+#include <gtest/gtest.h>
+
+#include <kem.h>
+#include <ntt.h>
+#include <polynomial.h>
+#include <prepared_polynomial.h>
+#include "test_util.h"
+
+#include <random>
+#include <vector>
+
+TEST(PreparedPolynomialTest, ProductsMatchOrdinaryMultiplication) {
+    std::mt19937_64 rng(0x70726570ULL);
+    for (const auto& ring : std::vector<std::pair<size_t, uint64_t>>{{256, 7681}, {512, 12289}, {4, 17}}) {
+        const size_t n = ring.first;
+        const uint64_t q = ring.second;
+        SCOPED_TRACE("n=" + std::to_string(n) + " q=" + std::to_string(q));
+
+        const Polynomial fixed = randomPolynomial(rng, n, q);
+        const Polynomial x = randomPolynomial(rng, n, q);
+        const std::vector<uint64_t> expected = (x * fixed).getCoeffs();
+
+        const PreparedPolynomial prepared(fixed);
+        const bool has_ntt = NTT::hasTables(n, q);
+        EXPECT_EQ(prepared.domain(), has_ntt ? PolyDomain::NTT : PolyDomain::Coefficient);
+        EXPECT_EQ(prepared.hasShoup(), has_ntt);
+        EXPECT_EQ(prepared.toPolynomial().getCoeffs(), fixed.getCoeffs());
+
+        EXPECT_EQ((x * prepared).getCoeffs(), expected);
+        EXPECT_EQ(Polynomial(Polynomial16(x) * prepared).getCoeffs(), expected);
+        EXPECT_EQ((x * PreparedPolynomial(fixed, false)).getCoeffs(), expected);
+        EXPECT_EQ((Polynomial32(x) * PreparedPolynomial(Polynomial16(fixed), false)).getCoeffs(),
+                  Polynomial32(Polynomial(expected, q)).getCoeffs());
+
+        if (has_ntt) {
+            // Operands already in the NTT domain are used without transforming.
+            Polynomial x_hat = x;
+            x_hat.toNTT();
+            x_hat *= prepared;
+            EXPECT_EQ(x_hat.domain(), PolyDomain::NTT);
+            EXPECT_EQ(x_hat.getCoeffs(), expected);
+
+            const PreparedPolynomial from_ntt(x * fixed);
+            EXPECT_EQ(from_ntt.values(), PreparedPolynomial(Polynomial(expected, q)).values());
+        }
+    }
+
+    const PreparedPolynomial other_ring(Polynomial(256, 12289));
+    Polynomial p(256, 7681);
+    EXPECT_THROW(p *= other_ring, std::invalid_argument);
+}
+
+TEST(PreparedPolynomialTest, KEMStoresPreparedKeys) {
+    KEM kem(SecurityLevel::KYBER512);
+    kem.generateKeys();
+
+    const auto pk = kem.getPublicKey();
+    const auto prepared = kem.getPreparedPublicKey();
+
+    // a is sampled in the NTT domain and adopted as it is.
+    EXPECT_EQ(pk.first.domain(), PolyDomain::NTT);
+    EXPECT_EQ(prepared.first.values(), pk.first.values());
+    EXPECT_EQ(prepared.first.domain(), PolyDomain::NTT);
+    EXPECT_EQ(prepared.first.toPolynomial().getCoeffs(), pk.first.getCoeffs());
+    EXPECT_EQ(prepared.second.toPolynomial().getCoeffs(), pk.second.getCoeffs());
+
+    // b - a*s is the Gaussian error, so every coefficient is small.
+    const RLWEParams params = kem.getParameters();
+    const Polynomial e = pk.second - kem.getSecretKeyForTesting() * prepared.first;
+    for (uint64_t c : e.getCoeffs()) {
+        EXPECT_TRUE(c <= 40 || c >= params.q - 40) << c;
+    }
+}
+
+TEST(PreparedPolynomialTest, KEMSamplesCoefficientsWithoutTables) {
+    KEM kem(16, 7681);
+    kem.generateKeys();
+    EXPECT_EQ(kem.getPublicKey().first.domain(), PolyDomain::Coefficient);
+    EXPECT_EQ(kem.getPreparedPublicKey().first.domain(), PolyDomain::Coefficient);
+}
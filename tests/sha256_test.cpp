@@ -55,6 +55,50 @@ TEST(SHA256Test, HashPolynomial) {
     EXPECT_EQ(hash2.size(), SHA256_DIGEST_LENGTH);
 }
 
+TEST(SHA256Test, HashPolynomialView) {
+    const std::vector<uint64_t> wide = {1, 2, 3, 4};
+    const std::vector<uint16_t> narrow = {1, 2, 3, 4};
+    const Polynomial p(wide, 17);
+
+    EXPECT_EQ(SHA256::polyToHash(PolynomialView(wide.data(), 4, 17)), SHA256::polyToHash(p));
+    EXPECT_EQ(SHA256::polyToHash(PolynomialView16(narrow.data(), 4, 17)), SHA256::polyToHash(p));
+}
+
+TEST(SHA256Test, StreamedPolynomialHashMatchesPackedEncoding) {
+    // 1024 coefficients span several packing chunks.
+    const size_t n = 1024;
+    const uint64_t q = 18433;
+    std::vector<uint64_t> c(n);
+    for (size_t i = 0; i < n; ++i) {
+        c[i] = (i * 7919 + 13) % q;
+    }
+    const Polynomial p(c, q);
+
+    std::vector<uint8_t> streamed;
+    size_t pieces = 0;
+    Polynomial::writeBytes(p.view(), [&](const uint8_t* data, size_t size) {
+        streamed.insert(streamed.end(), data, data + size);
+        ++pieces;
+    });
+    EXPECT_EQ(streamed, p.toBytes());
+    EXPECT_GT(pieces, 2u);
+    EXPECT_EQ(SHA256::polyToHash(p), SHA256::hash(p.toBytes()));
+
+    // An NTT-domain product hashes like its coefficients and is not converted.
+    std::vector<uint64_t> one(n, 0);
+    one[0] = 1;
+    const Polynomial lazy = p * Polynomial(one, q);
+    ASSERT_EQ(lazy.domain(), PolyDomain::NTT);
+    EXPECT_EQ(SHA256::polyToHash(lazy), SHA256::polyToHash(p));
+    EXPECT_EQ(lazy.domain(), PolyDomain::NTT);
+
+    SHA256::Context context;
+    const std::string msg = "hello world";
+    context.update(reinterpret_cast<const uint8_t*>(msg.data()), 5);
+    context.update(reinterpret_cast<const uint8_t*>(msg.data()) + 5, msg.size() - 5);
+    EXPECT_EQ(context.finish(), SHA256::hash(msg));
+}
+
 TEST(SHA256Test, ConsistentHashes) {
     std::string msg = "test message";
     auto hash1 = SHA256::hash(msg);
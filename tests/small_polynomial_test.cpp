@@ -0,0 +1,102 @@
+#include <gtest/gtest.h>
+
+#include <kem.h>
+#include <polynomial.h>
+#include <small_polynomial.h>
+#include "test_util.h"
+
+#include <random>
+#include <vector>
+
+namespace {
+
+std::vector<int64_t> randomSmall(std::mt19937_64& rng, size_t n, int bound, size_t weight) {
+    std::vector<int64_t> v(n, 0);
+    std::uniform_int_distribution<int> value(-bound, bound);
+    std::uniform_int_distribution<size_t> position(0, n - 1);
+    for (size_t k = 0; k < weight; ++k) {
+        v[position(rng)] = value(rng);
+    }
+    return v;
+}
+
+} // namespace
+
+TEST(SmallPolynomialTest, CenteredStorageAndLifting) {
+    const uint64_t q = 7681;
+    const SmallPolynomial p({3, -1, 0, -127, 127, 0, 0, 5}, q);
+    EXPECT_EQ(p.weight(), 5u);
+    EXPECT_EQ(p.absoluteSum(), 263u);
+    EXPECT_EQ(p[3], -127);
+
+    const Polynomial lifted = p.toPolynomial();
+    EXPECT_EQ(lifted.getCoeffs(), (std::vector<uint64_t>{3, q - 1, 0, q - 127, 127, 0, 0, 5}));
+    EXPECT_EQ(SmallPolynomial::fromPolynomial(lifted).values(), p.values());
+    EXPECT_EQ(SmallPolynomial16::fromPolynomial(Polynomial16(lifted)).toPolynomial().getCoeffs(),
+              lifted.getCoeffs());
+
+    Polynomial target(std::vector<uint64_t>(8, q - 2), q);
+    p.addTo(target);
+    EXPECT_EQ(target.getCoeffs(), (std::vector<uint64_t>{1, q - 3, q - 2, q - 129, 125, q - 2, q - 2, 3}));
+
+    EXPECT_TRUE(SmallPolynomial::fits(-128, q));
+    EXPECT_FALSE(SmallPolynomial::fits(128, q));
+    EXPECT_FALSE(SmallPolynomial16::fits(17, 17));
+    EXPECT_THROW(SmallPolynomial(std::vector<int64_t>{200}, q), std::invalid_argument);
+    EXPECT_THROW(SmallPolynomial::fromPolynomial(Polynomial(std::vector<uint64_t>{1000}, q)), std::invalid_argument);
+    SmallPolynomial16 wide(4, q);
+    wide.set(2, -1000);
+    EXPECT_EQ(wide[2], -1000);
+    EXPECT_THROW(wide.set(0, 40000), std::invalid_argument);
+    EXPECT_THROW(p.addTo(target = Polynomial(8, 12289)), std::invalid_argument);
+}
+
+TEST(SmallPolynomialTest, ProductsMatchFullSizeMultiplication) {
+    std::mt19937_64 rng(0x736d616cULL);
+    struct Case {
+        size_t n;
+        uint64_t q;
+        size_t weight;
+        bool direct;
+    };
+    const std::vector<Case> cases = {
+        {256, 7681, 12, true},     // sparse in an NTT ring
+        {256, 7681, 256, false},   // dense in an NTT ring
+        {1024, 18433, 20, true},
+        {16, 7681, 16, true},      // no NTT tables
+        {4, 17, 4, true},
+    };
+    for (const Case& c : cases) {
+        SCOPED_TRACE("n=" + std::to_string(c.n) + " q=" + std::to_string(c.q));
+        const SmallPolynomial16 small(randomSmall(rng, c.n, c.q < 100 ? 8 : 300, c.weight), c.q);
+        const Polynomial large = randomPolynomial(rng, c.n, c.q);
+        const std::vector<uint64_t> expected = (small.toPolynomial() * large).getCoeffs();
+
+        EXPECT_EQ(small.usesDirectProduct(), c.direct);
+        EXPECT_EQ((small * large).getCoeffs(), expected);
+        EXPECT_EQ((large * small).getCoeffs(), expected);
+        EXPECT_EQ(Polynomial((small * Polynomial16(large))).getCoeffs(), expected);
+        if (c.n >= 256) {
+            Polynomial large_hat = large;
+            large_hat.toNTT();
+            EXPECT_EQ(small.multiply(large_hat).getCoeffs(), expected);
+        }
+    }
+
+    EXPECT_THROW(SmallPolynomial(8, 7681).multiply(Polynomial(8, 12289)), std::invalid_argument);
+}
+
+TEST(SmallPolynomialTest, KEMSecretIsCentered) {
+    KEM kem(SecurityLevel::KYBER512);
+    kem.generateKeys();
+    const SmallPolynomial16 s = SmallPolynomial16::fromPolynomial(kem.getSecretKeyForTesting());
+    EXPECT_GT(s.weight(), 0u);
+    for (int16_t c : s.values()) {
+        EXPECT_LE(std::abs(c), 40);
+    }
+
+    // Wider noise would have to be truncated to fit q or 16 bits.
+    EXPECT_NO_THROW(KEM(16, 7681, 300.0));
+    EXPECT_THROW(KEM(16, 7681, 1000.0), std::invalid_argument);
+    EXPECT_THROW(KEM(16, 40961, 4000.0), std::invalid_argument);
+}
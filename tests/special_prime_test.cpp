@@ -0,0 +1,53 @@
+#include <gtest/gtest.h>
+
+#include <special_prime.h>
+
+#include <random>
+
+TEST(SpecialPrimeTest, DetectsProductionModuli) {
+    EXPECT_TRUE(SpecialPrimeReducer::isSpecialForm(7681));   // 15 * 2^9 + 1
+    EXPECT_TRUE(SpecialPrimeReducer::isSpecialForm(12289));  // 3 * 2^12 + 1
+    EXPECT_TRUE(SpecialPrimeReducer::isSpecialForm(18433));  // 9 * 2^11 + 1
+    EXPECT_TRUE(SpecialPrimeReducer::isSpecialForm(17));     // 1 * 2^4 + 1
+
+    EXPECT_FALSE(SpecialPrimeReducer::isSpecialForm(16));
+    EXPECT_FALSE(SpecialPrimeReducer::isSpecialForm(2));
+
+    SpecialPrimeReducer red(12289);
+    EXPECT_EQ(red.factor(), 3u);
+    EXPECT_EQ(red.shift(), 12u);
+
+    EXPECT_EQ(SpecialPrimeReducer::forModulus(7681), SpecialPrimeReducer::forModulus(7681));
+    EXPECT_EQ(SpecialPrimeReducer::forModulus(16), nullptr);
+    EXPECT_THROW(SpecialPrimeReducer(16), std::invalid_argument);
+}
+
+TEST(SpecialPrimeTest, ExhaustiveSmallModulus) {
+    const std::uint64_t q = 17;
+    SpecialPrimeReducer red(q);
+    for (std::uint64_t a = 0; a < q; ++a) {
+        for (std::uint64_t b = 0; b < q; ++b) {
+            EXPECT_EQ(red.mulMod(a, b), (a * b) % q);
+            EXPECT_EQ(red.kred2(a * red.prescale(b)), (a * b) % q);
+        }
+    }
+}
+
+TEST(SpecialPrimeTest, MatchesDivisionForProductionModuli) {
+    std::mt19937_64 rng(0x6B726564ULL);
+    for (std::uint64_t q : {7681ULL, 12289ULL, 18433ULL}) {
+        SpecialPrimeReducer red(q);
+        std::uniform_int_distribution<std::uint64_t> dist(0, q - 1);
+
+        // Extremes of the input range first.
+        EXPECT_EQ(red.mulMod(q - 1, q - 1), ((q - 1) * (q - 1)) % q);
+        EXPECT_EQ(red.mulMod(0, q - 1), 0u);
+
+        for (int t = 0; t < 100000; ++t) {
+            std::uint64_t a = dist(rng);
+            std::uint64_t b = dist(rng);
+            ASSERT_EQ(red.mulMod(a, b), (a * b) % q) << "q=" << q << " a=" << a << " b=" << b;
+            ASSERT_EQ(red.kred2(a * red.prescale(b)), (a * b) % q);
+        }
+    }
+}
@@ -0,0 +1,27 @@
+#ifndef TEST_UTIL_H
+#define TEST_UTIL_H
+
+#include <polynomial.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+/**
+ * @brief Polynomial in Z_q[x]/(x^n + 1) with uniform coefficients in [0, q).
+ *
+ * @tparam Poly Polynomial type to build; anything constructible from a
+ *              coefficient vector and a modulus.
+ */
+template<typename Poly = Polynomial>
+Poly randomPolynomial(std::mt19937_64& rng, std::size_t n, std::uint64_t q) {
+    std::uniform_int_distribution<std::uint64_t> dist(0, q - 1);
+    std::vector<std::uint64_t> coeffs(n);
+    for (auto& c : coeffs) {
+        c = dist(rng);
+    }
+    return Poly(coeffs, q);
+}
+
+#endif // TEST_UTIL_H
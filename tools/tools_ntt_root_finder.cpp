@@ -53,6 +53,15 @@ static uint64_t findPsi(uint64_t q, uint64_t n) {
     return 0;
 }
 
+static void emitArray(const string& name, const vector<uint64_t>& values) {
+    cout << "inline constexpr twiddle_t " << name << "[" << values.size() << "] = {";
+    for (size_t i = 0; i < values.size(); ++i) {
+        cout << values[i];
+        if (i + 1 != values.size()) cout << ",";
+    }
+    cout << "};\n";
+}
+
 int main() {
     vector<pair<uint64_t,uint64_t>> params = {
         {8, 7681},
@@ -62,10 +71,38 @@ int main() {
         {1024, 18433},
     };
 
+    // Twiddles are stored in the narrowest type holding every q.
+    for (auto [n,q] : params) {
+        if (q > 0xFFFF) {
+            cerr << "q=" << q << " does not fit the 16-bit twiddle type\n";
+            return 1;
+        }
+    }
+
     cout << "#ifndef NTT_TABLES_H\n#define NTT_TABLES_H\n\n";
     cout << "#include <cstddef>\n#include <cstdint>\n\n";
+    cout << "// Generated by tools/tools_ntt_root_finder.cpp; do not edit by hand.\n\n";
     cout << "namespace ntt_tables {\n\n";
-    cout << "struct PsiTables {\\n    std::size_t n;\\n    std::uint64_t q;\\n    std::uint64_t psi;\\n    std::uint64_t psi_inv;\\n    const std::uint64_t* twist;\\n    const std::uint64_t* twist_inv;\\n};\\n\\n";
+    cout << "/** Storage type of table entries; every supported q is below 2^16. */\n";
+    cout << "using twiddle_t = std::uint16_t;\n\n";
+    cout << "/**\n"
+            " * @brief Precomputed constants for one (n, q) ring.\n"
+            " *\n"
+            " * All arrays are laid out in the order the butterflies consume them.\n"
+            " * The layer tables hold n - 1 entries: the layer whose butterflies\n"
+            " * span 2h elements uses (omega^{n/2h})^j for j < h, stored contiguously\n"
+            " * from offset h - 1, with omega = psi^2.\n"
+            " */\n";
+    cout << "struct PsiTables {\n"
+            "    std::size_t n;\n"
+            "    std::uint64_t q;\n"
+            "    std::uint64_t psi;\n"
+            "    std::uint64_t psi_inv;\n"
+            "    const twiddle_t* twist;       ///< psi^i, i < n\n"
+            "    const twiddle_t* untwist;     ///< psi^{-i} * n^{-1}, i < n\n"
+            "    const twiddle_t* fwd_layers;  ///< forward layer twiddles\n"
+            "    const twiddle_t* inv_layers;  ///< inverse layer twiddles\n"
+            "};\n\n";
 
     for (auto [n,q] : params) {
         uint64_t k = 2*n;
@@ -79,35 +116,40 @@ int main() {
             continue;
         }
         uint64_t psi_inv = modInverse(psi, q);
+        uint64_t n_inv = modInverse(n, q);
+        uint64_t omega = modMul(psi, psi, q);
+        uint64_t omega_inv = modInverse(omega, q);
 
         string tag = to_string(n) + string("_") + to_string(q);
 
         cout << "inline constexpr std::uint64_t psi_" << tag << " = " << psi << "ULL;\n";
         cout << "inline constexpr std::uint64_t psi_inv_" << tag << " = " << psi_inv << "ULL;\n";
 
-        // twist = psi^{2i+1}
-        cout << "inline constexpr std::uint64_t twist_" << tag << "[" << n << "] = {";
+        vector<uint64_t> twist(n), untwist(n);
         for (uint64_t i = 0; i < n; ++i) {
-            uint64_t e = 2*i + 1;
-            uint64_t v = modPow(psi, e, q);
-            cout << v << "ULL";
-            if (i + 1 != n) cout << ",";
+            twist[i] = modPow(psi, i, q);
+            untwist[i] = modMul(modPow(psi_inv, i, q), n_inv, q);
         }
-        cout << "};\n";
 
-        // twist_inv = psi^{-(2i+1)} = (psi_inv)^{2i+1}
-        cout << "inline constexpr std::uint64_t twist_inv_" << tag << "[" << n << "] = {";
-        for (uint64_t i = 0; i < n; ++i) {
-            uint64_t e = 2*i + 1;
-            uint64_t v = modPow(psi_inv, e, q);
-            cout << v << "ULL";
-            if (i + 1 != n) cout << ",";
+        vector<uint64_t> fwd(n - 1), inv(n - 1);
+        for (uint64_t h = 1; h < n; h <<= 1) {
+            uint64_t step = modPow(omega, n / (2*h), q);
+            uint64_t step_inv = modPow(omega_inv, n / (2*h), q);
+            for (uint64_t j = 0; j < h; ++j) {
+                fwd[h - 1 + j] = modPow(step, j, q);
+                inv[h - 1 + j] = modPow(step_inv, j, q);
+            }
         }
-        cout << "};\n";
+
+        emitArray("twist_" + tag, twist);
+        emitArray("untwist_" + tag, untwist);
+        emitArray("fwd_layers_" + tag, fwd);
+        emitArray("inv_layers_" + tag, inv);
 
         cout << "inline constexpr PsiTables tables_" << tag << "{" << n << ", " << q
              << ", psi_" << tag << ", psi_inv_" << tag
-             << ", twist_" << tag << ", twist_inv_" << tag << "};\n\n";
+             << ", twist_" << tag << ", untwist_" << tag
+             << ", fwd_layers_" << tag << ", inv_layers_" << tag << "};\n\n";
     }
 
     cout << "inline constexpr const PsiTables* getPsiTables(std::size_t n, std::uint64_t q) {\n";
@@ -117,5 +159,16 @@ int main() {
     }
     cout << "    return nullptr;\n}" << "\n\n";
 
+    // Compares (n, q) only: a pointer comparison against nullptr is not a
+    // constant expression under -fsanitize=undefined.
+    cout << "/** @brief True if getPsiTables(n, q) is non-null; usable in constant expressions. */\n";
+    cout << "inline constexpr bool hasPsiTables(std::size_t n, std::uint64_t q) {\n    return";
+    bool first = true;
+    for (auto [n,q] : params) {
+        cout << (first ? " " : " ||\n           ") << "(n == " << n << " && q == " << q << ")";
+        first = false;
+    }
+    cout << ";\n}" << "\n\n";
+
     cout << "} // namespace ntt_tables\n\n#endif // NTT_TABLES_H\n";
 }